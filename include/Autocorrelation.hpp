@@ -0,0 +1,241 @@
+/*******************************************************************************
+ Causal Dynamical Triangulations in C++ using CGAL
+
+ Copyright © 2026 Adam Getchell
+ ******************************************************************************/
+
+/// @file Autocorrelation.hpp
+/// @brief Online integrated-autocorrelation-time and effective-sample-size
+/// estimates of Markov-chain observables
+/// @details Batch means with a doubling batch size keep the estimate in
+/// constant memory and amortized constant time per observation, so it can
+/// run inside the transition loop.
+
+#ifndef INCLUDE_AUTOCORRELATION_HPP_
+#define INCLUDE_AUTOCORRELATION_HPP_
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <optional>
+
+#include "Geometry.hpp"
+#include "Mpfr_value.hpp"
+#include "S3Action.hpp"
+
+namespace cdt::autocorrelation
+{
+  /// @brief Online batch-means estimate of one observable's \f$\tau_{int}\f$
+  /// @details Observations are summed into at most `max_batches` batches of
+  /// equal size. When every batch is full, adjacent batches merge and the
+  /// batch size doubles. For batches of size \f$b\f$ much longer than the
+  /// correlation time, the batch means have variance
+  /// \f$2\tau_{int}\sigma^2/b\f$, so
+  /// \f$\tau_{int} = b\,s_B^2/(2\sigma^2)\f$, with \f$\tau_{int} = 1/2\f$ for
+  /// independent samples. The sample variance uses Welford's update.
+  class BatchMeans
+  {
+   public:
+    /// @brief Number of batches before adjacent pairs merge
+    static constexpr std::size_t max_batches = 64;
+
+    /// @brief Complete batches required before an estimate is reported
+    static constexpr std::size_t min_batches = max_batches / 2;
+
+   private:
+    std::array<long double, max_batches> m_batch_sums{};
+    std::size_t                          m_batches{};
+    std::uint64_t                        m_batch_size{1};
+    long double                          m_partial_sum{};
+    std::uint64_t                        m_partial_count{};
+    std::uint64_t                        m_count{};
+    long double                          m_mean{};
+    long double                          m_m2{};
+    bool                                 m_merged{false};
+
+    void merge_batches() noexcept
+    {
+      for (std::size_t index = 0; index < max_batches / 2; ++index)
+      {
+        m_batch_sums[index] =
+            m_batch_sums[2 * index] + m_batch_sums[2 * index + 1];
+      }
+      std::fill(m_batch_sums.begin() + max_batches / 2, m_batch_sums.end(),
+                0.0L);
+      m_batches = max_batches / 2;
+      m_batch_size *= 2;
+      m_merged = true;
+    }
+
+   public:
+    /// @brief Record the next observation of the series.
+    /// @param value Observation
+    void add(long double const value) noexcept
+    {
+      ++m_count;
+      auto const delta = value - m_mean;
+      m_mean += delta / static_cast<long double>(m_count);
+      m_m2 += delta * (value - m_mean);
+
+      m_partial_sum += value;
+      if (++m_partial_count < m_batch_size) { return; }
+      m_batch_sums[m_batches++] = m_partial_sum;
+      m_partial_sum             = 0.0L;
+      m_partial_count           = 0;
+      if (m_batches == max_batches) { merge_batches(); }
+    }
+
+    /// @returns Number of observations
+    [[nodiscard]] auto count() const noexcept { return m_count; }
+
+    /// @returns Mean of the observations
+    [[nodiscard]] auto mean() const noexcept { return m_mean; }
+
+    /// @returns Unbiased sample variance, or zero for fewer than two
+    [[nodiscard]] auto variance() const noexcept -> long double
+    {
+      return m_count < 2 ? 0.0L
+                         : m_m2 / static_cast<long double>(m_count - 1);
+    }
+
+    /// @returns Current batch size
+    [[nodiscard]] auto batch_size() const noexcept { return m_batch_size; }
+
+    /// @returns Integrated autocorrelation time in observations, or an empty
+    /// optional until batches have merged at least once and
+    /// `min_batches` are complete. A constant series reports 1/2.
+    [[nodiscard]] auto tau_int() const noexcept -> std::optional<long double>
+    {
+      if (!m_merged || m_batches < min_batches) { return std::nullopt; }
+      auto const variance = this->variance();
+      if (!(variance > 0.0L)) { return 0.5L; }
+
+      auto const size       = static_cast<long double>(m_batch_size);
+      auto       batch_mean = 0.0L;
+      for (std::size_t index = 0; index < m_batches; ++index)
+      {
+        batch_mean += m_batch_sums[index] / size;
+      }
+      batch_mean /= static_cast<long double>(m_batches);
+      auto spread = 0.0L;
+      for (std::size_t index = 0; index < m_batches; ++index)
+      {
+        auto const offset = m_batch_sums[index] / size - batch_mean;
+        spread += offset * offset;
+      }
+      auto const batch_variance =
+          spread / static_cast<long double>(m_batches - 1);
+      return std::max(0.5L, size * batch_variance / (2.0L * variance));
+    }
+
+    /// @returns \f$n/(2\tau_{int})\f$, or an empty optional while
+    /// tau_int() is unavailable
+    [[nodiscard]] auto effective_sample_size() const noexcept
+        -> std::optional<long double>
+    {
+      auto const tau = tau_int();
+      if (!tau) { return std::nullopt; }
+      return static_cast<long double>(m_count) / (2.0L * *tau);
+    }
+  };
+
+  /// @brief Batch-means estimates of \f$N_3\f$, \f$N_1^{TL}\f$, and the bulk
+  /// action, observed once per transition
+  /// @details The action is evaluated in long double from its cached MPFR
+  /// coefficients; it is a diagnostic and never enters an acceptance
+  /// decision.
+  class AutocorrelationMonitor
+  {
+    std::array<long double, 3> m_coefficients{};
+    BatchMeans                 m_n3;
+    BatchMeans                 m_n1_tl;
+    BatchMeans                 m_action;
+
+   public:
+    /// @brief Monitor of the geometry counts with a zero action.
+    AutocorrelationMonitor() = default;
+
+    /// @param parameters Physical parameters of the sampled bulk action.
+    explicit AutocorrelationMonitor(
+        s3_action::PhysicalParameters const& parameters)
+        : m_coefficients{
+              mpfr_values::to_long_double(parameters.bulk_coefficients().n1_tl),
+              mpfr_values::to_long_double(
+                  parameters.bulk_coefficients().n3_31_13),
+              mpfr_values::to_long_double(parameters.bulk_coefficients().n3_22)}
+    {}
+
+    /// @brief Record the state after one transition.
+    /// @param geometry Geometry of the current state.
+    void observe(Geometry<3> const& geometry) noexcept
+    {
+      m_n3.add(static_cast<long double>(geometry.N3));
+      m_n1_tl.add(static_cast<long double>(geometry.N1_TL));
+      m_action.add(
+          m_coefficients[0] * static_cast<long double>(geometry.N1_TL) +
+          m_coefficients[1] * static_cast<long double>(geometry.N3_31_13) +
+          m_coefficients[2] * static_cast<long double>(geometry.N3_22));
+    }
+
+    /// @returns Estimator of \f$N_3\f$
+    [[nodiscard]] auto n3() const noexcept -> BatchMeans const&
+    { return m_n3; }
+
+    /// @returns Estimator of \f$N_1^{TL}\f$
+    [[nodiscard]] auto n1_tl() const noexcept -> BatchMeans const&
+    { return m_n1_tl; }
+
+    /// @returns Estimator of the bulk action
+    [[nodiscard]] auto action() const noexcept -> BatchMeans const&
+    { return m_action; }
+
+    /// @returns The largest \f$\tau_{int}\f$ of the three observables, in
+    /// transitions, or an empty optional while none is available
+    [[nodiscard]] auto tau_int() const noexcept -> std::optional<long double>
+    {
+      std::optional<long double> slowest;
+      for (auto const* series : {&m_n3, &m_n1_tl, &m_action})
+      {
+        if (auto const tau = series->tau_int())
+        {
+          slowest = std::max(slowest.value_or(*tau), *tau);
+        }
+      }
+      return slowest;
+    }
+
+    /// @returns Effective independent samples of the slowest observable
+    [[nodiscard]] auto effective_sample_size() const noexcept
+        -> std::optional<long double>
+    {
+      auto const tau = tau_int();
+      if (!tau) { return std::nullopt; }
+      return static_cast<long double>(m_n3.count()) / (2.0L * *tau);
+    }
+  };
+
+  /// @brief Passes between measurements spaced by a multiple of
+  /// \f$\tau_{int}\f$.
+  /// @param multiple Measurements per \f$\tau_{int}\f$ spacing; positive.
+  /// @param tau Integrated autocorrelation time in transitions.
+  /// @param transitions_per_pass Transitions in one pass, usually \f$N_3\f$.
+  /// @returns \f$\lceil m\tau/N_3\rceil\f$, at least one pass.
+  [[nodiscard]] inline auto checkpoint_interval(
+      long double const multiple, long double const tau,
+      Int_precision const transitions_per_pass) noexcept -> Int_precision
+  {
+    auto const passes = std::ceil(
+        multiple * tau /
+        static_cast<long double>(std::max(transitions_per_pass, 1)));
+    if (!(passes >= 1.0L)) { return 1; }
+    constexpr auto largest = std::numeric_limits<Int_precision>::max();
+    return passes >= static_cast<long double>(largest)
+               ? largest
+               : static_cast<Int_precision>(passes);
+  }
+}  // namespace cdt::autocorrelation
+
+#endif  // INCLUDE_AUTOCORRELATION_HPP_
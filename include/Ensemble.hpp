@@ -0,0 +1,258 @@
+/*******************************************************************************
+ Causal Dynamical Triangulations in C++ using CGAL
+
+ Copyright © 2026 Adam Getchell
+ ******************************************************************************/
+
+/// @file Ensemble.hpp
+/// @brief Independent Metropolis-Hastings chains run on a pool of threads
+/// @details One process initializes a single triangulation and evolves N
+/// copies of it, each with its own transition stream, instead of launching N
+/// processes that each pay for initialization.
+
+#ifndef INCLUDE_ENSEMBLE_HPP_
+#define INCLUDE_ENSEMBLE_HPP_
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "Metropolis.hpp"
+#include "Move_run.hpp"
+#include "Random.hpp"
+#include "Utilities.hpp"
+
+namespace cdt
+{
+  /// @brief Derive one transition stream per chain from a single root seed.
+  /// @param root Root stream; only its seed is used.
+  /// @param chains Number of chains.
+  /// @returns Chain c's engine, `root.split(random_streams::chain(c))`.
+  [[nodiscard]] inline auto ensemble_streams(cdt::Random const& root,
+                                             std::size_t const  chains)
+      -> std::vector<cdt::Random>
+  {
+    std::vector<cdt::Random> streams;
+    streams.reserve(chains);
+    for (std::size_t index = 0; index < chains; ++index)
+    {
+      streams.push_back(root.split(random_streams::chain(index)));
+    }
+    return streams;
+  }
+
+  /// @brief Give each chain its own root seed on the transition stream.
+  /// @param seeds Root seed of each chain.
+  /// @returns Chain c's engine, seeded by `seeds[c]` on
+  /// `random_streams::transitions`.
+  [[nodiscard]] inline auto ensemble_seeds(
+      std::vector<cdt::RandomSeed> const& seeds) -> std::vector<cdt::Random>
+  {
+    std::vector<cdt::Random> streams;
+    streams.reserve(seeds.size());
+    for (auto const seed : seeds)
+    {
+      streams.emplace_back(seed, random_streams::transitions);
+    }
+    return streams;
+  }
+
+  /// @brief An ensemble of independent Metropolis-Hastings chains
+  /// @details Every chain owns its Metropolis strategy, its random engine,
+  /// and its copy of the initial manifold, and nothing is shared while the
+  /// chains run. Chains are assigned to at most `workers` threads, so each
+  /// chain's result, counters, and `transition_trace` are identical for any
+  /// worker count. Checkpoints are written per chain, with the chain index
+  /// in the metadata and the file name.
+  /// @tparam ManifoldType The type of Manifold on which to apply the algorithm
+  template <typename ManifoldType>
+    requires(ManifoldType::dimension == 3)
+  class Ensemble
+  {
+    using Chain   = MoveStrategy<MoveStrategyKind::METROPOLIS, ManifoldType>;
+    using Counter = move_tracker::MoveTracker;
+
+    /// @brief Metropolis strategy of each chain
+    std::vector<Chain> m_chains;
+
+    /// @brief Maximum number of worker threads running chains
+    std::size_t m_workers{1};
+
+    template <typename Select>
+    [[nodiscard]] auto sum(Select select) const -> Counter
+    {
+      Counter total;
+      for (auto const& strategy : m_chains) { total += (strategy.*select)(); }
+      return total;
+    }
+
+   public:
+    Ensemble() = delete;
+
+    /// @brief Construct an ensemble from one engine per chain.
+    /// @param alpha Timelike edge length.
+    /// @param k Normalized Newton constant.
+    /// @param lambda Normalized cosmological constant.
+    /// @param passes Number of passes each chain executes.
+    /// @param checkpoint Interval between checkpoint events.
+    /// @param write_files Whether checkpoint events may write files.
+    /// @param streams Transition engine of each chain, for example from
+    /// ensemble_streams() or ensemble_seeds().
+    /// @param workers Maximum worker threads running chains.
+    /// @param reproducibility Optional initialization and requested-state
+    /// provenance shared by every chain.
+    /// @throws std::invalid_argument If @p streams is empty, @p workers is
+    /// zero, a coupling is non-finite, or either cadence value is nonpositive.
+    /// @throws std::domain_error If `alpha` is not greater than 1/2.
+    Ensemble(long double const alpha, long double const k,
+             long double const lambda, Int_precision const passes,
+             Int_precision const checkpoint, bool const write_files,
+             std::vector<cdt::Random> streams, std::size_t const workers = 1,
+             std::optional<utilities::Reproducibility_metadata>
+                 reproducibility = std::nullopt)
+        : m_workers{workers}
+    {
+      if (streams.empty())
+      {
+        throw std::invalid_argument{"An ensemble needs at least one chain."};
+      }
+      if (m_workers == 0)
+      {
+        throw std::invalid_argument{
+            "An ensemble needs at least one worker thread."};
+      }
+      m_chains.reserve(streams.size());
+      for (std::size_t index = 0; index < streams.size(); ++index)
+      {
+        auto metadata = reproducibility.value_or(
+            utilities::Reproducibility_metadata{});
+        metadata.chain = index;
+        m_chains.emplace_back(alpha, k, lambda, passes, checkpoint,
+                              write_files, std::move(streams[index]),
+                              std::move(metadata));
+      }
+    }
+
+    /// @returns The number of chains
+    [[nodiscard]] auto chains() const noexcept { return m_chains.size(); }
+
+    /// @returns The maximum number of worker threads
+    [[nodiscard]] auto workers() const noexcept { return m_workers; }
+
+    /// @param index Chain index.
+    /// @returns The Metropolis strategy of chain @p index.
+    /// @throws std::out_of_range If @p index is not a chain.
+    [[nodiscard]] auto chain(std::size_t const index) const -> Chain const&
+    { return m_chains.at(index); }
+
+    /// @brief Select the acceptance evaluation of every chain.
+    /// @param evaluation The evaluation used by subsequent transitions.
+    void set_acceptance_evaluation(
+        AcceptanceEvaluation const evaluation) noexcept
+    {
+      for (auto& strategy : m_chains)
+      {
+        strategy.set_acceptance_evaluation(evaluation);
+      }
+    }
+
+    /// @brief Add a volume-fixing potential to the action of every chain.
+    /// @param volume The term used by subsequent transitions.
+    /// @throws std::invalid_argument If an enabled term is out of range.
+    void set_volume_fixing(s3_action::VolumeFixing const& volume)
+    {
+      for (auto& strategy : m_chains) { strategy.set_volume_fixing(volume); }
+    }
+
+    /// @brief Space every chain's checkpoints by a multiple of its own
+    /// \f$\tau_{int}\f$.
+    /// @param multiple Integrated autocorrelation times between checkpoints,
+    /// or an empty optional for the fixed cadence.
+    /// @throws std::invalid_argument If @p multiple is not finite and
+    /// positive.
+    void set_adaptive_checkpoints(std::optional<long double> const multiple)
+    {
+      for (auto& strategy : m_chains)
+      {
+        strategy.set_adaptive_checkpoints(multiple);
+      }
+    }
+
+    /// @brief Precede every chain's run with its own automatic burn-in.
+    /// @param max_passes Maximum burn-in passes, or an empty optional to
+    /// disable burn-in.
+    /// @throws std::invalid_argument If @p max_passes is not positive.
+    void set_burn_in(std::optional<Int_precision> const max_passes)
+    {
+      for (auto& strategy : m_chains) { strategy.set_burn_in(max_passes); }
+    }
+
+    /// @brief Stop every chain at a shared wall-clock deadline.
+    /// @param deadline Time by which output must be written, or an empty
+    /// optional for unbounded chains.
+    void set_deadline(
+        std::optional<std::chrono::steady_clock::time_point> const
+            deadline) noexcept
+    {
+      for (auto& strategy : m_chains) { strategy.set_deadline(deadline); }
+    }
+
+    /// @returns Proposed moves summed over the latest run of every chain
+    [[nodiscard]] auto proposed() const -> Counter
+    { return sum(&Chain::proposed); }
+
+    /// @returns Accepted moves summed over the latest run of every chain
+    [[nodiscard]] auto accepted() const -> Counter
+    { return sum(&Chain::accepted); }
+
+    /// @returns Rejected moves summed over the latest run of every chain
+    [[nodiscard]] auto rejected() const -> Counter
+    { return sum(&Chain::rejected); }
+
+    /// @returns Attempted constructions summed over every chain
+    [[nodiscard]] auto attempted() const -> Counter
+    { return sum(&Chain::attempted); }
+
+    /// @returns Successful constructions summed over every chain
+    [[nodiscard]] auto succeeded() const -> Counter
+    { return sum(&Chain::succeeded); }
+
+    /// @returns Failed constructions summed over every chain
+    [[nodiscard]] auto failed() const -> Counter
+    { return sum(&Chain::failed); }
+
+    /// @brief Run every chain from a copy of @p initial.
+    /// @details A failing chain stops only the worker running it; after all
+    /// workers join, the first failure is rethrown.
+    /// @param initial Initial canonical state of every chain.
+    /// @returns The final state of each chain, in chain order.
+    /// @throws std::filesystem::filesystem_error if checkpoint output is
+    /// enabled and persistence fails; also propagates failures from move
+    /// generation and validation.
+    [[nodiscard]] auto operator()(ManifoldType const& initial)
+        -> std::vector<ManifoldType>
+    {
+      std::vector<ManifoldType> results(m_chains.size());
+      detail::run_on_workers(
+          m_chains.size(), m_workers,
+          [this, &initial, &results](std::size_t const index) {
+            results[index] = m_chains[index](initial);
+          });
+      fmt::print("=== Ensemble results ===\n");
+      fmt::print("{} chains: {} proposed moves with {} accepted and {} "
+                 "rejected.\n",
+                 m_chains.size(), proposed().total(), accepted().total(),
+                 rejected().total());
+      return results;
+    }
+  };  // Ensemble
+
+  /// Metropolis ensemble for the supported 3D manifold.
+  using Ensemble_3 = Ensemble<manifolds::Manifold_3>;
+}  // namespace cdt
+
+#endif  // INCLUDE_ENSEMBLE_HPP_
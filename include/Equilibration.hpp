@@ -0,0 +1,122 @@
+/*******************************************************************************
+ Causal Dynamical Triangulations in C++ using CGAL
+
+ Copyright © 2026 Adam Getchell
+ ******************************************************************************/
+
+/// @file Equilibration.hpp
+/// @brief Detection of the end of the initial transient of a Markov chain
+/// @details The marginal standard error rule (MSER) chooses the truncation
+/// point that minimizes the standard error of the remaining mean. A series
+/// whose truncation point lies in its first half is taken to be equilibrated.
+
+#ifndef INCLUDE_EQUILIBRATION_HPP_
+#define INCLUDE_EQUILIBRATION_HPP_
+
+#include <algorithm>
+#include <cstddef>
+#include <optional>
+#include <vector>
+
+#include "Geometry.hpp"
+
+namespace cdt::equilibration
+{
+  /// @brief MSER truncation of one observable
+  /// @details For observations \f$x_1,\ldots,x_n\f$ the statistic
+  /// \f[\mathrm{MSER}(d)=\frac{1}{(n-d)^2}\sum_{i>d}(x_i-\bar{x}_d)^2\f]
+  /// is minimized over \f$0\le d\le n/2\f$. A minimum at the edge of that
+  /// window means the series is still drifting.
+  class MserSeries
+  {
+    std::vector<long double> m_values;
+
+   public:
+    /// @brief Observations required before a truncation point is reported
+    static constexpr std::size_t min_samples = 10;
+
+    /// @brief Record the next observation of the series.
+    /// @param value Observation
+    void add(long double const value) { m_values.push_back(value); }
+
+    /// @returns Number of observations
+    [[nodiscard]] auto count() const noexcept { return m_values.size(); }
+
+    /// @returns The MSER truncation point, or an empty optional while fewer
+    /// than `min_samples` observations are recorded or the minimum lies at
+    /// the edge of the first half.
+    [[nodiscard]] auto truncation() const -> std::optional<std::size_t>
+    {
+      auto const size = m_values.size();
+      if (size < min_samples) { return std::nullopt; }
+
+      // Suffix sums give every MSER(d) in one backward sweep.
+      auto const window     = size / 2;
+      auto       sum        = 0.0L;
+      auto       sum_square = 0.0L;
+      auto       best       = std::size_t{};
+      auto       best_value = 0.0L;
+      for (auto index = size; index-- > 0;)
+      {
+        sum += m_values[index];
+        sum_square += m_values[index] * m_values[index];
+        if (index > window) { continue; }
+        auto const remaining = static_cast<long double>(size - index);
+        auto const spread =
+            std::max(0.0L, sum_square - sum * sum / remaining);
+        auto const value = spread / (remaining * remaining);
+        if (index == window || value <= best_value)
+        {
+          best       = index;
+          best_value = value;
+        }
+      }
+      if (best == window) { return std::nullopt; }
+      return best;
+    }
+  };
+
+  /// @brief MSER equilibration test of the \f$N_3\f$, \f$N_3^{(2,2)}\f$, and
+  /// \f$N_1^{TL}\f$ series of a run
+  /// @details The run is equilibrated once every series has a truncation
+  /// point in its first half.
+  class EquilibrationDetector
+  {
+    MserSeries m_n3;
+    MserSeries m_n3_22;
+    MserSeries m_n1_tl;
+
+   public:
+    /// @brief Record the state after one pass.
+    /// @param geometry Geometry of the current state.
+    void observe(Geometry<3> const& geometry)
+    {
+      m_n3.add(static_cast<long double>(geometry.N3));
+      m_n3_22.add(static_cast<long double>(geometry.N3_22));
+      m_n1_tl.add(static_cast<long double>(geometry.N1_TL));
+    }
+
+    /// @returns Number of recorded states
+    [[nodiscard]] auto count() const noexcept { return m_n3.count(); }
+
+    /// @returns The largest truncation point of the three series, or an
+    /// empty optional while any series is still drifting
+    [[nodiscard]] auto truncation() const -> std::optional<std::size_t>
+    {
+      auto latest = std::size_t{};
+      for (auto const* series : {&m_n3, &m_n3_22, &m_n1_tl})
+      {
+        auto const point = series->truncation();
+        if (!point) { return std::nullopt; }
+        latest = std::max(latest, *point);
+      }
+      return latest;
+    }
+
+    /// @returns Whether every series has passed the MSER test
+    [[nodiscard]] auto equilibrated() const -> bool
+    { return truncation().has_value(); }
+  };
+}  // namespace cdt::equilibration
+
+#endif  // INCLUDE_EQUILIBRATION_HPP_
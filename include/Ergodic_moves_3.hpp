@@ -22,16 +22,23 @@
 #include <algorithm>
 #include <array>
 #include <bit>
+#include <cassert>
 #include <concepts>
 #include <cstddef>
+#include <cstdint>
 #include <expected>
+#include <functional>
 #include <limits>
+#include <numeric>
 #include <optional>
 #include <random>
 #include <ranges>
 #include <string>
+#include <type_traits>
+#include <unordered_map>
 #include <unordered_set>
 #include <utility>
+#include <variant>
 #include <vector>
 
 #include "Manifold.hpp"
@@ -63,49 +70,72 @@ namespace cdt::ergodic_moves
   {
     using Cell_points = std::array<Point_t<3>, 4>;
     using Edge_points = std::array<Point_t<3>, 2>;
-    using Execution   = std::expected<void, MoveError>;
+    using Execution   = MoveApplication;
+    using Star        = foliated_triangulations::Star;
+    using UndoJournal = foliated_triangulations::UndoJournal;
+    using Validation  = foliated_triangulations::Validation;
+
+    /// @brief Stable locator for a vertex named by a prepared move.
+    /// @details The handle and persistent id name the vertex in constant time
+    /// while it is alive in the triangulation the move was prepared against.
+    /// The handle is only dereferenced after that triangulation is shown to
+    /// own it, so a locator never follows an invalidated handle. The point
+    /// locates the vertex geometrically when the handle no longer resolves.
+    struct Vertex_locator
+    {
+      Point_t<3>    point;
+      Vertex_handle vertex;
+      Simplex_id    id{UNASSIGNED_SIMPLEX_ID};
+    };
+
+    using Cell_locator = std::array<Vertex_locator, 4>;
+    using Edge_locator = std::array<Vertex_locator, 2>;
 
     /// @brief Prepared (2,3) site whose CDT preconditions have been proven.
-    /// @details The locator owns point values rather than CGAL handles, so it
-    /// can be moved freely and never retains an invalidated cell handle.
+    /// @details The locators hold vertex handles, ids, and points but no cell
+    /// handles, so the value can be moved freely and never retains an
+    /// invalidated cell handle.
     class ApplicableTwoThreeMove
     {
-      Cell_points m_cell;
-      Point_t<3>  m_opposite;
+      Cell_locator   m_cell;
+      Vertex_locator m_opposite;
 
-      ApplicableTwoThreeMove(Cell_points cell, Point_t<3> opposite) noexcept
+      ApplicableTwoThreeMove(Cell_locator   cell,
+                             Vertex_locator opposite) noexcept
           : m_cell{cell}, m_opposite{opposite}
       {}
 
       friend auto prepare_two_three(Delaunay const&    triangulation,
                                     Cell_handle const& candidate)
           -> std::expected<ApplicableTwoThreeMove, MoveError>;
-      friend auto execute(Delaunay&                     triangulation,
+      friend auto execute(Delaunay& triangulation, UndoJournal& journal,
                           ApplicableTwoThreeMove const& move) -> Execution;
     };
 
     /// @brief Prepared (3,2) site whose causal edge cavity has been proven.
     class ApplicableThreeTwoMove
     {
-      Edge_points m_edge;
+      Edge_locator m_edge;
 
-      explicit ApplicableThreeTwoMove(Edge_points edge) noexcept : m_edge{edge}
+      explicit ApplicableThreeTwoMove(Edge_locator edge) noexcept
+          : m_edge{edge}
       {}
 
       friend auto prepare_three_two(Delaunay const&    triangulation,
                                     Edge_handle const& candidate)
           -> std::expected<ApplicableThreeTwoMove, MoveError>;
-      friend auto execute(Delaunay&                     triangulation,
+      friend auto execute(Delaunay& triangulation, UndoJournal& journal,
                           ApplicableThreeTwoMove const& move) -> Execution;
     };
 
     /// @brief Prepared (2,6) spacelike facet between a (1,3)/(3,1) pair.
     class ApplicableTwoSixMove
     {
-      Cell_points m_bottom;
-      Point_t<3>  m_opposite;
+      Cell_locator   m_bottom;
+      Vertex_locator m_opposite;
 
-      ApplicableTwoSixMove(Cell_points bottom, Point_t<3> opposite) noexcept
+      ApplicableTwoSixMove(Cell_locator   bottom,
+                           Vertex_locator opposite) noexcept
           : m_bottom{bottom}, m_opposite{opposite}
       {}
 
@@ -114,19 +144,19 @@ namespace cdt::ergodic_moves
           -> std::expected<ApplicableTwoSixMove, MoveError>;
 
      public:
-      [[nodiscard]] auto bottom_points() const noexcept -> Cell_points const&
+      [[nodiscard]] auto bottom() const noexcept -> Cell_locator const&
       { return m_bottom; }
 
-      [[nodiscard]] auto opposite_point() const noexcept -> Point_t<3> const&
+      [[nodiscard]] auto opposite() const noexcept -> Vertex_locator const&
       { return m_opposite; }
     };
 
     /// @brief Prepared (6,2) degree-five vertex with the exact causal star.
     class ApplicableSixTwoMove
     {
-      Point_t<3> m_vertex;
+      Vertex_locator m_vertex;
 
-      explicit ApplicableSixTwoMove(Point_t<3> vertex) noexcept
+      explicit ApplicableSixTwoMove(Vertex_locator vertex) noexcept
           : m_vertex{vertex}
       {}
 
@@ -135,19 +165,19 @@ namespace cdt::ergodic_moves
           -> std::expected<ApplicableSixTwoMove, MoveError>;
 
      public:
-      [[nodiscard]] auto vertex_point() const noexcept -> Point_t<3> const&
+      [[nodiscard]] auto vertex() const noexcept -> Vertex_locator const&
       { return m_vertex; }
     };
 
     /// @brief Prepared causal four-cell diamond for a (4,4) exchange.
     class ApplicableFourFourMove
     {
-      Edge_points m_edge;
-      Point_t<3>  m_top;
-      Point_t<3>  m_bottom;
+      Edge_locator   m_edge;
+      Vertex_locator m_top;
+      Vertex_locator m_bottom;
 
-      ApplicableFourFourMove(Edge_points edge, Point_t<3> top,
-                             Point_t<3> bottom) noexcept
+      ApplicableFourFourMove(Edge_locator edge, Vertex_locator top,
+                             Vertex_locator bottom) noexcept
           : m_edge{edge}, m_top{top}, m_bottom{bottom}
       {}
 
@@ -161,13 +191,13 @@ namespace cdt::ergodic_moves
           -> std::expected<ApplicableFourFourMove, MoveError>;
 
      public:
-      [[nodiscard]] auto edge_points() const noexcept -> Edge_points const&
+      [[nodiscard]] auto edge() const noexcept -> Edge_locator const&
       { return m_edge; }
 
-      [[nodiscard]] auto top_point() const noexcept -> Point_t<3> const&
+      [[nodiscard]] auto top() const noexcept -> Vertex_locator const&
       { return m_top; }
 
-      [[nodiscard]] auto bottom_point() const noexcept -> Point_t<3> const&
+      [[nodiscard]] auto bottom() const noexcept -> Vertex_locator const&
       { return m_bottom; }
     };
 
@@ -196,6 +226,53 @@ namespace cdt::ergodic_moves
         [[maybe_unused]] Delaunay const& triangulation) noexcept -> bool
     { return true; }
 
+    /// @brief Check the triangulation data structure after journaled
+    /// mutations.
+    /// @details Only the journal's footprint is checked unless global move
+    /// validation was enabled at build time.
+    [[nodiscard]] inline auto is_valid_after(Delaunay const&    triangulation,
+                                             UndoJournal const& journal)
+        -> bool
+    {
+      return foliated_triangulations::is_locally_valid(triangulation,
+                                                       journal.footprint()) &&
+             (foliated_triangulations::DEFAULT_VALIDATION ==
+                  Validation::LOCAL ||
+              triangulation.tds().is_valid());
+    }
+
+    /// @returns True if every finite cell stores the type its vertices give
+    /// it.
+    [[nodiscard]] inline auto is_fully_classified(
+        Delaunay const& triangulation) -> bool
+    {
+      for (auto const cell : triangulation.finite_cell_handles())
+      {
+        auto const type = foliated_triangulations::expected_cell_type<3>(cell);
+        if (cell->info() != static_cast<Int_precision>(type)) { return false; }
+      }
+      return true;
+    }
+
+    /// @brief Classify the live finite cells in @p journal's footprint.
+    /// @details Journaled operations create or rewire only the cells they
+    /// touch, so every other cell keeps its vertices and hence its type.
+    /// @returns False if a touched cell is acausal or unclassifiable.
+    [[nodiscard]] inline auto classify_touched_cells(
+        Delaunay const& triangulation, UndoJournal const& journal) -> bool
+    {
+      auto causal = true;
+      for (auto const& cell : journal.footprint().live_cells())
+      {
+        if (triangulation.is_infinite(cell)) { continue; }
+        auto const type = foliated_triangulations::expected_cell_type<3>(cell);
+        causal = causal && type != CellType::ACAUSAL &&
+                 type != CellType::UNCLASSIFIED;
+        cell->info() = static_cast<Int_precision>(type);
+      }
+      return causal;
+    }
+
     /// @brief Rebuild all derived topology and geometry state around a value.
     [[nodiscard]] inline auto make_manifold(Delaunay        triangulation,
                                             Manifold const& source) -> Manifold
@@ -245,26 +322,74 @@ namespace cdt::ergodic_moves
       return incident_cells;
     }
 
+    /// @returns True if @p star is a (3,2) cavity: two (2,2) cells and one
+    /// (3,1) or (1,3) cell, all finite and correctly labelled.
+    [[nodiscard]] inline auto is_32_star(Star const& star) noexcept -> bool
+    {
+      return star.other == 0 && star.two_two == 2 &&
+             star.three_one + star.one_three == 1;
+    }
+
+    /// @returns True if @p star is a (6,2) cavity: degree five, with three
+    /// (3,1) and three (1,3) cells, all finite and correctly labelled.
+    [[nodiscard]] inline auto is_62_star(Star const& star) noexcept -> bool
+    {
+      return star.degree == 5 && star.other == 0 && star.two_two == 0 &&
+             star.three_one == 3 && star.one_three == 3;
+    }
+
+    /// @returns True if @p star is a (4,4) diamond: two (3,1) and two (1,3)
+    /// cells, all finite and correctly labelled.
+    [[nodiscard]] inline auto is_44_star(Star const& star) noexcept -> bool
+    {
+      return star.other == 0 && star.two_two == 0 && star.three_one == 2 &&
+             star.one_three == 2;
+    }
+
+    // Ranked proposal domains use the same order, breaking ties between
+    // coincident points by vertex id, so a rank drawn from either names the
+    // same site.
     [[nodiscard]] inline auto point_less(Point_t<3> const& left,
                                          Point_t<3> const& right) -> bool
-    { return CGAL::lexicographically_xyz_smaller(left, right); }
+    { return foliated_triangulations::point_precedes(left, right); }
 
     [[nodiscard]] inline auto canonical_cell_points(Cell_handle const& cell)
-        -> std::array<Point_t<3>, 4>
+        -> Cell_points
+    { return foliated_triangulations::canonical_points(cell); }
+
+    [[nodiscard]] inline auto canonical_edge_points(Edge_handle const& edge)
+        -> Edge_points
     {
-      std::array points{cell->vertex(0)->point(), cell->vertex(1)->point(),
-                        cell->vertex(2)->point(), cell->vertex(3)->point()};
-      std::ranges::sort(points, point_less);
-      return points;
+      return foliated_triangulations::canonical_points(
+          foliated_triangulations::make_edge_key(edge));
     }
 
-    [[nodiscard]] inline auto canonical_edge_points(Edge_handle const& edge)
-        -> std::array<Point_t<3>, 2>
+    /// @returns A locator for the live vertex @p vertex.
+    [[nodiscard]] inline auto make_locator(Vertex_handle const& vertex)
+        -> Vertex_locator
+    {
+      return {.point = vertex->point(), .vertex = vertex, .id = vertex->id()};
+    }
+
+    /// @returns Locators for the vertices of @p cell in canonical order.
+    [[nodiscard]] inline auto canonical_cell_locator(Cell_handle const& cell)
+        -> Cell_locator
     {
-      std::array points{edge.first->vertex(edge.second)->point(),
-                        edge.first->vertex(edge.third)->point()};
-      std::ranges::sort(points, point_less);
-      return points;
+      Cell_locator locator{
+          make_locator(cell->vertex(0)), make_locator(cell->vertex(1)),
+          make_locator(cell->vertex(2)), make_locator(cell->vertex(3))};
+      std::ranges::sort(locator, point_less, &Vertex_locator::point);
+      return locator;
+    }
+
+    /// @returns Locators for the endpoints of @p edge in canonical order.
+    [[nodiscard]] inline auto canonical_edge_locator(Edge_handle const& edge)
+        -> Edge_locator
+    {
+      Edge_locator locator{make_locator(edge.first->vertex(edge.second)),
+                           make_locator(edge.first->vertex(edge.third))};
+      std::ranges::sort(locator, point_less, &Vertex_locator::point);
+      return locator;
     }
 
     [[nodiscard]] inline auto resolve_vertex(Delaunay const&   triangulation,
@@ -276,14 +401,48 @@ namespace cdt::ergodic_moves
       return std::nullopt;
     }
 
-    [[nodiscard]] inline auto resolve_cell(Delaunay const&    triangulation,
-                                           Cell_points const& points)
+    /// @brief Resolve a locator without point location where possible.
+    /// @details While @p journal holds the current vertex id table, a
+    /// locator whose id still names its handle at the recorded point is the
+    /// located vertex, found with one table lookup. Without a current table,
+    /// e.g. on a copied triangulation, a handle owned by @p triangulation
+    /// that still carries the recorded id and point is accepted instead. Both
+    /// tell apart coincident vertices, which point location cannot; the
+    /// point is located only when neither applies.
+    [[nodiscard]] inline auto resolve_vertex(
+        Delaunay const& triangulation, UndoJournal const& journal,
+        Vertex_locator const& locator) -> std::optional<Vertex_handle>
+    {
+      if (locator.vertex != nullptr)
+      {
+        if (auto const* vertex_ids = journal.current_vertex_ids())
+        {
+          if (vertex_ids->find(locator.id) == locator.vertex &&
+              locator.vertex->point() == locator.point)
+          {
+            return locator.vertex;
+          }
+        }
+        else if (triangulation.tds().is_vertex(locator.vertex) &&
+                 locator.vertex->id() == locator.id &&
+                 locator.vertex->point() == locator.point)
+        {
+          return locator.vertex;
+        }
+      }
+      return resolve_vertex(triangulation, locator.point);
+    }
+
+    [[nodiscard]] inline auto resolve_cell(Delaunay const&     triangulation,
+                                           UndoJournal const&  journal,
+                                           Cell_locator const& locator)
         -> std::optional<Cell_handle>
     {
       std::array<Vertex_handle, 4> vertices;
-      for (auto index = std::size_t{}; index < points.size(); ++index)
+      for (auto index = std::size_t{}; index < locator.size(); ++index)
       {
-        auto const vertex = resolve_vertex(triangulation, points[index]);
+        auto const vertex =
+            resolve_vertex(triangulation, journal, locator[index]);
         if (!vertex) { return std::nullopt; }
         vertices[index] = *vertex;
       }
@@ -297,12 +456,13 @@ namespace cdt::ergodic_moves
       return std::nullopt;
     }
 
-    [[nodiscard]] inline auto resolve_edge(Delaunay const&    triangulation,
-                                           Edge_points const& points)
+    [[nodiscard]] inline auto resolve_edge(Delaunay const&     triangulation,
+                                           UndoJournal const&  journal,
+                                           Edge_locator const& locator)
         -> std::optional<Edge_handle>
     {
-      auto const first  = resolve_vertex(triangulation, points[0]);
-      auto const second = resolve_vertex(triangulation, points[1]);
+      auto const first  = resolve_vertex(triangulation, journal, locator[0]);
+      auto const second = resolve_vertex(triangulation, journal, locator[1]);
       if (!first || !second) { return std::nullopt; }
 
       Cell_handle cell;
@@ -316,6 +476,24 @@ namespace cdt::ergodic_moves
       return std::nullopt;
     }
 
+    /// @returns The live edge named by @p key, if any.
+    [[nodiscard]] inline auto resolve_edge(
+        Delaunay const&                          triangulation,
+        foliated_triangulations::Edge_key const& key)
+        -> std::optional<Edge_handle>
+    {
+      Cell_handle cell;
+      int         first{0};
+      int         second{0};
+      if (triangulation.tds().is_edge(key[0], key[1], cell, first, second))
+      {
+        return Edge_handle{cell, first, second};
+      }
+      return std::nullopt;
+    }
+
+    /// @brief The canonical order of cells, by their sorted vertex points.
+    /// @details canonicalize() reproduces this order from rank keys.
     [[nodiscard]] inline auto cell_precedes(Cell_handle const& left,
                                             Cell_handle const& right) -> bool
     {
@@ -325,6 +503,7 @@ namespace cdt::ergodic_moves
                                                   point_less);
     }
 
+    /// @brief The canonical order of edges, by their sorted endpoint points.
     [[nodiscard]] inline auto edge_precedes(Edge_handle const& left,
                                             Edge_handle const& right) -> bool
     {
@@ -334,12 +513,6 @@ namespace cdt::ergodic_moves
                                                   point_less);
     }
 
-    inline void canonicalize(Cell_container& cells)
-    { std::ranges::sort(cells, cell_precedes); }
-
-    inline void canonicalize(Edge_container& edges)
-    { std::ranges::sort(edges, edge_precedes); }
-
     inline void canonicalize(Vertex_container& vertices)
     {
       std::ranges::sort(vertices, [](auto const& left, auto const& right) {
@@ -347,6 +520,161 @@ namespace cdt::ergodic_moves
       });
     }
 
+    /// Canonical key of a simplex: its vertices' point ranks, ascending.
+    template <std::size_t size>
+    using Rank_key = std::array<std::uint32_t, size>;
+
+    /// @brief Dense ranks of vertex points in lexicographic xyz order.
+    /// @details Points are compared only while ranking the vertices. Sorted
+    /// rank arrays then compare exactly as the sorted point arrays behind
+    /// cell_precedes() and edge_precedes(), because coincident points share a
+    /// rank and distinct points are ranked in point order.
+    class Vertex_ranks
+    {
+      std::unordered_map<Vertex_handle, std::uint32_t> m_ranks;
+      std::size_t                                      m_count{0};
+
+      explicit Vertex_ranks(Vertex_container vertices)
+      {
+        std::ranges::sort(vertices, std::less<>{});
+        auto const repeated = std::ranges::unique(vertices);
+        vertices.erase(repeated.begin(), repeated.end());
+        canonicalize(vertices);
+        m_ranks.reserve(vertices.size());
+        for (auto index = std::size_t{}; index < vertices.size(); ++index)
+        {
+          if (index > 0 && point_less(vertices[index - 1]->point(),
+                                      vertices[index]->point()))
+          {
+            ++m_count;
+          }
+          m_ranks.emplace(vertices[index], static_cast<std::uint32_t>(m_count));
+        }
+        if (!vertices.empty()) { ++m_count; }
+      }
+
+     public:
+      /// @param cells Cells whose vertices are ranked.
+      explicit Vertex_ranks(Cell_container const& cells)
+          : Vertex_ranks{[&cells] {
+            Vertex_container vertices;
+            vertices.reserve(4 * cells.size());
+            for (auto const& cell : cells)
+            {
+              for (auto index = 0; index < 4; ++index)
+              {
+                vertices.push_back(cell->vertex(index));
+              }
+            }
+            return vertices;
+          }()}
+      {}
+
+      /// @param edges Edges whose endpoints are ranked.
+      explicit Vertex_ranks(Edge_container const& edges)
+          : Vertex_ranks{[&edges] {
+            Vertex_container vertices;
+            vertices.reserve(2 * edges.size());
+            for (auto const& edge : edges)
+            {
+              vertices.push_back(edge.first->vertex(edge.second));
+              vertices.push_back(edge.first->vertex(edge.third));
+            }
+            return vertices;
+          }()}
+      {}
+
+      /// @returns The number of distinct ranks.
+      [[nodiscard]] auto size() const noexcept -> std::size_t
+      { return m_count; }
+
+      /// @pre @p cell was ranked.
+      [[nodiscard]] auto key(Cell_handle const& cell) const -> Rank_key<4>
+      {
+        Rank_key<4> key{};
+        for (auto index = 0; index < 4; ++index)
+        {
+          key[static_cast<std::size_t>(index)] =
+              m_ranks.find(cell->vertex(index))->second;
+        }
+        std::ranges::sort(key);
+        return key;
+      }
+
+      /// @pre @p edge was ranked.
+      [[nodiscard]] auto key(Edge_handle const& edge) const -> Rank_key<2>
+      {
+        auto const rank = [this](Vertex_handle const& vertex) {
+          return m_ranks.find(vertex)->second;
+        };
+        auto const first  = rank(edge.first->vertex(edge.second));
+        auto const second = rank(edge.first->vertex(edge.third));
+        return first < second ? Rank_key<2>{first, second}
+                              : Rank_key<2>{second, first};
+      }
+    };
+
+    /// @returns The canonical key of each of @p simplices, in order, and the
+    /// number of distinct ranks within those keys.
+    template <typename Container>
+    [[nodiscard]] inline auto canonical_keys(Container const& simplices)
+    {
+      Vertex_ranks const ranks{simplices};
+      using Key = decltype(ranks.key(std::declval<
+                                     typename Container::value_type const&>()));
+      std::vector<Key> keys;
+      keys.reserve(simplices.size());
+      for (auto const& simplex : simplices)
+      {
+        keys.push_back(ranks.key(simplex));
+      }
+      return std::pair{std::move(keys), ranks.size()};
+    }
+
+    /// @brief Stably sort @p elements by @p keys with an LSD radix sort.
+    /// @details Each key digit is a rank below @p radix, so every pass is one
+    /// counting sort, and sorting costs O(size * (n + radix)) integer
+    /// operations with no comparisons.
+    template <typename Element, std::size_t size>
+    inline void radix_sort(std::vector<Element>&               elements,
+                           std::vector<Rank_key<size>> const& keys,
+                           std::size_t const                  radix)
+    {
+      std::vector<std::size_t> order(elements.size());
+      std::vector<std::size_t> sorted(elements.size());
+      std::vector<std::size_t> offsets(radix + 1);
+      std::iota(order.begin(), order.end(), std::size_t{});
+      for (auto digit = size; digit-- > 0;)
+      {
+        std::ranges::fill(offsets, std::size_t{});
+        for (auto const index : order) { ++offsets[keys[index][digit] + 1]; }
+        std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+        for (auto const index : order)
+        {
+          sorted[offsets[keys[index][digit]]++] = index;
+        }
+        std::swap(order, sorted);
+      }
+      std::vector<Element> reordered;
+      reordered.reserve(elements.size());
+      for (auto const index : order) { reordered.push_back(elements[index]); }
+      elements = std::move(reordered);
+    }
+
+    /// @brief Sort @p cells into the order of cell_precedes().
+    inline void canonicalize(Cell_container& cells)
+    {
+      auto const [keys, radix] = canonical_keys(cells);
+      radix_sort(cells, keys, radix);
+    }
+
+    /// @brief Sort @p edges into the order of edge_precedes().
+    inline void canonicalize(Edge_container& edges)
+    {
+      auto const [keys, radix] = canonical_keys(edges);
+      radix_sort(edges, keys, radix);
+    }
+
     [[nodiscard]] inline auto vertex_precedes(Vertex_handle const& left,
                                               Vertex_handle const& right)
         -> bool
@@ -389,17 +717,39 @@ namespace cdt::ergodic_moves
       return candidates[index];
     }
 
+    /// @brief Select a canonical rank of @p simplices by comparing rank keys.
+    template <typename Container, std::uniform_random_bit_generator Generator>
+    [[nodiscard]] inline auto canonical_random_simplex(
+        Container const& simplices, Generator& generator)
+        -> std::optional<typename Container::value_type>
+    {
+      if (simplices.empty()) { return std::nullopt; }
+      std::uniform_int_distribution<std::size_t> distribution{
+          0, simplices.size() - 1};
+      auto const index = distribution(generator);
+      auto const keys  = canonical_keys(simplices).first;
+      std::vector<std::size_t> order(simplices.size());
+      std::iota(order.begin(), order.end(), std::size_t{});
+      auto const nth = order.begin() + static_cast<std::ptrdiff_t>(index);
+      std::ranges::nth_element(
+          order, nth, std::less<>{},
+          [&keys](std::size_t const position) -> auto const& {
+            return keys[position];
+          });
+      return simplices[*nth];
+    }
+
     template <std::uniform_random_bit_generator Generator>
-    [[nodiscard]] inline auto canonical_random_element(Cell_container& cells,
-                                                       Generator& generator)
+    [[nodiscard]] inline auto canonical_random_element(
+        Cell_container const& cells, Generator& generator)
         -> std::optional<Cell_handle>
-    { return canonical_random_element(cells, generator, cell_precedes); }
+    { return canonical_random_simplex(cells, generator); }
 
     template <std::uniform_random_bit_generator Generator>
-    [[nodiscard]] inline auto canonical_random_element(Edge_container& edges,
-                                                       Generator& generator)
+    [[nodiscard]] inline auto canonical_random_element(
+        Edge_container const& edges, Generator& generator)
         -> std::optional<Edge_handle>
-    { return canonical_random_element(edges, generator, edge_precedes); }
+    { return canonical_random_simplex(edges, generator); }
 
     template <std::uniform_random_bit_generator Generator>
     [[nodiscard]] inline auto canonical_random_element(
@@ -420,6 +770,11 @@ namespace cdt::ergodic_moves
                                                 Cell_handle const& candidate)
         -> std::expected<ApplicableTwoThreeMove, MoveError>;
 
+    [[nodiscard]] inline auto execute(Delaunay& triangulation,
+                                      UndoJournal& journal,
+                                      ApplicableTwoThreeMove const& move)
+        -> Execution;
+
     [[nodiscard]] inline auto execute(Delaunay& triangulation,
                                       ApplicableTwoThreeMove const& move)
         -> Execution;
@@ -432,6 +787,11 @@ namespace cdt::ergodic_moves
                                                 Edge_handle const& candidate)
         -> std::expected<ApplicableThreeTwoMove, MoveError>;
 
+    [[nodiscard]] inline auto execute(Delaunay& triangulation,
+                                      UndoJournal& journal,
+                                      ApplicableThreeTwoMove const& move)
+        -> Execution;
+
     [[nodiscard]] inline auto execute(Delaunay& triangulation,
                                       ApplicableThreeTwoMove const& move)
         -> Execution;
@@ -443,6 +803,13 @@ namespace cdt::ergodic_moves
                                               Cell_handle const& candidate)
         -> std::expected<ApplicableTwoSixMove, MoveError>;
 
+    template <typename Post_mutation_validator>
+      requires std::predicate<Post_mutation_validator&, Delaunay const&>
+    [[nodiscard]] inline auto execute(
+        Delaunay& triangulation, UndoJournal& journal,
+        ApplicableTwoSixMove const& move,
+        Post_mutation_validator     post_mutation_validator) -> Execution;
+
     template <typename Post_mutation_validator>
       requires std::predicate<Post_mutation_validator&, Delaunay const&>
     [[nodiscard]] inline auto execute(
@@ -453,10 +820,23 @@ namespace cdt::ergodic_moves
                                             Vertex_handle const& candidate)
         -> bool;
 
+    template <std::uniform_random_bit_generator Generator>
+    [[nodiscard]] inline auto shuffled_incident_edges(
+        Delaunay const& triangulation, Vertex_handle const& vertex,
+        Generator& generator) -> Edge_container;
+
     [[nodiscard]] inline auto prepare_six_two(Delaunay const& triangulation,
                                               Vertex_handle const& candidate)
         -> std::expected<ApplicableSixTwoMove, MoveError>;
 
+    template <std::uniform_random_bit_generator Generator,
+              typename Post_mutation_validator>
+      requires std::predicate<Post_mutation_validator&, Delaunay const&>
+    [[nodiscard]] inline auto execute(
+        Delaunay& triangulation, UndoJournal& journal,
+        ApplicableSixTwoMove const& move, Generator& generator,
+        Post_mutation_validator post_mutation_validator) -> Execution;
+
     template <std::uniform_random_bit_generator Generator,
               typename Post_mutation_validator>
       requires std::predicate<Post_mutation_validator&, Delaunay const&>
@@ -488,6 +868,13 @@ namespace cdt::ergodic_moves
         Vertex_handle const& top, Vertex_handle const& bottom)
         -> std::expected<ApplicableFourFourMove, MoveError>;
 
+    template <typename Post_mutation_validator>
+      requires std::predicate<Post_mutation_validator&, Delaunay const&>
+    [[nodiscard]] inline auto execute(
+        Delaunay& triangulation, UndoJournal& journal,
+        ApplicableFourFourMove const& move,
+        Post_mutation_validator       post_mutation_validator) -> Execution;
+
     template <typename Post_mutation_validator>
       requires std::predicate<Post_mutation_validator&, Delaunay const&>
     [[nodiscard]] inline auto execute(
@@ -508,12 +895,271 @@ namespace cdt::ergodic_moves
     [[nodiscard]] inline auto get_vertices(Cell_container const& cells)
         -> Vertex_container;
 
+    [[nodiscard]] inline auto moved_geometry(Geometry_3 const& before,
+                                             move_tracker::MoveType move)
+        -> std::optional<Geometry_3>;
+
     [[nodiscard]] inline auto check_move(Manifold const&               before,
                                          Manifold const&               after,
                                          move_tracker::MoveType const& move)
         -> bool;
+
+    [[nodiscard]] inline auto check_move(
+        Manifold::Transaction const& transaction,
+        move_tracker::MoveType const& move,
+        Validation validation = foliated_triangulations::DEFAULT_VALIDATION)
+        -> bool;
   }  // namespace detail
 
+  /// @brief A proposal site whose applicability has been proven, awaiting
+  /// execution.
+  /// @details Separates proposing a move from building it, so the cost of a
+  /// proposal that will be rejected anyway can be avoided. The value names
+  /// the site by vertex locators only and is applied to, or skipped on, the
+  /// unmodified triangulation it was prepared against.
+  class PreparedMove
+  {
+   public:
+    using Applicable =
+        std::variant<detail::ApplicableTwoThreeMove,
+                     detail::ApplicableThreeTwoMove,
+                     detail::ApplicableTwoSixMove, detail::ApplicableSixTwoMove,
+                     detail::ApplicableFourFourMove>;
+
+    explicit PreparedMove(Applicable applicable) noexcept
+        : m_applicable{std::move(applicable)}
+    {}
+
+    /// @returns The type of the prepared move.
+    [[nodiscard]] auto move() const noexcept -> move_tracker::MoveType
+    {
+      using enum move_tracker::MoveType;
+      static constexpr std::array moves{TWO_THREE, THREE_TWO, TWO_SIX,
+                                        SIX_TWO, FOUR_FOUR};
+      return moves[m_applicable.index()];
+    }
+
+    /// @brief Predict the geometry of applying the move, without mutating.
+    /// @details A prepared (2,6) move always executes. A prepared (6,2) move
+    /// executes if one of the vertex's timelike edges can be flipped, which is
+    /// decided by the same degree and existing-facet test the triangulation
+    /// data structure applies. The (2,3) and (3,2) moves are geometric flips
+    /// that CGAL may still refuse, and the (4,4) move is always accepted, so
+    /// neither is predicted.
+    /// @param triangulation The triangulation the move was prepared against.
+    /// @param journal Journal the move would be applied through.
+    /// @param current Geometry of @p triangulation.
+    /// @returns The geometry after a move certain to succeed on a correct
+    /// manifold, or nullopt if only executing the move can tell.
+    [[nodiscard]] auto dry_run(Delaunay const&    triangulation,
+                               UndoJournal const& journal,
+                               Geometry_3 const&  current) const
+        -> std::optional<Geometry_3>
+    {
+      if (std::holds_alternative<detail::ApplicableTwoSixMove>(m_applicable))
+      {
+        return detail::moved_geometry(current, move());
+      }
+      auto const* six_two =
+          std::get_if<detail::ApplicableSixTwoMove>(&m_applicable);
+      if (six_two == nullptr) { return std::nullopt; }
+      auto const vertex =
+          detail::resolve_vertex(triangulation, journal, six_two->vertex());
+      if (!vertex) { return std::nullopt; }
+      Edge_container incident_edges;
+      triangulation.finite_incident_edges(*vertex,
+                                          std::back_inserter(incident_edges));
+      for (auto const& edge : incident_edges)
+      {
+        if (edge.first->vertex(edge.second)->info() ==
+            edge.first->vertex(edge.third)->info())
+        {
+          continue;
+        }
+        auto const ring = detail::UndoJournal::edge_ring(triangulation, edge);
+        Cell_handle cell;
+        int         i{0};
+        int         j{0};
+        int         k{0};
+        if (ring && !triangulation.tds().is_facet((*ring)[0], (*ring)[1],
+                                                  (*ring)[2], cell, i, j, k))
+        {
+          return detail::moved_geometry(current, move());
+        }
+      }
+      return std::nullopt;
+    }
+
+    /// @brief Execute the move inside @p transaction.
+    /// @tparam Generator Uniform random bit generator type.
+    /// @param transaction Transaction the move was prepared in, unmodified
+    /// since.
+    /// @param generator Generator ordering (6,2) incident-edge flip paths.
+    /// @return Nothing, or a structured reason execution failed.
+    template <std::uniform_random_bit_generator Generator>
+    [[nodiscard]] auto apply(Manifold::Transaction& transaction,
+                             Generator& generator) const -> MoveApplication
+    {
+      auto& triangulation = transaction.triangulation();
+      auto& journal       = transaction.journal();
+      return std::visit(
+          [&](auto const& applicable) -> MoveApplication {
+            using Move = std::remove_cvref_t<decltype(applicable)>;
+            if constexpr (std::same_as<Move, detail::ApplicableSixTwoMove>)
+            {
+              return detail::execute(triangulation, journal, applicable,
+                                     generator, detail::accept_post_mutation);
+            }
+            else if constexpr (std::same_as<Move,
+                                            detail::ApplicableTwoSixMove> ||
+                               std::same_as<Move,
+                                            detail::ApplicableFourFourMove>)
+            {
+              return detail::execute(triangulation, journal, applicable,
+                                     detail::accept_post_mutation);
+            }
+            else
+            {
+              return detail::execute(triangulation, journal, applicable);
+            }
+          },
+          m_applicable);
+    }
+
+    /// @brief Consume the random draws apply() would, without executing.
+    /// @details Only (6,2) execution draws, to order its flip paths, so a
+    /// skipped move leaves @p generator where an applied one would.
+    /// @tparam Generator Uniform random bit generator type.
+    /// @param triangulation The triangulation the move was prepared against.
+    /// @param journal Journal the move would be applied through.
+    /// @param generator Generator to advance.
+    template <std::uniform_random_bit_generator Generator>
+    void skip(Delaunay const& triangulation, UndoJournal const& journal,
+              Generator& generator) const
+    {
+      auto const* six_two =
+          std::get_if<detail::ApplicableSixTwoMove>(&m_applicable);
+      if (six_two == nullptr) { return; }
+      if (auto const vertex = detail::resolve_vertex(triangulation, journal,
+                                                     six_two->vertex()))
+      {
+        static_cast<void>(detail::shuffled_incident_edges(triangulation,
+                                                          *vertex, generator));
+      }
+    }
+
+   private:
+    Applicable m_applicable;
+  };
+
+  /// @brief Draw and prepare one proposal site inside a manifold transaction.
+  /// @details The site is read by rank from the move's ranked proposal
+  /// domain, and a site whose cached star cannot host the move is rejected by
+  /// table lookup with the error preparing it would report. Nothing is
+  /// mutated, so the caller may inspect PreparedMove::dry_run() before
+  /// choosing to apply or skip the move.
+  /// @tparam Generator Uniform random bit generator type.
+  /// @param transaction Open transaction on the manifold, with no mutation
+  /// awaiting staging.
+  /// @param move Move type to propose.
+  /// @param generator Caller-owned generator advanced by site sampling.
+  /// @return The prepared move, or a structured reason the site was rejected.
+  template <std::uniform_random_bit_generator Generator>
+  [[nodiscard]] inline auto prepare_move(Manifold::Transaction& transaction,
+                                         move_tracker::MoveType const move,
+                                         Generator& generator)
+      -> std::expected<PreparedMove, MoveError>
+  {
+    using enum move_tracker::MoveType;
+    auto const& foliation     = transaction.foliation();
+    auto const& triangulation = transaction.triangulation();
+    auto const  prepared      = [](auto const& applicable)
+        -> std::expected<PreparedMove, MoveError> {
+      if (!applicable) { return std::unexpected{applicable.error()}; }
+      return PreparedMove{*applicable};
+    };
+    auto const edge = [&triangulation](auto const& key) {
+      return detail::resolve_edge(triangulation, key);
+    };
+    switch (move)
+    {
+      case TWO_THREE:
+      {
+        auto const site =
+            detail::random_element(foliation.two_two_domain(), generator);
+        if (!site)
+        {
+          return detail::move_error(MoveFailure::NO_CANDIDATE, move);
+        }
+        return prepared(detail::prepare_two_three(triangulation, *site));
+      }
+      case THREE_TWO:
+      {
+        auto const site =
+            detail::random_element(foliation.timelike_edge_domain(), generator);
+        if (auto const star = site.and_then([&foliation](auto const& key) {
+              return foliation.edge_star(key);
+            });
+            star && !detail::is_32_star(*star))
+        {
+          return detail::move_error(MoveFailure::CAUSAL_INVALIDITY, move);
+        }
+        auto const candidate = site.and_then(edge);
+        if (!candidate)
+        {
+          return detail::move_error(MoveFailure::NO_CANDIDATE, move);
+        }
+        return prepared(detail::prepare_three_two(triangulation, *candidate));
+      }
+      case TWO_SIX:
+      {
+        auto const site =
+            detail::random_element(foliation.one_three_domain(), generator);
+        if (!site)
+        {
+          return detail::move_error(MoveFailure::NO_CANDIDATE, move);
+        }
+        return prepared(detail::prepare_two_six(triangulation, *site));
+      }
+      case SIX_TWO:
+      {
+        auto const site =
+            detail::random_element(foliation.vertex_domain(), generator);
+        if (auto const star = site.and_then([&foliation](auto const& vertex) {
+              return foliation.vertex_star(vertex);
+            });
+            star && !detail::is_62_star(*star))
+        {
+          return detail::move_error(MoveFailure::CAUSAL_INVALIDITY, move);
+        }
+        if (!site)
+        {
+          return detail::move_error(MoveFailure::NO_CANDIDATE, move);
+        }
+        return prepared(detail::prepare_six_two(triangulation, *site));
+      }
+      case FOUR_FOUR:
+      {
+        auto const site = detail::random_element(
+            foliation.spacelike_edge_domain(), generator);
+        if (auto const star = site.and_then([&foliation](auto const& key) {
+              return foliation.edge_star(key);
+            });
+            star && !detail::is_44_star(*star))
+        {
+          return detail::move_error(MoveFailure::CAUSAL_INVALIDITY, move);
+        }
+        auto const candidate = site.and_then(edge);
+        if (!candidate)
+        {
+          return detail::move_error(MoveFailure::NO_CANDIDATE, move);
+        }
+        return prepared(detail::prepare_four_four(triangulation, *candidate));
+      }
+    }
+    return detail::move_error(MoveFailure::UNKNOWN_MOVE, move);
+  }
+
   /// @brief Perform a null move
   ///
   /// @param t_manifold The simplicial manifold
@@ -576,8 +1222,8 @@ namespace cdt::ergodic_moves
                                      : second_time - first_time;
       if (time_difference != 1) { continue; }
 
-      return ApplicableTwoThreeMove{canonical_cell_points(candidate),
-                                    candidate->vertex(i)->point()};
+      return ApplicableTwoThreeMove{canonical_cell_locator(candidate),
+                                    make_locator(candidate->vertex(i))};
     }
 
     return move_error(MoveFailure::CAUSAL_INVALIDITY, TWO_THREE);
@@ -587,14 +1233,17 @@ namespace cdt::ergodic_moves
   /// @details Only point-to-handle resolution is repeated. CDT applicability is
   /// carried by the input type; CGAL remains responsible for its checked
   /// geometric flip. A successful flip invalidates affected cell handles, none
-  /// of which are stored in the applicable value.
-  [[nodiscard]] inline auto detail::execute(Delaunay& triangulation,
+  /// of which are stored in the applicable value. The flip is recorded in
+  /// @p journal so an in-place caller can roll it back.
+  [[nodiscard]] inline auto detail::execute(Delaunay&    triangulation,
+                                            UndoJournal& journal,
                                             ApplicableTwoThreeMove const& move)
       -> Execution
   {
     using enum move_tracker::MoveType;
-    auto const cell     = resolve_cell(triangulation, move.m_cell);
-    auto const opposite = resolve_vertex(triangulation, move.m_opposite);
+    auto const cell     = resolve_cell(triangulation, journal, move.m_cell);
+    auto const opposite =
+        resolve_vertex(triangulation, journal, move.m_opposite);
     if (!cell || !opposite)
     {
       return move_error(MoveFailure::STALE_CANDIDATE, TWO_THREE);
@@ -613,13 +1262,22 @@ namespace cdt::ergodic_moves
     {
       return move_error(MoveFailure::STALE_CANDIDATE, TWO_THREE);
     }
-    if (!triangulation.flip(*cell, opposite_index))
+    if (!journal.flip(triangulation, *cell, opposite_index))
     {
       return move_error(MoveFailure::EXECUTION_FAILURE, TWO_THREE);
     }
     return {};
   }
 
+  /// @brief Consume a prepared (2,3) value without retaining its undo record.
+  [[nodiscard]] inline auto detail::execute(Delaunay& triangulation,
+                                            ApplicableTwoThreeMove const& move)
+      -> Execution
+  {
+    UndoJournal journal;
+    return execute(triangulation, journal, move);
+  }
+
   /// @brief Compatibility seam that prepares and immediately executes (2,3).
   [[nodiscard]] inline auto detail::try_23_move(Delaunay& triangulation,
                                                 Cell_handle const& to_be_moved)
@@ -684,6 +1342,37 @@ namespace cdt::ergodic_moves
     return std::unexpected{last_error};
   }
 
+  namespace detail
+  {
+    /// @brief Apply (2,3) in place to a sampled (2,2) cell.
+    [[nodiscard]] inline auto apply_23_move(
+        Delaunay& triangulation, UndoJournal& journal,
+        std::optional<Cell_handle> const& candidate) -> Execution
+    {
+      if (!candidate)
+      {
+        return move_error(MoveFailure::NO_CANDIDATE,
+                          move_tracker::MoveType::TWO_THREE);
+      }
+      auto const prepared = prepare_two_three(triangulation, *candidate);
+      if (!prepared) { return std::unexpected{prepared.error()}; }
+      return execute(triangulation, journal, *prepared);
+    }
+
+    /// @brief Sample one (2,2) cell and apply (2,3) to it in place.
+    template <std::uniform_random_bit_generator Generator>
+    [[nodiscard]] inline auto apply_23_move(Delaunay&    triangulation,
+                                            UndoJournal& journal,
+                                            Generator&   generator) -> Execution
+    {
+      auto two_two = foliated_triangulations::filter_cells<3>(
+          foliated_triangulations::collect_cells<3>(triangulation),
+          CellType::TWO_TWO);
+      return apply_23_move(triangulation, journal,
+                           canonical_random_element(two_two, generator));
+    }
+  }  // namespace detail
+
   /// @brief Propose one (2,3) site for Metropolis-Hastings.
   /// @details Unlike do_23_move(), this samples exactly one of the N3(2,2)
   /// cells. An inapplicable selected cell is a rejected proposal rather than a
@@ -696,23 +1385,37 @@ namespace cdt::ergodic_moves
   [[nodiscard]] inline auto propose_23_move(Manifold const& t_manifold,
                                             Generator& generator) -> Expected
   {
-    auto triangulation = t_manifold.delaunay_snapshot();
-    auto two_two       = foliated_triangulations::filter_cells<3>(
-        foliated_triangulations::collect_cells<3>(triangulation),
-        CellType::TWO_TWO);
-    auto const candidate = detail::canonical_random_element(two_two, generator);
-    if (!candidate)
-    {
-      return detail::move_error(MoveFailure::NO_CANDIDATE,
-                                move_tracker::MoveType::TWO_THREE);
-    }
-    auto const prepared = detail::prepare_two_three(triangulation, *candidate);
-    if (!prepared) { return std::unexpected{prepared.error()}; }
-    auto const executed = detail::execute(triangulation, *prepared);
-    if (!executed) { return std::unexpected{executed.error()}; }
+    auto                triangulation = t_manifold.delaunay_snapshot();
+    detail::UndoJournal journal;
+    auto const          applied =
+        detail::apply_23_move(triangulation, journal, generator);
+    if (!applied) { return std::unexpected{applied.error()}; }
     return detail::make_manifold(std::move(triangulation), t_manifold);
   }
 
+  /// @brief Apply one proposed (2,3) site inside a manifold transaction.
+  /// @details The site is read by one random rank from the manifold's ranked
+  /// (2,2) domain rather than by collecting and ranking the cells, yet it is
+  /// the site the value overload selects from the same generator state. The
+  /// mutation is journaled; the caller stages, then commits or rolls back
+  /// @p transaction.
+  /// @tparam Generator Uniform random bit generator type.
+  /// @param transaction Open transaction on the manifold to mutate, with no
+  /// mutation awaiting staging.
+  /// @param generator Caller-owned generator advanced by site sampling.
+  /// @return Nothing, or a structured reason the site was rejected.
+  template <std::uniform_random_bit_generator Generator>
+  [[nodiscard]] inline auto propose_23_move(Manifold::Transaction& transaction,
+                                            Generator& generator)
+      -> MoveApplication
+  {
+    return prepare_move(transaction, move_tracker::MoveType::TWO_THREE,
+                        generator)
+        .and_then([&transaction, &generator](PreparedMove const& prepared) {
+          return prepared.apply(transaction, generator);
+        });
+  }
+
   namespace detail
   {
     /// @brief Check for the causal cavity inverse to a (2,3) move.
@@ -720,9 +1423,12 @@ namespace cdt::ergodic_moves
                                             Edge_handle const& candidate)
         -> bool
     {
-      auto const incident_cells =
-          finite_incident_cells(triangulation, candidate);
-      if (!incident_cells || incident_cells->size() != 3) { return false; }
+      if (!is_well_formed_edge(candidate) || triangulation.dimension() != 3 ||
+          !triangulation.tds().is_edge(candidate.first, candidate.second,
+                                       candidate.third))
+      {
+        return false;
+      }
 
       auto const first_time = static_cast<long long>(
           candidate.first->vertex(candidate.second)->info());
@@ -733,23 +1439,9 @@ namespace cdt::ergodic_moves
                                      : second_time - first_time;
       if (time_difference != 1) { return false; }
 
-      if (!std::ranges::all_of(*incident_cells, [](auto const& cell) {
-            return foliated_triangulations::is_cell_type_correct<3>(cell);
-          }))
-      {
-        return false;
-      }
-
-      auto const cell_type_count = [&](CellType const type) {
-        return std::ranges::count_if(*incident_cells, [&](auto const& cell) {
-          return foliated_triangulations::expected_cell_type<3>(cell) == type;
-        });
-      };
-      auto const incident_31 = cell_type_count(CellType::THREE_ONE);
-      auto const incident_22 = cell_type_count(CellType::TWO_TWO);
-      auto const incident_13 = cell_type_count(CellType::ONE_THREE);
-      return incident_22 == 2 && ((incident_31 == 1 && incident_13 == 0) ||
-                                  (incident_31 == 0 && incident_13 == 1));
+      // Circulating the star avoids collecting the incident cells.
+      return is_32_star(
+          foliated_triangulations::make_edge_star(triangulation, candidate));
     }
   }  // namespace detail
 
@@ -772,24 +1464,34 @@ namespace cdt::ergodic_moves
     {
       return move_error(MoveFailure::CAUSAL_INVALIDITY, THREE_TWO);
     }
-    return ApplicableThreeTwoMove{canonical_edge_points(candidate)};
+    return ApplicableThreeTwoMove{canonical_edge_locator(candidate)};
   }
 
   /// @brief Consume a prepared (3,2) value at the checked CGAL flip boundary.
-  [[nodiscard]] inline auto detail::execute(Delaunay& triangulation,
+  [[nodiscard]] inline auto detail::execute(Delaunay&    triangulation,
+                                            UndoJournal& journal,
                                             ApplicableThreeTwoMove const& move)
       -> Execution
   {
     using enum move_tracker::MoveType;
-    auto const edge = resolve_edge(triangulation, move.m_edge);
+    auto const edge = resolve_edge(triangulation, journal, move.m_edge);
     if (!edge) { return move_error(MoveFailure::STALE_CANDIDATE, THREE_TWO); }
-    if (!triangulation.flip(edge->first, edge->second, edge->third))
+    if (!journal.flip(triangulation, edge->first, edge->second, edge->third))
     {
       return move_error(MoveFailure::EXECUTION_FAILURE, THREE_TWO);
     }
     return {};
   }
 
+  /// @brief Consume a prepared (3,2) value without retaining its undo record.
+  [[nodiscard]] inline auto detail::execute(Delaunay& triangulation,
+                                            ApplicableThreeTwoMove const& move)
+      -> Execution
+  {
+    UndoJournal journal;
+    return execute(triangulation, journal, move);
+  }
+
   /// @brief Compatibility seam that prepares and immediately executes (3,2).
   [[nodiscard]] inline auto detail::try_32_move(Delaunay& triangulation,
                                                 Edge_handle const& to_be_moved)
@@ -850,6 +1552,38 @@ namespace cdt::ergodic_moves
     return std::unexpected{last_error};
   }  // do_32_move()
 
+  namespace detail
+  {
+    /// @brief Apply (3,2) in place to a sampled timelike edge.
+    [[nodiscard]] inline auto apply_32_move(
+        Delaunay& triangulation, UndoJournal& journal,
+        std::optional<Edge_handle> const& candidate) -> Execution
+    {
+      if (!candidate)
+      {
+        return move_error(MoveFailure::NO_CANDIDATE,
+                          move_tracker::MoveType::THREE_TWO);
+      }
+      auto const prepared = prepare_three_two(triangulation, *candidate);
+      if (!prepared) { return std::unexpected{prepared.error()}; }
+      return execute(triangulation, journal, *prepared);
+    }
+
+    /// @brief Sample one timelike edge and apply (3,2) to it in place.
+    template <std::uniform_random_bit_generator Generator>
+    [[nodiscard]] inline auto apply_32_move(Delaunay&    triangulation,
+                                            UndoJournal& journal,
+                                            Generator&   generator) -> Execution
+    {
+      auto timelike_edges = foliated_triangulations::filter_edges<3>(
+          foliated_triangulations::collect_edges<3>(triangulation),
+          EdgeType::TIMELIKE);
+      return apply_32_move(
+          triangulation, journal,
+          canonical_random_element(timelike_edges, generator));
+    }
+  }  // namespace detail
+
   /// @brief Propose one (3,2) site for Metropolis-Hastings.
   /// @details The raw proposal domain is the set of timelike edges. Selecting
   /// a nonflippable edge produces a self-transition.
@@ -861,24 +1595,35 @@ namespace cdt::ergodic_moves
   [[nodiscard]] inline auto propose_32_move(Manifold const& t_manifold,
                                             Generator& generator) -> Expected
   {
-    auto triangulation  = t_manifold.delaunay_snapshot();
-    auto timelike_edges = foliated_triangulations::filter_edges<3>(
-        foliated_triangulations::collect_edges<3>(triangulation),
-        EdgeType::TIMELIKE);
-    auto const candidate =
-        detail::canonical_random_element(timelike_edges, generator);
-    if (!candidate)
-    {
-      return detail::move_error(MoveFailure::NO_CANDIDATE,
-                                move_tracker::MoveType::THREE_TWO);
-    }
-    auto const prepared = detail::prepare_three_two(triangulation, *candidate);
-    if (!prepared) { return std::unexpected{prepared.error()}; }
-    auto const executed = detail::execute(triangulation, *prepared);
-    if (!executed) { return std::unexpected{executed.error()}; }
+    auto                triangulation = t_manifold.delaunay_snapshot();
+    detail::UndoJournal journal;
+    auto const          applied =
+        detail::apply_32_move(triangulation, journal, generator);
+    if (!applied) { return std::unexpected{applied.error()}; }
     return detail::make_manifold(std::move(triangulation), t_manifold);
   }
 
+  /// @brief Apply one proposed (3,2) site inside a manifold transaction.
+  /// @details The site is read by rank from the ranked timelike edges, and a
+  /// site whose cached star is not a (3,2) cavity is rejected by table lookup
+  /// with the error preparing it would report.
+  /// @tparam Generator Uniform random bit generator type.
+  /// @param transaction Open transaction on the manifold to mutate, with no
+  /// mutation awaiting staging.
+  /// @param generator Caller-owned generator advanced by site sampling.
+  /// @return Nothing, or a structured reason the site was rejected.
+  template <std::uniform_random_bit_generator Generator>
+  [[nodiscard]] inline auto propose_32_move(Manifold::Transaction& transaction,
+                                            Generator& generator)
+      -> MoveApplication
+  {
+    return prepare_move(transaction, move_tracker::MoveType::THREE_TWO,
+                        generator)
+        .and_then([&transaction, &generator](PreparedMove const& prepared) {
+          return prepared.apply(transaction, generator);
+        });
+  }
+
   /// @brief Find a (2,6) move location
   /// @details This function checks to see if a (2,6) move is possible. Starting
   /// with a (1,3) simplex, it checks neighbors for a (3,1) simplex.
@@ -954,24 +1699,28 @@ namespace cdt::ergodic_moves
       return move_error(MoveFailure::CAUSAL_INVALIDITY, TWO_SIX);
     }
 
-    return ApplicableTwoSixMove{canonical_cell_points(candidate),
-                                candidate->vertex(common_face_index)->point()};
+    return ApplicableTwoSixMove{
+        canonical_cell_locator(candidate),
+        make_locator(candidate->vertex(common_face_index))};
   }
 
   /// @brief Consume a prepared (2,6) value on an unobservable candidate.
   /// @details Local mutation is deliberate. Any postcondition failure discards
-  /// the private triangulation at the high-level value boundary.
+  /// the private triangulation at the high-level value boundary, or is rolled
+  /// back from @p journal by an in-place caller.
   template <typename Post_mutation_validator>
     requires std::predicate<Post_mutation_validator&, Delaunay const&>
   [[nodiscard]] inline auto detail::execute(
-      Delaunay& triangulation, ApplicableTwoSixMove const& move,
-      Post_mutation_validator post_mutation_validator) -> Execution
+      Delaunay& triangulation, UndoJournal& journal,
+      ApplicableTwoSixMove const& move,
+      Post_mutation_validator     post_mutation_validator) -> Execution
   {
     using enum move_tracker::MoveType;
     static constexpr auto incident_cell_count = std::size_t{6};
 
-    auto const bottom   = resolve_cell(triangulation, move.bottom_points());
-    auto const opposite = resolve_vertex(triangulation, move.opposite_point());
+    auto const bottom = resolve_cell(triangulation, journal, move.bottom());
+    auto const opposite =
+        resolve_vertex(triangulation, journal, move.opposite());
     if (!bottom || !opposite)
     {
       return move_error(MoveFailure::STALE_CANDIDATE, TWO_SIX);
@@ -998,7 +1747,7 @@ namespace cdt::ergodic_moves
     auto const v_2    = (*bottom)->vertex(second);
     auto const v_3    = (*bottom)->vertex(third);
     auto const center =
-        triangulation.tds().insert_in_facet(*bottom, common_face_index);
+        journal.insert_in_facet(triangulation, *bottom, common_face_index);
 
     Cell_container incident_cells;
     triangulation.tds().incident_cells(center,
@@ -1026,8 +1775,55 @@ namespace cdt::ergodic_moves
     return {};
   }
 
+  /// @brief Consume a prepared (2,6) value without retaining its undo record.
+  template <typename Post_mutation_validator>
+    requires std::predicate<Post_mutation_validator&, Delaunay const&>
+  [[nodiscard]] inline auto detail::execute(
+      Delaunay& triangulation, ApplicableTwoSixMove const& move,
+      Post_mutation_validator post_mutation_validator) -> Execution
+  {
+    UndoJournal journal;
+    return execute(triangulation, journal, move,
+                   std::move(post_mutation_validator));
+  }
+
   namespace detail
   {
+    /// @brief Apply (2,6) in place to a sampled (1,3) cell.
+    template <typename Post_mutation_validator>
+      requires std::predicate<Post_mutation_validator&, Delaunay const&>
+    [[nodiscard]] inline auto apply_26_move(
+        Delaunay& triangulation, UndoJournal& journal,
+        std::optional<Cell_handle> const& candidate,
+        Post_mutation_validator           post_mutation_validator) -> Execution
+    {
+      if (!candidate)
+      {
+        return move_error(MoveFailure::NO_CANDIDATE,
+                          move_tracker::MoveType::TWO_SIX);
+      }
+      auto const prepared = prepare_two_six(triangulation, *candidate);
+      if (!prepared) { return std::unexpected{prepared.error()}; }
+      return execute(triangulation, journal, *prepared,
+                     std::move(post_mutation_validator));
+    }
+
+    /// @brief Sample one (1,3) cell and apply (2,6) to it in place.
+    template <std::uniform_random_bit_generator Generator,
+              typename Post_mutation_validator>
+      requires std::predicate<Post_mutation_validator&, Delaunay const&>
+    [[nodiscard]] inline auto apply_26_move(
+        Delaunay& triangulation, UndoJournal& journal, Generator& generator,
+        Post_mutation_validator post_mutation_validator) -> Execution
+    {
+      auto one_three = foliated_triangulations::filter_cells<3>(
+          foliated_triangulations::collect_cells<3>(triangulation),
+          CellType::ONE_THREE);
+      return apply_26_move(triangulation, journal,
+                           canonical_random_element(one_three, generator),
+                           std::move(post_mutation_validator));
+    }
+
     template <std::uniform_random_bit_generator Generator,
               typename Post_mutation_validator>
       requires std::predicate<Post_mutation_validator&, Delaunay const&>
@@ -1047,7 +1843,16 @@ namespace cdt::ergodic_moves
       Post_mutation_validator post_mutation_validator) -> Expected
   {
     Delaunay triangulation{t_manifold.delaunay_snapshot()};
-    auto     one_three = foliated_triangulations::filter_cells<3>(
+    if (only_first_site)
+    {
+      UndoJournal journal;
+      auto const  applied = apply_26_move(triangulation, journal, generator,
+                                          post_mutation_validator);
+      if (!applied) { return std::unexpected{applied.error()}; }
+      return make_manifold(std::move(triangulation), t_manifold);
+    }
+
+    auto one_three = foliated_triangulations::filter_cells<3>(
         foliated_triangulations::collect_cells<3>(triangulation),
         CellType::ONE_THREE);
     if (one_three.empty())
@@ -1055,25 +1860,9 @@ namespace cdt::ergodic_moves
       return move_error(MoveFailure::NO_CANDIDATE,
                         move_tracker::MoveType::TWO_SIX);
     }
-
-    if (only_first_site)
-    {
-      auto const candidate =
-          detail::canonical_random_element(one_three, generator);
-      if (!candidate)
-      {
-        return move_error(MoveFailure::NO_CANDIDATE,
-                          move_tracker::MoveType::TWO_SIX);
-      }
-      one_three = {*candidate};
-    }
-    else
-    {
-      detail::canonicalize(one_three);
-      // Shuffle the container to pick a random sequence of (1,3) cells to
-      // try.
-      std::ranges::shuffle(one_three, generator);
-    }
+    detail::canonicalize(one_three);
+    // Shuffle the container to pick a random sequence of (1,3) cells to try.
+    std::ranges::shuffle(one_three, generator);
 
     auto last_error =
         MoveError{.category       = MoveFailure::NO_CANDIDATE,
@@ -1137,6 +1926,25 @@ namespace cdt::ergodic_moves
                                    detail::accept_post_mutation);
   }
 
+  /// @brief Apply one proposed (2,6) site inside a manifold transaction.
+  /// @details The site is read by rank from the ranked (1,3) cells.
+  /// @tparam Generator Uniform random bit generator type.
+  /// @param transaction Open transaction on the manifold to mutate, with no
+  /// mutation awaiting staging.
+  /// @param generator Caller-owned generator advanced by site sampling.
+  /// @return Nothing, or a structured reason the site was rejected.
+  template <std::uniform_random_bit_generator Generator>
+  [[nodiscard]] inline auto propose_26_move(Manifold::Transaction& transaction,
+                                            Generator& generator)
+      -> MoveApplication
+  {
+    return prepare_move(transaction, move_tracker::MoveType::TWO_SIX,
+                        generator)
+        .and_then([&transaction, &generator](PreparedMove const& prepared) {
+          return prepared.apply(transaction, generator);
+        });
+  }
+
   /// @brief Find a (6,2) move location
   /// @details This function checks to see if a (6,2) move is possible. Starting
   /// with a vertex, it checks all incident cells. There must be 6
@@ -1159,43 +1967,10 @@ namespace cdt::ergodic_moves
       return false;
     }
 
-    // Obtain all incident cells
-    Cell_container incident_cells;
-    triangulation.tds().incident_cells(candidate,
-                                       std::back_inserter(incident_cells));
-
-    // We must have 6 cells incident to the vertex to make a (6,2) move
-    if (incident_cells.size() != 6)  // NOLINT
-    {
-      return false;
-    }
-
-    // Check that none of the incident cells are infinite
-    for (auto const& cell : incident_cells)
-    {
-      if (triangulation.is_infinite(cell)) { return false; }
-    }
-
-    auto const cell_type_count = [&](CellType const type) {
-      return std::ranges::count_if(incident_cells, [&](auto const& cell) {
-        return foliated_triangulations::expected_cell_type<3>(cell) == type;
-      });
-    };
-    auto const incident_31 = cell_type_count(CellType::THREE_ONE);
-    auto const incident_22 = cell_type_count(CellType::TWO_TWO);
-    auto const incident_13 = cell_type_count(CellType::ONE_THREE);
-
-    // All cells should be causally classified and carry matching metadata.
-    if (incident_13 + incident_22 + incident_31 != 6 ||  // NOLINT
-        !std::ranges::all_of(incident_cells, [](auto const& cell) {
-          return foliated_triangulations::is_cell_type_correct<3>(cell);
-        }))
-    {
-      return false;
-    }
-
-    return incident_31 == 3 && incident_22 == 0 && incident_13 == 3;
-
+    // There must be 6 finite, correctly labelled incident cells: 3 (3,1) and
+    // 3 (1,3)
+    return is_62_star(
+        foliated_triangulations::make_vertex_star(triangulation, candidate));
   }  // find_62_moves()
 
   /// @brief Parse a raw vertex into an applicable causal (6,2) move.
@@ -1216,7 +1991,7 @@ namespace cdt::ergodic_moves
     {
       return move_error(MoveFailure::CAUSAL_INVALIDITY, SIX_TWO);
     }
-    return ApplicableSixTwoMove{candidate->point()};
+    return ApplicableSixTwoMove{make_locator(candidate)};
   }
 
   namespace detail
@@ -1232,34 +2007,50 @@ namespace cdt::ergodic_moves
 
   }  // namespace detail
 
-  /// @brief Consume a prepared (6,2) value on a private triangulation copy.
+  /// @returns The finite edges incident to @p vertex in the random order
+  /// in which (6,2) execution tries to flip them.
+  template <std::uniform_random_bit_generator Generator>
+  [[nodiscard]] inline auto detail::shuffled_incident_edges(
+      Delaunay const& triangulation, Vertex_handle const& vertex,
+      Generator& generator) -> Edge_container
+  {
+    Edge_container incident_edges;
+    triangulation.finite_incident_edges(vertex,
+                                        std::back_inserter(incident_edges));
+    canonicalize(incident_edges);
+    std::ranges::shuffle(incident_edges, generator);
+    return incident_edges;
+  }  // shuffled_incident_edges()
+
+  /// @brief Consume a prepared (6,2) value in place.
+  /// @details Both the edge flip and the vertex removal are recorded in
+  /// @p journal, so a postcondition failure can be rolled back by the caller.
   template <std::uniform_random_bit_generator Generator,
             typename Post_mutation_validator>
     requires std::predicate<Post_mutation_validator&, Delaunay const&>
   [[nodiscard]] inline auto detail::execute(
-      Delaunay const& source_triangulation, ApplicableSixTwoMove const& move,
-      Generator& generator, Post_mutation_validator post_mutation_validator)
-      -> std::expected<Delaunay, MoveError>
+      Delaunay& triangulation, UndoJournal& journal,
+      ApplicableSixTwoMove const& move, Generator& generator,
+      Post_mutation_validator post_mutation_validator) -> Execution
   {
     using enum move_tracker::MoveType;
-    Delaunay   triangulation{source_triangulation};
-    auto const copied_candidate = foliated_triangulations::find_vertex<3>(
-        triangulation, move.vertex_point());
-    if (!copied_candidate)
+    auto const resolved_candidate =
+        resolve_vertex(triangulation, journal, move.vertex());
+    if (!resolved_candidate)
     {
       return move_error(MoveFailure::STALE_CANDIDATE, SIX_TWO);
     }
 
-    auto const     candidate    = *copied_candidate;
-    auto&          tds          = triangulation.tds();
-    auto const     old_cells    = triangulation.number_of_finite_cells();
-    auto const     old_vertices = triangulation.number_of_vertices();
+    auto const candidate    = *resolved_candidate;
+    auto&      tds          = triangulation.tds();
+    auto const old_cells    = triangulation.number_of_cells();
+    auto const old_vertices = triangulation.number_of_vertices();
+#ifndef NDEBUG
+    auto const was_classified = is_fully_classified(triangulation);
+#endif
 
-    Edge_container incident_edges;
-    triangulation.finite_incident_edges(candidate,
-                                        std::back_inserter(incident_edges));
-    detail::canonicalize(incident_edges);
-    std::ranges::shuffle(incident_edges, generator);
+    auto const incident_edges =
+        shuffled_incident_edges(triangulation, candidate, generator);
 
     auto const is_timelike = [](Edge_handle const& edge) {
       auto const first_time  = edge.first->vertex(edge.second)->info();
@@ -1269,36 +2060,51 @@ namespace cdt::ergodic_moves
     auto flipped = false;
     for (auto const& edge : incident_edges)
     {
-      if (is_timelike(edge) && tds.flip(edge))
+      if (is_timelike(edge) && journal.flip_topological(triangulation, edge))
       {
         flipped = true;
         break;
       }
     }
-    if (!flipped || tds.degree(candidate) != 4 || !tds.is_valid())
+    if (!flipped || tds.degree(candidate) != 4 ||
+        !is_valid_after(triangulation, journal))
     {
       return move_error(MoveFailure::EXECUTION_FAILURE, SIX_TWO);
     }
 
-    tds.remove_from_maximal_dimension_simplex(candidate);
+    journal.remove_from_maximal_dimension_simplex(triangulation, candidate);
     if (!post_mutation_validator(static_cast<Delaunay const&>(triangulation)) ||
-        !tds.is_valid() ||
-        triangulation.number_of_finite_cells() + 4 != old_cells ||
+        !is_valid_after(triangulation, journal) ||
+        triangulation.number_of_cells() + 4 != old_cells ||
         triangulation.number_of_vertices() + 1 != old_vertices)
     {
       return move_error(MoveFailure::INVARIANT_VIOLATION, SIX_TWO);
     }
 
-    for (auto const cell : triangulation.finite_cell_handles())
+    if (!classify_touched_cells(triangulation, journal))
     {
-      auto const type = foliated_triangulations::expected_cell_type<3>(cell);
-      if (type == CellType::ACAUSAL || type == CellType::UNCLASSIFIED)
-      {
-        return move_error(MoveFailure::INVARIANT_VIOLATION, SIX_TWO);
-      }
-      cell->info() = static_cast<Int_precision>(type);
+      return move_error(MoveFailure::INVARIANT_VIOLATION, SIX_TWO);
     }
+    // A full pass must agree with the local one on a classified source.
+    assert(!was_classified || is_fully_classified(triangulation));
 
+    return {};
+  }  // execute()
+
+  /// @brief Consume a prepared (6,2) value on a private triangulation copy.
+  template <std::uniform_random_bit_generator Generator,
+            typename Post_mutation_validator>
+    requires std::predicate<Post_mutation_validator&, Delaunay const&>
+  [[nodiscard]] inline auto detail::execute(
+      Delaunay const& source_triangulation, ApplicableSixTwoMove const& move,
+      Generator& generator, Post_mutation_validator post_mutation_validator)
+      -> std::expected<Delaunay, MoveError>
+  {
+    Delaunay    triangulation{source_triangulation};
+    UndoJournal journal;
+    auto const  executed = execute(triangulation, journal, move, generator,
+                                   std::move(post_mutation_validator));
+    if (!executed) { return std::unexpected{executed.error()}; }
     return triangulation;
   }  // execute()
 
@@ -1400,6 +2206,40 @@ namespace cdt::ergodic_moves
     return std::unexpected{last_error};
   }  // do_62_move()
 
+  namespace detail
+  {
+    /// @brief Apply (6,2) in place to a sampled vertex.
+    /// @param generator Generator ordering incident-edge flip paths.
+    template <std::uniform_random_bit_generator Generator>
+    [[nodiscard]] inline auto apply_62_move(
+        Delaunay& triangulation, UndoJournal& journal,
+        std::optional<Vertex_handle> const& candidate, Generator& generator)
+        -> Execution
+    {
+      if (!candidate)
+      {
+        return move_error(MoveFailure::NO_CANDIDATE,
+                          move_tracker::MoveType::SIX_TWO);
+      }
+      auto const prepared = prepare_six_two(triangulation, *candidate);
+      if (!prepared) { return std::unexpected{prepared.error()}; }
+      return execute(triangulation, journal, *prepared, generator,
+                     accept_post_mutation);
+    }
+
+    /// @brief Sample one vertex and apply (6,2) to it in place.
+    template <std::uniform_random_bit_generator Generator>
+    [[nodiscard]] inline auto apply_62_move(Delaunay&    triangulation,
+                                            UndoJournal& journal,
+                                            Generator&   generator) -> Execution
+    {
+      auto vertices =
+          foliated_triangulations::collect_vertices<3>(triangulation);
+      auto const candidate = canonical_random_element(vertices, generator);
+      return apply_62_move(triangulation, journal, candidate, generator);
+    }
+  }  // namespace detail
+
   /// @brief Propose one vertex as a (6,2) site for Metropolis-Hastings.
   /// @tparam Generator Uniform random bit generator type.
   /// @param t_manifold Source manifold, which remains unchanged.
@@ -1410,21 +2250,34 @@ namespace cdt::ergodic_moves
   [[nodiscard]] inline auto propose_62_move(Manifold const& t_manifold,
                                             Generator& generator) -> Expected
   {
-    auto triangulation = t_manifold.delaunay_snapshot();
-    auto vertices = foliated_triangulations::collect_vertices<3>(triangulation);
-    auto const candidate =
-        detail::canonical_random_element(vertices, generator);
-    if (!candidate)
-    {
-      return detail::move_error(MoveFailure::NO_CANDIDATE,
-                                move_tracker::MoveType::SIX_TWO);
-    }
-    auto const prepared = detail::prepare_six_two(triangulation, *candidate);
-    if (!prepared) { return std::unexpected{prepared.error()}; }
-    auto moved = detail::execute(triangulation, *prepared, generator,
-                                 detail::accept_post_mutation);
-    if (!moved) { return std::unexpected{moved.error()}; }
-    return detail::make_manifold(std::move(*moved), t_manifold);
+    auto                triangulation = t_manifold.delaunay_snapshot();
+    detail::UndoJournal journal;
+    auto const          applied =
+        detail::apply_62_move(triangulation, journal, generator);
+    if (!applied) { return std::unexpected{applied.error()}; }
+    return detail::make_manifold(std::move(triangulation), t_manifold);
+  }
+
+  /// @brief Apply one proposed (6,2) site inside a manifold transaction.
+  /// @details The site is read by rank from the ranked vertices, and a site
+  /// whose cached star is not a (6,2) cavity is rejected by table lookup with
+  /// the error preparing it would report.
+  /// @tparam Generator Uniform random bit generator type.
+  /// @param transaction Open transaction on the manifold to mutate, with no
+  /// mutation awaiting staging.
+  /// @param generator Caller-owned generator advanced by site sampling and
+  /// ordering incident-edge flip paths.
+  /// @return Nothing, or a structured reason the site was rejected.
+  template <std::uniform_random_bit_generator Generator>
+  [[nodiscard]] inline auto propose_62_move(Manifold::Transaction& transaction,
+                                            Generator& generator)
+      -> MoveApplication
+  {
+    return prepare_move(transaction, move_tracker::MoveType::SIX_TWO,
+                        generator)
+        .and_then([&transaction, &generator](PreparedMove const& prepared) {
+          return prepared.apply(transaction, generator);
+        });
   }
 
   /// @brief Find all cells incident to the edge
@@ -1452,10 +2305,14 @@ namespace cdt::ergodic_moves
       Delaunay const& triangulation, Edge_handle const& t_edge_candidate)
       -> std::optional<Cell_container>
   {
-    if (!detail::is_well_formed_edge(t_edge_candidate)) { return std::nullopt; }
-    auto incident_cells =
-        detail::incident_cells_from_edge(triangulation, t_edge_candidate);
-    if (!incident_cells || incident_cells->size() != 4) { return std::nullopt; }
+    if (!detail::is_well_formed_edge(t_edge_candidate) ||
+        triangulation.dimension() != 3 ||
+        !triangulation.tds().is_edge(t_edge_candidate.first,
+                                     t_edge_candidate.second,
+                                     t_edge_candidate.third))
+    {
+      return std::nullopt;
+    }
 
     auto const first_time =
         t_edge_candidate.first->vertex(t_edge_candidate.second)->info();
@@ -1463,18 +2320,13 @@ namespace cdt::ergodic_moves
         t_edge_candidate.first->vertex(t_edge_candidate.third)->info();
     if (first_time != second_time) { return std::nullopt; }
 
-    auto const cell_type_count = [&](CellType const type) {
-      return std::ranges::count_if(*incident_cells, [&](auto const cell) {
-        return foliated_triangulations::is_cell_type_correct<3>(cell) &&
-               foliated_triangulations::expected_cell_type<3>(cell) == type;
-      });
-    };
-    if (cell_type_count(CellType::THREE_ONE) == 2 &&
-        cell_type_count(CellType::ONE_THREE) == 2)
+    // Only a diamond's cells are collected.
+    if (!is_44_star(foliated_triangulations::make_edge_star(
+            triangulation, t_edge_candidate)))
     {
-      return incident_cells;
+      return std::nullopt;
     }
-    return std::nullopt;
+    return detail::incident_cells_from_edge(triangulation, t_edge_candidate);
   }  // find_bistellar_flip_location()
 
   /// @brief Parse a raw spacelike edge into an applicable (4,4) move.
@@ -1533,8 +2385,8 @@ namespace cdt::ergodic_moves
       return move_error(MoveFailure::CAUSAL_INVALIDITY, FOUR_FOUR);
     }
 
-    return ApplicableFourFourMove{canonical_edge_points(candidate),
-                                  top->point(), bottom->point()};
+    return ApplicableFourFourMove{canonical_edge_locator(candidate),
+                                  make_locator(top), make_locator(bottom)};
   }
 
   /// @brief Prepare the generic topological seam used by bistellar_flip().
@@ -1581,8 +2433,8 @@ namespace cdt::ergodic_moves
       return move_error(MoveFailure::INVALID_TOPOLOGY, FOUR_FOUR);
     }
 
-    return ApplicableFourFourMove{canonical_edge_points(candidate),
-                                  top->point(), bottom->point()};
+    return ApplicableFourFourMove{canonical_edge_locator(candidate),
+                                  make_locator(top), make_locator(bottom)};
   }
 
   namespace detail
@@ -1597,19 +2449,20 @@ namespace cdt::ergodic_moves
 
   }  // namespace detail
 
-  /// @brief Consume a prepared (4,4) value on a private triangulation copy.
+  /// @brief Consume a prepared (4,4) value in place.
+  /// @details Both flips are recorded in @p journal, so a failed second flip
+  /// or postcondition can be rolled back by the caller.
   template <typename Post_mutation_validator>
     requires std::predicate<Post_mutation_validator&, Delaunay const&>
   [[nodiscard]] inline auto detail::execute(
-      Delaunay const& source_triangulation, ApplicableFourFourMove const& move,
-      Post_mutation_validator post_mutation_validator)
-      -> std::expected<Delaunay, MoveError>
+      Delaunay& triangulation, UndoJournal& journal,
+      ApplicableFourFourMove const& move,
+      Post_mutation_validator       post_mutation_validator) -> Execution
   {
     using enum move_tracker::MoveType;
-    Delaunay   triangulation{source_triangulation};
-    auto const edge   = resolve_edge(triangulation, move.edge_points());
-    auto const top    = resolve_vertex(triangulation, move.top_point());
-    auto const bottom = resolve_vertex(triangulation, move.bottom_point());
+    auto const edge   = resolve_edge(triangulation, journal, move.edge());
+    auto const top    = resolve_vertex(triangulation, journal, move.top());
+    auto const bottom = resolve_vertex(triangulation, journal, move.bottom());
     if (!edge || !top || !bottom)
     {
       return move_error(MoveFailure::STALE_CANDIDATE, FOUR_FOUR);
@@ -1617,6 +2470,9 @@ namespace cdt::ergodic_moves
 
     auto const pivot_from_1         = edge->first->vertex(edge->second);
     auto const pivot_from_2         = edge->first->vertex(edge->third);
+#ifndef NDEBUG
+    auto const was_classified = is_fully_classified(triangulation);
+#endif
 
     // A 3D 4-to-4 bistellar move is the composition of CGAL's checked TDS
     // 2-to-3 facet flip and checked 3-to-2 edge flip. The TDS operations are
@@ -1638,7 +2494,8 @@ namespace cdt::ergodic_moves
     constexpr auto cell_index_sum       = 0 + 1 + 2 + 3;
     auto const     boundary_facet_index = cell_index_sum - pivot_from_1_index -
                                           pivot_from_2_index - boundary_index;
-    if (!triangulation.tds().flip(
+    if (!journal.flip_topological(
+            triangulation,
             Delaunay::Facet{boundary_facet_cell, boundary_facet_index}))
     {
       return move_error(MoveFailure::EXECUTION_FAILURE, FOUR_FOUR);
@@ -1649,24 +2506,40 @@ namespace cdt::ergodic_moves
     int         old_edge_second_index{};
     if (!triangulation.is_edge(pivot_from_1, pivot_from_2, old_edge_cell,
                                old_edge_first_index, old_edge_second_index) ||
-        !triangulation.tds().flip(Delaunay::Edge{
-            old_edge_cell, old_edge_first_index, old_edge_second_index}))
+        !journal.flip_topological(
+            triangulation, Delaunay::Edge{old_edge_cell, old_edge_first_index,
+                                          old_edge_second_index}))
     {
       return move_error(MoveFailure::EXECUTION_FAILURE, FOUR_FOUR);
     }
 
     if (!post_mutation_validator(static_cast<Delaunay const&>(triangulation)) ||
-        !triangulation.tds().is_valid())
+        !is_valid_after(triangulation, journal))
     {
       return move_error(MoveFailure::INVARIANT_VIOLATION, FOUR_FOUR);
     }
 
-    for (auto const cell : triangulation.finite_cell_handles())
-    {
-      cell->info() = static_cast<Int_precision>(
-          foliated_triangulations::expected_cell_type<3>(cell));
-    }
+    // The diamond was proven causal, so its four new cells are too; an
+    // acausal cell is left for the caller's validation to report.
+    static_cast<void>(classify_touched_cells(triangulation, journal));
+    assert(!was_classified || is_fully_classified(triangulation));
 
+    return {};
+  }  // execute()
+
+  /// @brief Consume a prepared (4,4) value on a private triangulation copy.
+  template <typename Post_mutation_validator>
+    requires std::predicate<Post_mutation_validator&, Delaunay const&>
+  [[nodiscard]] inline auto detail::execute(
+      Delaunay const& source_triangulation, ApplicableFourFourMove const& move,
+      Post_mutation_validator post_mutation_validator)
+      -> std::expected<Delaunay, MoveError>
+  {
+    Delaunay    triangulation{source_triangulation};
+    UndoJournal journal;
+    auto const  executed = execute(triangulation, journal, move,
+                                   std::move(post_mutation_validator));
+    if (!executed) { return std::unexpected{executed.error()}; }
     return triangulation;
   }  // execute()
 
@@ -1801,6 +2674,38 @@ namespace cdt::ergodic_moves
     return std::unexpected{last_error};
   }  // do_44_move()
 
+  namespace detail
+  {
+    /// @brief Apply (4,4) in place to a sampled spacelike edge.
+    [[nodiscard]] inline auto apply_44_move(
+        Delaunay& triangulation, UndoJournal& journal,
+        std::optional<Edge_handle> const& candidate) -> Execution
+    {
+      if (!candidate)
+      {
+        return move_error(MoveFailure::NO_CANDIDATE,
+                          move_tracker::MoveType::FOUR_FOUR);
+      }
+      auto const prepared = prepare_four_four(triangulation, *candidate);
+      if (!prepared) { return std::unexpected{prepared.error()}; }
+      return execute(triangulation, journal, *prepared, accept_post_mutation);
+    }
+
+    /// @brief Sample one spacelike edge and apply (4,4) to it in place.
+    template <std::uniform_random_bit_generator Generator>
+    [[nodiscard]] inline auto apply_44_move(Delaunay&    triangulation,
+                                            UndoJournal& journal,
+                                            Generator&   generator) -> Execution
+    {
+      auto spacelike_edges = foliated_triangulations::filter_edges<3>(
+          foliated_triangulations::collect_edges<3>(triangulation),
+          EdgeType::SPACELIKE);
+      return apply_44_move(
+          triangulation, journal,
+          canonical_random_element(spacelike_edges, generator));
+    }
+  }  // namespace detail
+
   /// @brief Propose one spacelike edge as a (4,4) site.
   /// @details Selecting an edge that is not the pivot of a causal four-cell
   /// complex is an explicit self-transition.
@@ -1812,28 +2717,95 @@ namespace cdt::ergodic_moves
   [[nodiscard]] inline auto propose_44_move(Manifold const& t_manifold,
                                             Generator& generator) -> Expected
   {
-    auto triangulation   = t_manifold.delaunay_snapshot();
-    auto spacelike_edges = foliated_triangulations::filter_edges<3>(
-        foliated_triangulations::collect_edges<3>(triangulation),
-        EdgeType::SPACELIKE);
-    auto const candidate =
-        detail::canonical_random_element(spacelike_edges, generator);
-    if (!candidate)
-    {
-      return detail::move_error(MoveFailure::NO_CANDIDATE,
-                                move_tracker::MoveType::FOUR_FOUR);
-    }
+    auto                triangulation = t_manifold.delaunay_snapshot();
+    detail::UndoJournal journal;
+    auto const          applied =
+        detail::apply_44_move(triangulation, journal, generator);
+    if (!applied) { return std::unexpected{applied.error()}; }
+    return detail::make_manifold(std::move(triangulation), t_manifold);
+  }
+
+  /// @brief Apply one proposed (4,4) site inside a manifold transaction.
+  /// @details The site is read by rank from the ranked spacelike edges, and a
+  /// site whose cached star is not a diamond is rejected by table lookup with
+  /// the error preparing it would report.
+  /// @tparam Generator Uniform random bit generator type.
+  /// @param transaction Open transaction on the manifold to mutate, with no
+  /// mutation awaiting staging.
+  /// @param generator Caller-owned generator advanced by site sampling.
+  /// @return Nothing, or a structured reason the site was rejected.
+  template <std::uniform_random_bit_generator Generator>
+  [[nodiscard]] inline auto propose_44_move(Manifold::Transaction& transaction,
+                                            Generator& generator)
+      -> MoveApplication
+  {
+    return prepare_move(transaction, move_tracker::MoveType::FOUR_FOUR,
+                        generator)
+        .and_then([&transaction, &generator](PreparedMove const& prepared) {
+          return prepared.apply(transaction, generator);
+        });
+  }
+
+  /// @brief Apply the tracked simplex-count delta of a move to a geometry.
+  /// @param before Geometry before the move
+  /// @param move The type of move
+  /// @return The geometry after a successful move, or nullopt for an unknown
+  /// move type
+  [[nodiscard]] inline auto detail::moved_geometry(
+      Geometry_3 const& before, move_tracker::MoveType const move)
+      -> std::optional<Geometry_3>
+  {
+    // N3, N3_31, N3_22, N3_13, N2, N1, N1_TL, N1_SL, N0
+    using Delta = std::array<Int_precision, 9>;  // NOLINT
+    auto const changed_by = [&before](Delta const&         delta,
+                                      Int_precision const sign) {
+      auto after = before;
+      after.N3 += sign * delta[0];
+      after.N3_31 += sign * delta[1];
+      after.N3_22 += sign * delta[2];
+      after.N3_13 += sign * delta[3];
+      after.N2 += sign * delta[4];
+      after.N1 += sign * delta[5];     // NOLINT
+      after.N1_TL += sign * delta[6];  // NOLINT
+      after.N1_SL += sign * delta[7];  // NOLINT
+      after.N0 += sign * delta[8];     // NOLINT
+      after.N3_31_13 = after.N3_31 + after.N3_13;
+      return after;
+    };
+    static constexpr Delta two_three{1, 0, 1, 0, 2, 1, 1, 0, 0};
+    static constexpr Delta two_six{4, 2, 0, 2, 8, 5, 2, 3, 1};  // NOLINT
 
-    auto const prepared = detail::prepare_four_four(triangulation, *candidate);
-    if (!prepared) { return std::unexpected{prepared.error()}; }
-    auto flipped =
-        detail::execute(triangulation, *prepared, detail::accept_post_mutation);
-    if (flipped)
+    switch (move)
     {
-      return detail::make_manifold(std::move(*flipped), t_manifold);
+      case move_tracker::MoveType::FOUR_FOUR: return before;
+      case move_tracker::MoveType::TWO_THREE: return changed_by(two_three, 1);
+      case move_tracker::MoveType::THREE_TWO: return changed_by(two_three, -1);
+      case move_tracker::MoveType::TWO_SIX: return changed_by(two_six, 1);
+      case move_tracker::MoveType::SIX_TWO: return changed_by(two_six, -1);
+      default: return std::nullopt;
     }
-    return std::unexpected{flipped.error()};
-  }
+  }  // moved_geometry
+
+  namespace detail
+  {
+    /// @brief Compare two geometries against the tracked delta of a move.
+    /// @param before Geometry before the move
+    /// @param after Geometry after the move
+    /// @param move The type of move
+    /// @return True if every simplex count changed by exactly the move delta
+    [[nodiscard]] inline auto has_move_delta(
+        Geometry_3 const& before, Geometry_3 const& after,
+        move_tracker::MoveType const& move) -> bool
+    {
+      auto const expected = moved_geometry(before, move);
+      return expected && after.N3 == expected->N3 &&
+             after.N3_31 == expected->N3_31 &&
+             after.N3_22 == expected->N3_22 &&
+             after.N3_13 == expected->N3_13 && after.N2 == expected->N2 &&
+             after.N1 == expected->N1 && after.N1_TL == expected->N1_TL &&
+             after.N1_SL == expected->N1_SL && after.N0 == expected->N0;
+    }  // has_move_delta
+  }  // namespace detail
 
   /// @brief Check tracked move deltas and essential CDT manifold invariants
   /// @details This verifies structural cache counts, causal foliation, cell
@@ -1848,79 +2820,383 @@ namespace cdt::ergodic_moves
       Manifold const& t_before, Manifold const& t_after,
       move_tracker::MoveType const& t_move) -> bool
   {
-    if (!t_after.is_structurally_correct() ||
-        !detail::same_configuration_value(t_after.initial_radius(),
-                                          t_before.initial_radius()) ||
-        !detail::same_configuration_value(t_after.foliation_spacing(),
-                                          t_before.foliation_spacing()))
+    return t_after.is_structurally_correct() &&
+           detail::same_configuration_value(t_after.initial_radius(),
+                                            t_before.initial_radius()) &&
+           detail::same_configuration_value(t_after.foliation_spacing(),
+                                            t_before.foliation_spacing()) &&
+           t_after.N1_TL() == t_after.geometry().N1_TL &&
+           t_after.N1_SL() == t_after.geometry().N1_SL &&
+           detail::has_move_delta(t_before.geometry(), t_after.geometry(),
+                                  t_move) &&
+           t_after.max_time() == t_before.max_time() &&
+           t_after.min_time() == t_before.min_time();
+  }  // check_move()
+
+  /// @brief Check a staged in-place move against its transaction's origin
+  /// @details Equivalent to the two-manifold overload, with the geometry and
+  /// time bounds recorded at begin_transaction() standing in for the source
+  /// manifold. Foliation parameters cannot change in place. Structural and
+  /// causal invariants are checked only around the staged footprint unless
+  /// @p t_validation asks for the whole triangulation as well.
+  /// @param t_transaction The staged transaction
+  /// @param t_move The type of move
+  /// @param t_validation Extent of the structural checks
+  /// @return True if the move correctly changed the triangulation
+  [[nodiscard]] inline auto detail::check_move(
+      Manifold::Transaction const& t_transaction,
+      move_tracker::MoveType const& t_move, Validation const t_validation)
+      -> bool
+  {
+    auto const& after = t_transaction.manifold();
+    return t_transaction.is_locally_correct() &&
+           (t_validation == Validation::LOCAL ||
+            after.is_structurally_correct()) &&
+           after.N1_TL() == after.geometry().N1_TL &&
+           after.N1_SL() == after.geometry().N1_SL &&
+           detail::has_move_delta(t_transaction.initial_geometry(),
+                                  after.geometry(), t_move) &&
+           after.max_time() == t_transaction.initial_max_time() &&
+           after.min_time() == t_transaction.initial_min_time();
+  }  // check_move()
+
+  /// @brief Sites at which each move is currently applicable.
+  /// @details Each set is the part of a move's raw proposal domain that its
+  /// preparation accepts, kept in canonical rank order. Applicability depends
+  /// only on a site's star and the cells adjacent to it, so a mutation can
+  /// change it only for sites bounding or adjacent to a footprint cell.
+  /// patch() re-prepares exactly those sites, at a cost proportional to the
+  /// footprint rather than to the triangulation. Sets are move-only because
+  /// their handles borrow from one triangulation.
+  class ApplicableSites
+  {
+    using Triangulation = foliated_triangulations::FoliatedTriangulation_3;
+    using Vertex_domain = Triangulation::Vertex_domain;
+    using Cell_domain   = Triangulation::Cell_domain;
+    using Edge_domain   = Triangulation::Edge_domain;
+    using Edge_key      = foliated_triangulations::Edge_key;
+
+    /// (2,2) cells with a causal (2,3) flip
+    Cell_domain   m_two_three;
+    /// Timelike edges with a causal (3,2) flip
+    Edge_domain   m_three_two;
+    /// (1,3) cells beneath a (3,1) cell
+    Cell_domain   m_two_six;
+    /// Vertices whose star is a causal (6,2) cavity
+    Vertex_domain m_six_two;
+    /// Spacelike edges pivoting a causal (4,4) diamond
+    Edge_domain   m_four_four;
+
+    // Most simplices are rejected by their cached stars, which also exist
+    // only for live finite simplices, before any site is prepared. A cached
+    // star therefore also proves that its simplex may be dereferenced.
+
+    [[nodiscard]] static auto is_32_site(Triangulation const& foliation,
+                                         Delaunay const&      triangulation,
+                                         Edge_key const&      key) -> bool
+    {
+      auto const star = foliation.edge_star(key);
+      if (!star || !detail::is_32_star(*star)) { return false; }
+      auto const edge = detail::resolve_edge(triangulation, key);
+      return edge && detail::prepare_three_two(triangulation, *edge);
+    }
+
+    [[nodiscard]] static auto is_62_site(Triangulation const& foliation,
+                                         Delaunay const&      triangulation,
+                                         Vertex_handle const& vertex) -> bool
+    {
+      auto const star = foliation.vertex_star(vertex);
+      return star && detail::is_62_star(*star) &&
+             detail::prepare_six_two(triangulation, vertex);
+    }
+
+    [[nodiscard]] static auto is_44_site(Triangulation const& foliation,
+                                         Delaunay const&      triangulation,
+                                         Edge_key const&      key) -> bool
+    {
+      auto const star = foliation.edge_star(key);
+      if (!star || !detail::is_44_star(*star)) { return false; }
+      auto const edge = detail::resolve_edge(triangulation, key);
+      return edge && detail::prepare_four_four(triangulation, *edge);
+    }
+
+    /// @returns The elements of @p domain satisfying @p is_site, still ranked.
+    template <typename Domain, typename Predicate>
+    [[nodiscard]] static auto select(Domain const& domain, Predicate is_site)
+        -> Domain
+    {
+      std::vector<typename Domain::value_type> sites;
+      std::ranges::copy_if(domain, std::back_inserter(sites), is_site);
+      return Domain{std::move(sites)};
+    }
+
+    /// @brief Re-rank @p site, which may have been destroyed or reused.
+    template <typename Domain>
+    static void update(Domain& domain, typename Domain::value_type const& site,
+                       bool const is_site)
+    {
+      domain.erase(site);
+      if (is_site) { domain.insert(site); }
+    }
+
+    template <typename Element>
+    static void deduplicate(std::vector<Element>& elements)
+    {
+      std::ranges::sort(elements, std::less<>{});
+      auto const duplicates = std::ranges::unique(elements);
+      elements.erase(duplicates.begin(), duplicates.end());
+    }
+
+   public:
+    ApplicableSites() noexcept = default;
+
+    /// @brief Prepare every raw proposal site once.
+    /// @param transaction Transaction on the manifold whose sites are
+    /// collected, with no mutation awaiting staging.
+    explicit ApplicableSites(Manifold::Transaction& transaction)
+    {
+      Delaunay const& triangulation = transaction.triangulation();
+      auto const&     foliation     = transaction.foliation();
+      m_two_three = select(foliation.two_two_domain(),
+                           [&triangulation](Cell_handle const& cell) {
+                             return detail::prepare_two_three(triangulation,
+                                                              cell)
+                                 .has_value();
+                           });
+      m_three_two = select(foliation.timelike_edge_domain(),
+                           [&](Edge_key const& edge) {
+                             return is_32_site(foliation, triangulation, edge);
+                           });
+      m_two_six   = select(foliation.one_three_domain(),
+                           [&triangulation](Cell_handle const& cell) {
+                             return detail::prepare_two_six(triangulation, cell)
+                                 .has_value();
+                           });
+      m_six_two   = select(foliation.vertex_domain(),
+                           [&](Vertex_handle const& vertex) {
+                             return is_62_site(foliation, triangulation,
+                                               vertex);
+                           });
+      m_four_four = select(foliation.spacelike_edge_domain(),
+                           [&](Edge_key const& edge) {
+                             return is_44_site(foliation, triangulation, edge);
+                           });
+    }
+
+    /// @param move Pachner move whose sites are counted.
+    /// @returns Number of sites at which @p move is applicable.
+    [[nodiscard]] auto size(move_tracker::MoveType const move) const noexcept
+        -> std::size_t
+    {
+      using enum move_tracker::MoveType;
+      switch (move)
+      {
+        case TWO_THREE: return m_two_three.size();
+        case THREE_TWO: return m_three_two.size();
+        case TWO_SIX: return m_two_six.size();
+        case SIX_TWO: return m_six_two.size();
+        case FOUR_FOUR: return m_four_four.size();
+      }
+      return 0;
+    }
+
+    /// @brief Re-prepare the sites a staged mutation can have changed.
+    /// @details Cells of the footprint and their live neighbours are checked
+    /// for (2,3) and (2,6); the vertices and edges bounding footprint cells,
+    /// before and after the mutation, for (6,2), (3,2), and (4,4). After a
+    /// rollback the footprint also holds the cells the rollback recreated
+    /// under new handles, so patching restores the sets of the original
+    /// manifold.
+    /// @param transaction Staged transaction that is about to be committed,
+    /// or one that has just been rolled back.
+    void patch(Manifold::Transaction& transaction)
+    {
+      Delaunay const&       triangulation = transaction.triangulation();
+      auto const&           foliation     = transaction.foliation();
+      auto const&           footprint     = transaction.staged_footprint();
+      Cell_container        cells;
+      Vertex_container      vertices;
+      std::vector<Edge_key> edges;
+      auto const            collect =
+          [&vertices, &edges](std::array<Vertex_handle, 4> const& corners) {
+            for (auto i = std::size_t{}; i < corners.size(); ++i)
+            {
+              vertices.push_back(corners[i]);
+              for (auto j = i + 1; j < corners.size(); ++j)
+              {
+                edges.push_back(foliated_triangulations::make_simplex_key<2>(
+                    {corners[i], corners[j]}));
+              }
+            }
+          };
+      for (auto const& removed : footprint.removed_vertices)
+      {
+        vertices.push_back(removed.vertex);
+      }
+      for (auto const& touched : footprint.cells)
+      {
+        cells.push_back(touched.cell);
+        collect(touched.vertices);
+      }
+      // Live cells and their neighbours are known from the footprint, so no
+      // handle is looked up in the triangulation's storage.
+      Cell_container live;
+      for (auto const& cell : footprint.live_cells())
+      {
+        collect({cell->vertex(0), cell->vertex(1), cell->vertex(2),
+                 cell->vertex(3)});
+        live.push_back(cell);
+        for (auto index = 0; index < 4; ++index)
+        {
+          live.push_back(cell->neighbor(index));
+        }
+      }
+      cells.insert(cells.end(), live.begin(), live.end());
+      deduplicate(cells);
+      deduplicate(live);
+      deduplicate(vertices);
+      deduplicate(edges);
+
+      for (auto const& cell : cells)
+      {
+        auto const is_finite =
+            std::ranges::binary_search(live, cell, std::less<>{}) &&
+            !triangulation.is_infinite(cell);
+        update(m_two_three, cell,
+               is_finite && detail::prepare_two_three(triangulation, cell));
+        update(m_two_six, cell,
+               is_finite && detail::prepare_two_six(triangulation, cell));
+      }
+      for (auto const& vertex : vertices)
+      {
+        update(m_six_two, vertex,
+               is_62_site(foliation, triangulation, vertex));
+      }
+      for (auto const& edge : edges)
+      {
+        update(m_three_two, edge, is_32_site(foliation, triangulation, edge));
+        update(m_four_four, edge, is_44_site(foliation, triangulation, edge));
+      }
+    }  // patch
+
+    /// @brief Apply @p move in place at the applicable site of rank @p rank.
+    /// @tparam Generator Uniform random bit generator type.
+    /// @param transaction Open transaction on the manifold these sites were
+    /// collected from, with no mutation awaiting staging.
+    /// @param move Pachner move to apply.
+    /// @param rank Canonical rank in [0, size(@p move)).
+    /// @param generator Generator ordering (6,2) incident-edge flip paths.
+    /// @return Nothing, or a structured reason the site was rejected.
+    template <std::uniform_random_bit_generator Generator>
+    [[nodiscard]] auto apply(Manifold::Transaction&       transaction,
+                             move_tracker::MoveType const move,
+                             std::size_t const rank, Generator& generator) const
+        -> MoveApplication
+    {
+      using enum move_tracker::MoveType;
+      auto& triangulation = transaction.triangulation();
+      auto& journal       = transaction.journal();
+      switch (move)
+      {
+        case TWO_THREE:
+          return detail::apply_23_move(triangulation, journal,
+                                       std::optional{m_two_three[rank]});
+        case THREE_TWO:
+          return detail::apply_32_move(
+              triangulation, journal,
+              detail::resolve_edge(triangulation, m_three_two[rank]));
+        case TWO_SIX:
+          return detail::apply_26_move(triangulation, journal,
+                                       std::optional{m_two_six[rank]},
+                                       detail::accept_post_mutation);
+        case SIX_TWO:
+          return detail::apply_62_move(triangulation, journal,
+                                       std::optional{m_six_two[rank]},
+                                       generator);
+        case FOUR_FOUR:
+          return detail::apply_44_move(
+              triangulation, journal,
+              detail::resolve_edge(triangulation, m_four_four[rank]));
+      }
+      return detail::move_error(MoveFailure::UNKNOWN_MOVE, move);
+    }
+
+    /// @returns True if both hold the same sites in the same rank order.
+    friend auto operator==(ApplicableSites const& left,
+                           ApplicableSites const& right) -> bool
+    {
+      return std::ranges::equal(left.m_two_three, right.m_two_three) &&
+             std::ranges::equal(left.m_three_two, right.m_three_two) &&
+             std::ranges::equal(left.m_two_six, right.m_two_six) &&
+             std::ranges::equal(left.m_six_two, right.m_six_two) &&
+             std::ranges::equal(left.m_four_four, right.m_four_four);
+    }
+  };
+
+  /// @brief Apply @p move in place at a uniformly chosen applicable site.
+  /// @details Sites are drawn without replacement by a lazily evaluated
+  /// Fisher-Yates shuffle of their ranks until one executes, so the executed
+  /// site is uniform over the sites that can execute: the distribution
+  /// do_23_move() and its siblings reach by shuffling their entire raw domain.
+  /// Each draw costs O(1) whatever the number of inapplicable raw sites. A
+  /// site that fails leaves the manifold unchanged. A committed move patches
+  /// @p sites from its footprint; a rolled-back mutation patches them from the
+  /// footprint of the mutation and its rollback, since rollback does not
+  /// restore the original cell handles. Either costs time proportional to the
+  /// footprint.
+  /// @tparam Generator Uniform random bit generator type.
+  /// @param manifold Manifold mutated in place, with no open transaction.
+  /// @param sites Applicable sites of @p manifold, kept current.
+  /// @param move Pachner move to apply.
+  /// @param generator Caller-owned generator advanced by site sampling.
+  /// @return Nothing, or the last reason a site failed. An executed move that
+  /// fails check_move() is rolled back and reported as INVARIANT_VIOLATION
+  /// without trying further sites.
+  template <std::uniform_random_bit_generator Generator>
+  [[nodiscard]] inline auto apply_applicable_move(
+      Manifold& manifold, ApplicableSites& sites,
+      move_tracker::MoveType const move, Generator& generator)
+      -> MoveApplication
+  {
+    auto last_error = MoveError{.category       = MoveFailure::NO_CANDIDATE,
+                                .requested_move = move};
+    // Ranks moved out of their position by earlier draws
+    std::unordered_map<std::size_t, std::size_t> displaced;
+    auto const rank_at = [&displaced](std::size_t const position) {
+      auto const found = displaced.find(position);
+      return found == displaced.end() ? position : found->second;
+    };
+    for (auto remaining = sites.size(move); remaining > 0; --remaining)
     {
-      return false;
-    }
+      std::uniform_int_distribution<std::size_t> distribution{0,
+                                                              remaining - 1};
+      auto const position = distribution(generator);
+      auto const rank     = rank_at(position);
+      displaced[position] = rank_at(remaining - 1);
 
-    switch (t_move)
-    {
-      case move_tracker::MoveType::FOUR_FOUR:
-        return t_after.N3() == t_before.N3() &&
-               t_after.N3_31() == t_before.N3_31() &&
-               t_after.N3_22() == t_before.N3_22() &&
-               t_after.N3_13() == t_before.N3_13() &&
-               t_after.N2() == t_before.N2() && t_after.N1() == t_before.N1() &&
-               t_after.N1_TL() == t_before.N1_TL() &&
-               t_after.N1_SL() == t_before.N1_SL() &&
-               t_after.N0() == t_before.N0() &&
-               t_after.max_time() == t_before.max_time() &&
-               t_after.min_time() == t_before.min_time();
-      case move_tracker::MoveType::TWO_THREE:
-        return t_after.N3() == t_before.N3() + 1 &&
-               t_after.N3_31() == t_before.N3_31() &&
-               t_after.N3_22() == t_before.N3_22() + 1 &&
-               t_after.N3_13() == t_before.N3_13() &&
-               t_after.N2() == t_before.N2() + 2 &&
-               t_after.N1() == t_before.N1() + 1 &&
-               t_after.N1_TL() == t_before.N1_TL() + 1 &&
-               t_after.N1_SL() == t_before.N1_SL() &&
-               t_after.N0() == t_before.N0() &&
-               t_after.max_time() == t_before.max_time() &&
-               t_after.min_time() == t_before.min_time();
-      case move_tracker::MoveType::THREE_TWO:
-        return t_after.N3() == t_before.N3() - 1 &&
-               t_after.N3_31() == t_before.N3_31() &&
-               t_after.N3_22() == t_before.N3_22() - 1 &&
-               t_after.N3_13() == t_before.N3_13() &&
-               t_after.N2() == t_before.N2() - 2 &&
-               t_after.N1() == t_before.N1() - 1 &&
-               t_after.N1_TL() == t_before.N1_TL() - 1 &&
-               t_after.N1_SL() == t_before.N1_SL() &&
-               t_after.N0() == t_before.N0() &&
-               t_after.max_time() == t_before.max_time() &&
-               t_after.min_time() == t_before.min_time();
-      case move_tracker::MoveType::TWO_SIX:
-        return t_after.N3() == t_before.N3() + 4 &&
-               t_after.N3_31() == t_before.N3_31() + 2 &&
-               t_after.N3_22() == t_before.N3_22() &&
-               t_after.N3_13() == t_before.N3_13() + 2 &&
-               t_after.N2() == t_before.N2() + 8 &&  // NOLINT
-               t_after.N1() == t_before.N1() + 5 &&  // NOLINT
-               t_after.N1_TL() == t_before.N1_TL() + 2 &&
-               t_after.N1_SL() == t_before.N1_SL() + 3 &&
-               t_after.N0() == t_before.N0() + 1 &&
-               t_after.max_time() == t_before.max_time() &&
-               t_after.min_time() == t_before.min_time();
-      case move_tracker::MoveType::SIX_TWO:
-        return t_after.N3() == t_before.N3() - 4 &&
-               t_after.N3_31() == t_before.N3_31() - 2 &&
-               t_after.N3_22() == t_before.N3_22() &&
-               t_after.N3_13() == t_before.N3_13() - 2 &&
-               t_after.N2() == t_before.N2() - 8 &&  // NOLINT
-               t_after.N1() == t_before.N1() - 5 &&  // NOLINT
-               t_after.N1_TL() == t_before.N1_TL() - 2 &&
-               t_after.N1_SL() == t_before.N1_SL() - 3 &&
-               t_after.N0() == t_before.N0() - 1 &&
-               t_after.max_time() == t_before.max_time() &&
-               t_after.min_time() == t_before.min_time();
-      default: return false;
+      auto       transaction = manifold.begin_transaction();
+      auto const applied     = sites.apply(transaction, move, rank, generator);
+      if (applied)
+      {
+        transaction.stage();
+        if (detail::check_move(transaction, move))
+        {
+          sites.patch(transaction);
+          transaction.commit();
+          return {};
+        }
+        last_error = MoveError{.category = MoveFailure::INVARIANT_VIOLATION,
+                               .requested_move = move};
+      }
+      else { last_error = applied.error(); }
+
+      auto const mutated = !transaction.journal().empty();
+      transaction.rollback();
+      if (mutated) { sites.patch(transaction); }
+      if (last_error.reason() == MoveFailure::INVARIANT_VIOLATION) { break; }
     }
-  }  // check_move()
+    return std::unexpected{last_error};
+  }  // apply_applicable_move()
 
 }  // namespace cdt::ergodic_moves
 
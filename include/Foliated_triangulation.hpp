@@ -29,6 +29,7 @@
 #include <cassert>
 #include <cmath>
 #include <concepts>
+#include <cstdint>
 #include <functional>
 #include <iterator>
 #include <limits>
@@ -41,6 +42,7 @@
 #include <span>
 #include <stdexcept>
 #include <type_traits>
+#include <unordered_map>
 #include <unordered_set>
 #include <utility>
 #include <vector>
@@ -843,10 +845,10 @@ namespace cdt::foliated_triangulations
 #endif
       return CellType::ACAUSAL;
     }
-    std::multiset<int> const timevalues{vertex_timevalues.begin(),
-                                        vertex_timevalues.end()};
-    auto                     max_vertices = timevalues.count(maxtime);
-    auto                     min_vertices = timevalues.count(mintime);
+    // Every vertex is on one of the two slices, so counting in place is
+    // enough; no ordered container is needed.
+    auto const max_vertices = std::ranges::count(vertex_timevalues, maxtime);
+    auto const min_vertices = std::ranges::count(vertex_timevalues, mintime);
 
     // 3D simplices
     if (max_vertices == 3 && min_vertices == 1) { return CellType::ONE_THREE; }
@@ -1380,6 +1382,1612 @@ namespace cdt::foliated_triangulations
     return std::move(state).into_detached_triangulation();
   }  // make_triangulation
 
+  /// @brief Dense set with constant-time insertion, erasure, and lookup.
+  /// @details Elements are stored contiguously and can be addressed by index.
+  /// Erasure moves the last element into the vacated slot, so the order
+  /// reflects the update history rather than any canonical ranking. Positions
+  /// are held behind a pointer so that moves and swaps cannot throw. Sets are
+  /// move-only because their keys usually borrow from one triangulation.
+  /// @tparam Key Hashable, equality-comparable element type
+  /// @tparam Hash Hash function object for @p Key
+  template <typename Key, typename Hash = std::hash<Key>>
+  class IndexedSet
+  {
+    using Positions = std::unordered_map<Key, std::size_t, Hash>;
+
+    std::vector<Key>           m_elements;
+    std::unique_ptr<Positions> m_positions;
+
+    [[nodiscard]] auto positions() -> Positions&
+    {
+      if (!m_positions) { m_positions = std::make_unique<Positions>(); }
+      return *m_positions;
+    }
+
+   public:
+    IndexedSet() noexcept = default;
+    ~IndexedSet()         = default;
+
+    IndexedSet(IndexedSet const&)                    = delete;
+    auto operator=(IndexedSet const&) -> IndexedSet& = delete;
+
+    /// @param other Set whose elements are transferred, leaving it empty.
+    IndexedSet(IndexedSet&& other) noexcept
+        : m_elements{std::exchange(other.m_elements, {})}
+        , m_positions{std::move(other.m_positions)}
+    {}
+
+    /// @param other Set whose elements are transferred.
+    /// @returns This set after replacement.
+    auto operator=(IndexedSet&& other) noexcept -> IndexedSet&
+    {
+      IndexedSet moved{std::move(other)};
+      swap(moved, *this);
+      return *this;
+    }
+
+    friend void swap(IndexedSet& left, IndexedSet& right) noexcept
+    {
+      using std::swap;
+      swap(left.m_elements, right.m_elements);
+      swap(left.m_positions, right.m_positions);
+    }  // swap
+
+    [[nodiscard]] auto size() const noexcept -> std::size_t
+    { return m_elements.size(); }
+
+    [[nodiscard]] auto empty() const noexcept -> bool
+    { return m_elements.empty(); }
+
+    [[nodiscard]] auto begin() const noexcept { return m_elements.begin(); }
+
+    [[nodiscard]] auto end() const noexcept { return m_elements.end(); }
+
+    /// @param index Position in [0, size()).
+    /// @returns The element currently stored at @p index.
+    [[nodiscard]] auto operator[](std::size_t const index) const noexcept
+        -> Key const&
+    { return m_elements[index]; }
+
+    [[nodiscard]] auto contains(Key const& key) const -> bool
+    { return m_positions && m_positions->contains(key); }
+
+    /// @returns True if @p key was not already present.
+    auto insert(Key const& key) -> bool
+    {
+      auto& index = positions();
+      m_elements.reserve(m_elements.size() + 1);
+      if (!index.try_emplace(key, m_elements.size()).second) { return false; }
+      m_elements.push_back(key);
+      return true;
+    }
+
+    /// @returns True if @p key was present.
+    auto erase(Key const& key) -> bool
+    {
+      if (!m_positions) { return false; }
+      auto const found = m_positions->find(key);
+      if (found == m_positions->end()) { return false; }
+      auto const position = found->second;
+      m_positions->erase(found);
+      if (position + 1 != m_elements.size())
+      {
+        m_elements[position]              = m_elements.back();
+        (*m_positions)[m_elements.back()] = position;
+      }
+      m_elements.pop_back();
+      return true;
+    }
+
+    void reserve(std::size_t const capacity)
+    {
+      m_elements.reserve(capacity);
+      positions().reserve(capacity);
+    }
+  };
+
+  /// @brief Sorted vertex handles naming a simplex independently of cells.
+  template <std::size_t size>
+  using Simplex_key = std::array<Vertex_handle_t<3>, size>;
+
+  using Edge_key  = Simplex_key<2>;
+  using Facet_key = Simplex_key<3>;
+
+  /// @brief Hash for vertex-handle simplex keys.
+  struct Simplex_key_hash
+  {
+    template <std::size_t size>
+    [[nodiscard]] auto operator()(Simplex_key<size> const& key) const noexcept
+        -> std::size_t
+    {
+      constexpr std::size_t GOLDEN_RATIO{0x9e3779b9};
+      std::size_t           seed{0};
+      for (auto const& vertex : key)
+      {
+        // Boost's hash_combine mixing step.
+        seed ^= std::hash<Vertex_handle_t<3>>{}(vertex) + GOLDEN_RATIO +
+                (seed << 6) + (seed >> 2);  // NOLINT
+      }
+      return seed;
+    }
+  };
+
+  /// @param vertices Vertices of the simplex, in any order.
+  /// @returns The canonical key for the simplex spanned by @p vertices.
+  template <std::size_t size>
+  [[nodiscard]] inline auto make_simplex_key(Simplex_key<size> vertices)
+      -> Simplex_key<size>
+  {
+    std::ranges::sort(vertices, std::less<>{});
+    return vertices;
+  }  // make_simplex_key
+
+  /// @returns The key of @p edge.
+  [[nodiscard]] inline auto make_edge_key(Edge_handle_t<3> const& edge)
+      -> Edge_key
+  {
+    return make_simplex_key<2>(
+        {edge.first->vertex(edge.second), edge.first->vertex(edge.third)});
+  }  // make_edge_key
+
+  /// @returns The key of @p facet.
+  [[nodiscard]] inline auto make_facet_key(Facet_t<3> const& facet)
+      -> Facet_key
+  {
+    auto const& [cell, index] = facet;
+    return make_simplex_key<3>({cell->vertex((index + 1) % 4),
+                                cell->vertex((index + 2) % 4),
+                                cell->vertex((index + 3) % 4)});
+  }  // make_facet_key
+
+  /// @brief Causal histogram of the cells around a vertex or an edge.
+  /// @details A cell counts toward its type only if it is finite and its
+  /// metadata matches the type its vertices give it; infinite, acausal, and
+  /// mislabelled cells count as other.
+  struct Star
+  {
+    std::uint32_t three_one{0};
+    std::uint32_t two_two{0};
+    std::uint32_t one_three{0};
+    std::uint32_t other{0};
+    /// Incident edges, including infinite ones; zero for an edge's star
+    std::uint32_t degree{0};
+
+    [[nodiscard]] auto cells() const noexcept -> std::uint32_t
+    { return three_one + two_two + one_three + other; }
+
+    /// @brief Add @p cell to the histogram.
+    void count(Delaunay_t<3> const& triangulation, Cell_handle_t<3> const& cell)
+    {
+      if (triangulation.is_infinite(cell) || !is_cell_type_correct<3>(cell))
+      {
+        ++other;
+        return;
+      }
+      switch (static_cast<CellType>(cell->info()))
+      {
+        case CellType::THREE_ONE: ++three_one; break;
+        case CellType::TWO_TWO: ++two_two; break;
+        case CellType::ONE_THREE: ++one_three; break;
+        default: ++other; break;
+      }
+    }
+
+    friend auto operator==(Star const&, Star const&) -> bool = default;
+  };
+
+  /// @brief Circulate the cells around @p edge without collecting them.
+  /// @param triangulation A three-dimensional triangulation owning @p edge
+  /// @param edge A well-formed edge
+  /// @returns The star of @p edge.
+  [[nodiscard]] inline auto make_edge_star(
+      Delaunay_t<3> const& triangulation, Edge_handle_t<3> const& edge) -> Star
+  {
+    Star star;
+    auto circulator = triangulation.incident_cells(edge, edge.first);
+    do
+    {  // NOLINT(cppcoreguidelines-avoid-do-while)
+      star.count(triangulation, circulator);
+    }
+    while (++circulator != edge.first);
+    return star;
+  }  // make_edge_star
+
+  /// @param triangulation A three-dimensional triangulation
+  /// @param vertex A vertex owned by @p triangulation
+  /// @returns The star of @p vertex, including its degree.
+  [[nodiscard]] inline auto make_vertex_star(
+      Delaunay_t<3> const& triangulation, Vertex_handle_t<3> const& vertex)
+      -> Star
+  {
+    std::vector<Cell_handle_t<3>> cells;
+    triangulation.tds().incident_cells(vertex, std::back_inserter(cells));
+    Star star{.degree = static_cast<std::uint32_t>(
+                  triangulation.degree(vertex))};
+    for (auto const& cell : cells) { star.count(triangulation, cell); }
+    return star;
+  }  // make_vertex_star
+
+  /// @brief Star histograms of live simplices, keyed by vertex or edge key.
+  /// @details Entries are held behind a pointer so that moves and swaps cannot
+  /// throw. Tables are move-only because their keys borrow from one
+  /// triangulation.
+  /// @tparam Key Vertex handle or edge key
+  /// @tparam Hash Hash function object for @p Key
+  template <typename Key, typename Hash = std::hash<Key>>
+  class StarTable
+  {
+    using Stars = std::unordered_map<Key, Star, Hash>;
+
+    std::unique_ptr<Stars> m_stars;
+
+    [[nodiscard]] auto stars() -> Stars&
+    {
+      if (!m_stars) { m_stars = std::make_unique<Stars>(); }
+      return *m_stars;
+    }
+
+   public:
+    StarTable() noexcept = default;
+    ~StarTable()         = default;
+
+    StarTable(StarTable const&)                    = delete;
+    auto operator=(StarTable const&) -> StarTable& = delete;
+
+    /// @param other Table whose entries are transferred, leaving it empty.
+    StarTable(StarTable&& other) noexcept = default;
+
+    /// @param other Table whose entries are transferred.
+    /// @returns This table after replacement.
+    auto operator=(StarTable&& other) noexcept -> StarTable& = default;
+
+    friend void swap(StarTable& left, StarTable& right) noexcept
+    {
+      using std::swap;
+      swap(left.m_stars, right.m_stars);
+    }  // swap
+
+    [[nodiscard]] auto size() const noexcept -> std::size_t
+    { return m_stars ? m_stars->size() : 0; }
+
+    /// @returns The star recorded for @p key, or nullopt.
+    [[nodiscard]] auto find(Key const& key) const -> std::optional<Star>
+    {
+      if (!m_stars) { return std::nullopt; }
+      auto const found = m_stars->find(key);
+      if (found == m_stars->end()) { return std::nullopt; }
+      return found->second;
+    }
+
+    /// @returns The star recorded for @p key, inserting an empty one.
+    [[nodiscard]] auto operator[](Key const& key) -> Star&
+    { return stars()[key]; }
+
+    void erase(Key const& key)
+    {
+      if (m_stars) { m_stars->erase(key); }
+    }
+
+    void reserve(std::size_t const capacity) { stars().reserve(capacity); }
+  };
+
+  /// @returns True if @p left precedes @p right in xyz-lexicographic order.
+  [[nodiscard]] inline auto point_precedes(Point_t<3> const& left,
+                                           Point_t<3> const& right) -> bool
+  { return CGAL::lexicographically_xyz_smaller(left, right); }
+
+  /// @brief Vertex points of a simplex in xyz-lexicographic order.
+  template <std::size_t size>
+  using Canonical_points = std::array<Point_t<3>, size>;
+
+  /// @param vertices Vertices of the simplex, in any order.
+  /// @returns The points of @p vertices in xyz-lexicographic order.
+  template <std::size_t size>
+  [[nodiscard]] inline auto canonical_points(Simplex_key<size> const& vertices)
+      -> Canonical_points<size>
+  {
+    Canonical_points<size> points;
+    std::ranges::transform(vertices, points.begin(),
+                           [](Vertex_handle_t<3> const& vertex) {
+                             return vertex->point();
+                           });
+    std::ranges::sort(points, point_precedes);
+    return points;
+  }  // canonical_points
+
+  [[nodiscard]] inline auto canonical_points(Vertex_handle_t<3> const& vertex)
+      -> Canonical_points<1>
+  { return {vertex->point()}; }
+
+  [[nodiscard]] inline auto canonical_points(Cell_handle_t<3> const& cell)
+      -> Canonical_points<4>
+  {
+    return canonical_points<4>(
+        {cell->vertex(0), cell->vertex(1), cell->vertex(2), cell->vertex(3)});
+  }
+
+  /// @brief Point of a vertex, with its persistent id to break ties.
+  struct Ranked_point
+  {
+    Point_t<3> point;
+    Simplex_id id{UNASSIGNED_SIMPLEX_ID};
+
+    [[nodiscard]] friend auto operator==(Ranked_point const& left,
+                                         Ranked_point const& right) -> bool
+    { return left.point == right.point && left.id == right.id; }
+  };
+
+  /// @returns True if @p left precedes @p right in xyz-lexicographic order,
+  /// or their points coincide and @p left has the smaller id.
+  [[nodiscard]] inline auto ranked_point_precedes(Ranked_point const& left,
+                                                  Ranked_point const& right)
+      -> bool
+  {
+    if (point_precedes(left.point, right.point)) { return true; }
+    return !point_precedes(right.point, left.point) && left.id < right.id;
+  }
+
+  /// @brief Ranked points of a simplex in ascending order.
+  template <std::size_t size>
+  using Ranked_points = std::array<Ranked_point, size>;
+
+  /// @param vertices Vertices of the simplex, in any order.
+  /// @returns The points and ids of @p vertices in ascending order.
+  template <std::size_t size>
+  [[nodiscard]] inline auto ranked_points(Simplex_key<size> const& vertices)
+      -> Ranked_points<size>
+  {
+    Ranked_points<size> points;
+    std::ranges::transform(vertices, points.begin(),
+                           [](Vertex_handle_t<3> const& vertex) {
+                             return Ranked_point{vertex->point(), vertex->id()};
+                           });
+    std::ranges::sort(points, ranked_point_precedes);
+    return points;
+  }  // ranked_points
+
+  [[nodiscard]] inline auto ranked_points(Vertex_handle_t<3> const& vertex)
+      -> Ranked_points<1>
+  { return {Ranked_point{vertex->point(), vertex->id()}}; }
+
+  [[nodiscard]] inline auto ranked_points(Cell_handle_t<3> const& cell)
+      -> Ranked_points<4>
+  {
+    return ranked_points<4>(
+        {cell->vertex(0), cell->vertex(1), cell->vertex(2), cell->vertex(3)});
+  }
+
+  /// @returns True if @p left is ranked before @p right.
+  /// @details Simplices are ranked by comparing their ranked points
+  /// lexicographically. Vertices may be geometrically coincident, so ties
+  /// between points are broken by persistent vertex id. Ids are written with
+  /// the causal metadata, so the order survives a reload. With distinct
+  /// points the order is that of canonical_points().
+  template <std::size_t size>
+  [[nodiscard]] inline auto ranked_precedes(Ranked_points<size> const& left,
+                                            Ranked_points<size> const& right)
+      -> bool
+  {
+    return std::ranges::lexicographical_compare(left, right,
+                                                ranked_point_precedes);
+  }
+
+  /// @brief Set kept in canonical rank order.
+  /// @details Elements are held in a treap ordered by the ranked points they
+  /// had when inserted, with subtree sizes so that insertion, erasure, and
+  /// reading the element of a given rank each cost O(log n). That rank
+  /// depends only on the embedding and vertex ids, not on insertion history,
+  /// handle addresses, or the standard library; tree shape affects only
+  /// speed. Each element's node is indexed by handle, so it is erased exactly
+  /// even if it ties with another element or its simplex has since been
+  /// destroyed or its handle reused. The tree is held behind a pointer so
+  /// that moves and swaps cannot throw.
+  /// @tparam Element Vertex handle, cell handle, or edge key
+  /// @tparam Hash Hash function object for @p Element
+  template <typename Element, typename Hash = std::hash<Element>>
+  class RankedSet
+  {
+    using Key = decltype(ranked_points(std::declval<Element const&>()));
+    static constexpr std::size_t NIL = std::numeric_limits<std::size_t>::max();
+
+    struct Node
+    {
+      Element       element;
+      Key           key;
+      std::uint64_t priority{};
+      std::size_t   left{NIL};
+      std::size_t   right{NIL};
+      std::size_t   parent{NIL};
+      std::size_t   size{1};
+    };
+
+    struct Tree
+    {
+      std::vector<Node>                              nodes;
+      /// Indices of vacated nodes, reused before the vector grows
+      std::vector<std::size_t>                       free;
+      std::unordered_map<Element, std::size_t, Hash> positions;
+      std::size_t                                    root{NIL};
+      /// Seed of the next priority; only the tree shape depends on it
+      std::uint64_t                                  draws{};
+    };
+
+    std::unique_ptr<Tree> m_tree;
+
+    [[nodiscard]] auto tree() -> Tree&
+    {
+      if (!m_tree) { m_tree = std::make_unique<Tree>(); }
+      return *m_tree;
+    }
+
+    /// @returns A SplitMix64 priority, so tree shapes are reproducible.
+    [[nodiscard]] static auto next_priority(Tree& state) noexcept
+        -> std::uint64_t
+    {
+      auto mixed = (state.draws += 0x9e3779b97f4a7c15ULL);          // NOLINT
+      mixed      = (mixed ^ (mixed >> 30)) * 0xbf58476d1ce4e5b9ULL;  // NOLINT
+      mixed      = (mixed ^ (mixed >> 27)) * 0x94d049bb133111ebULL;  // NOLINT
+      return mixed ^ (mixed >> 31);                                 // NOLINT
+    }
+
+    [[nodiscard]] static auto size_of(Tree const& state,
+                                      std::size_t const node) noexcept
+        -> std::size_t
+    { return node == NIL ? 0 : state.nodes[node].size; }
+
+    /// @brief Recompute the size of @p node and adopt its children.
+    static void pull(Tree& state, std::size_t const node) noexcept
+    {
+      auto& current = state.nodes[node];
+      current.size =
+          1 + size_of(state, current.left) + size_of(state, current.right);
+      if (current.left != NIL) { state.nodes[current.left].parent = node; }
+      if (current.right != NIL) { state.nodes[current.right].parent = node; }
+    }
+
+    /// @returns The roots of the first @p count elements of @p node and of
+    /// the rest.
+    [[nodiscard]] static auto split(Tree& state, std::size_t const node,
+                                    std::size_t const count) noexcept
+        -> std::pair<std::size_t, std::size_t>
+    {
+      if (node == NIL) { return {NIL, NIL}; }
+      auto const left_size = size_of(state, state.nodes[node].left);
+      if (count <= left_size)
+      {
+        auto const [first, rest] =
+            split(state, state.nodes[node].left, count);
+        state.nodes[node].left = rest;
+        pull(state, node);
+        return {first, node};
+      }
+      auto const [first, rest] =
+          split(state, state.nodes[node].right, count - left_size - 1);
+      state.nodes[node].right = first;
+      pull(state, node);
+      return {node, rest};
+    }  // split
+
+    /// @returns The root of @p left followed by @p right.
+    [[nodiscard]] static auto merge(Tree& state, std::size_t const left,
+                                    std::size_t const right) noexcept
+        -> std::size_t
+    {
+      if (left == NIL) { return right; }
+      if (right == NIL) { return left; }
+      if (state.nodes[left].priority > state.nodes[right].priority)
+      {
+        state.nodes[left].right = merge(state, state.nodes[left].right, right);
+        pull(state, left);
+        return left;
+      }
+      state.nodes[right].left = merge(state, left, state.nodes[right].left);
+      pull(state, right);
+      return right;
+    }  // merge
+
+    /// @brief Make @p root, which may be NIL, the parentless root.
+    static void set_root(Tree& state, std::size_t const root) noexcept
+    {
+      state.root = root;
+      if (root != NIL) { state.nodes[root].parent = NIL; }
+    }
+
+    /// @returns The number of elements whose key does not follow @p key.
+    [[nodiscard]] static auto upper_rank(Tree const& state,
+                                         Key const&  key) noexcept
+        -> std::size_t
+    {
+      std::size_t rank{};
+      for (auto node = state.root; node != NIL;)
+      {
+        auto const& current = state.nodes[node];
+        if (ranked_precedes(key, current.key)) { node = current.left; }
+        else
+        {
+          rank += size_of(state, current.left) + 1;
+          node = current.right;
+        }
+      }
+      return rank;
+    }
+
+    /// @returns The rank of the stored @p node, found by climbing to the root.
+    [[nodiscard]] static auto rank_of(Tree const&       state,
+                                      std::size_t const node) noexcept
+        -> std::size_t
+    {
+      auto rank = size_of(state, state.nodes[node].left);
+      for (auto child = node; state.nodes[child].parent != NIL;)
+      {
+        auto const parent = state.nodes[child].parent;
+        if (state.nodes[parent].right == child)
+        {
+          rank += size_of(state, state.nodes[parent].left) + 1;
+        }
+        child = parent;
+      }
+      return rank;
+    }
+
+    /// @returns A node holding @p element and @p key, with no children.
+    [[nodiscard]] static auto make_node(Tree& state, Element const& element,
+                                        Key key) -> std::size_t
+    {
+      Node node{.element  = element,
+                .key      = std::move(key),
+                .priority = next_priority(state)};
+      if (state.free.empty())
+      {
+        state.nodes.push_back(std::move(node));
+        return state.nodes.size() - 1;
+      }
+      auto const index = state.free.back();
+      state.free.pop_back();
+      state.nodes[index] = std::move(node);
+      return index;
+    }
+
+   public:
+    using value_type = Element;
+
+    /// @brief In-order iterator over the elements.
+    class Iterator
+    {
+      Tree const* m_state{nullptr};
+      std::size_t m_node{NIL};
+
+     public:
+      using value_type        = Element;
+      using difference_type   = std::ptrdiff_t;
+      using reference         = Element const&;
+      using pointer           = Element const*;
+      using iterator_category = std::forward_iterator_tag;
+
+      Iterator() noexcept = default;
+
+      Iterator(Tree const* state, std::size_t const node) noexcept
+          : m_state{state}, m_node{node}
+      {}
+
+      [[nodiscard]] auto operator*() const noexcept -> reference
+      { return m_state->nodes[m_node].element; }
+
+      [[nodiscard]] auto operator->() const noexcept -> pointer
+      { return &m_state->nodes[m_node].element; }
+
+      auto operator++() noexcept -> Iterator&
+      {
+        auto const& nodes = m_state->nodes;
+        if (nodes[m_node].right != NIL)
+        {
+          m_node = nodes[m_node].right;
+          while (nodes[m_node].left != NIL) { m_node = nodes[m_node].left; }
+          return *this;
+        }
+        auto child = m_node;
+        m_node     = nodes[child].parent;
+        while (m_node != NIL && nodes[m_node].right == child)
+        {
+          child  = m_node;
+          m_node = nodes[child].parent;
+        }
+        return *this;
+      }
+
+      auto operator++(int) noexcept -> Iterator
+      {
+        auto previous = *this;
+        ++*this;
+        return previous;
+      }
+
+      [[nodiscard]] friend auto operator==(Iterator const& left,
+                                           Iterator const& right) noexcept
+          -> bool
+      { return left.m_node == right.m_node; }
+    };
+
+    RankedSet() noexcept = default;
+    ~RankedSet()         = default;
+
+    /// @brief Rank @p elements with one sort and a linear-time build.
+    /// @param elements Live elements, in any order and without duplicates.
+    explicit RankedSet(std::vector<Element> const& elements)
+        : m_tree{std::make_unique<Tree>()}
+    {
+      auto& state = *m_tree;
+      state.nodes.reserve(elements.size());
+      state.positions.reserve(elements.size());
+      for (auto const& element : elements)
+      {
+        state.nodes.push_back(
+            Node{.element = element, .key = ranked_points(element)});
+      }
+      std::ranges::stable_sort(
+          state.nodes, ranked_precedes<std::tuple_size_v<Key>>, &Node::key);
+      // Cartesian-tree construction along the right spine.
+      std::vector<std::size_t> spine;
+      for (std::size_t index = 0; index < state.nodes.size(); ++index)
+      {
+        auto& node    = state.nodes[index];
+        node.priority = next_priority(state);
+        state.positions.try_emplace(node.element, index);
+        auto last = NIL;
+        while (!spine.empty() &&
+               state.nodes[spine.back()].priority < node.priority)
+        {
+          last = spine.back();
+          spine.pop_back();
+        }
+        node.left = last;
+        if (!spine.empty()) { state.nodes[spine.back()].right = index; }
+        spine.push_back(index);
+      }
+      if (!spine.empty()) { set_root(state, spine.front()); }
+      // Pull sizes up from the leaves by reversing a preorder walk.
+      std::vector<std::size_t> order;
+      order.reserve(state.nodes.size());
+      for (std::vector<std::size_t> pending{state.root};
+           !pending.empty() && pending.back() != NIL;)
+      {
+        auto const node = pending.back();
+        pending.pop_back();
+        order.push_back(node);
+        for (auto const child : {state.nodes[node].left,
+                                 state.nodes[node].right})
+        {
+          if (child != NIL) { pending.push_back(child); }
+        }
+      }
+      for (auto node = order.rbegin(); node != order.rend(); ++node)
+      {
+        pull(state, *node);
+      }
+    }
+
+    RankedSet(RankedSet const&)                    = delete;
+    auto operator=(RankedSet const&) -> RankedSet& = delete;
+
+    /// @param other Set whose elements are transferred, leaving it empty.
+    RankedSet(RankedSet&& other) noexcept : m_tree{std::move(other.m_tree)} {}
+
+    /// @param other Set whose elements are transferred.
+    /// @returns This set after replacement.
+    auto operator=(RankedSet&& other) noexcept -> RankedSet&
+    {
+      RankedSet moved{std::move(other)};
+      swap(moved, *this);
+      return *this;
+    }
+
+    friend void swap(RankedSet& left, RankedSet& right) noexcept
+    {
+      using std::swap;
+      swap(left.m_tree, right.m_tree);
+    }  // swap
+
+    [[nodiscard]] auto size() const noexcept -> std::size_t
+    { return m_tree ? size_of(*m_tree, m_tree->root) : 0; }
+
+    [[nodiscard]] auto empty() const noexcept -> bool { return size() == 0; }
+
+    [[nodiscard]] auto begin() const noexcept -> Iterator
+    {
+      if (empty()) { return end(); }
+      auto node = m_tree->root;
+      while (m_tree->nodes[node].left != NIL)
+      {
+        node = m_tree->nodes[node].left;
+      }
+      return {m_tree.get(), node};
+    }
+
+    [[nodiscard]] auto end() const noexcept -> Iterator
+    { return {m_tree.get(), NIL}; }
+
+    /// @param rank Canonical rank in [0, size()).
+    /// @returns The element of canonical rank @p rank, in O(log n).
+    [[nodiscard]] auto operator[](std::size_t rank) const noexcept
+        -> Element const&
+    {
+      auto node = m_tree->root;
+      for (;;)
+      {
+        auto const& current   = m_tree->nodes[node];
+        auto const  left_size = size_of(*m_tree, current.left);
+        if (rank == left_size) { return current.element; }
+        if (rank < left_size) { node = current.left; }
+        else
+        {
+          rank -= left_size + 1;
+          node = current.right;
+        }
+      }
+    }
+
+    [[nodiscard]] auto contains(Element const& element) const -> bool
+    { return m_tree && m_tree->positions.contains(element); }
+
+    /// @pre Every element is live.
+    /// @returns True if every remembered rank is current and the stored order
+    /// is canonical. Equal keys are accepted, since an element may tie with a
+    /// destroyed one that is still awaiting erasure.
+    [[nodiscard]] auto is_ranked() const -> bool
+    {
+      if (empty()) { return true; }
+      if (m_tree->positions.size() != size()) { return false; }
+      Key const* previous{nullptr};
+      for (auto position = begin(); position != end(); ++position)
+      {
+        auto const found = m_tree->positions.find(*position);
+        if (found == m_tree->positions.end()) { return false; }
+        auto const& key = m_tree->nodes[found->second].key;
+        if (key != ranked_points(*position) ||
+            (previous != nullptr && ranked_precedes(key, *previous)))
+        {
+          return false;
+        }
+        previous = &key;
+      }
+      return true;
+    }
+
+    /// @param element Live element whose ranked points are read.
+    /// @returns True if @p element was not already present.
+    auto insert(Element const& element) -> bool
+    {
+      auto& state                  = tree();
+      auto const [found, inserted] = state.positions.try_emplace(element, NIL);
+      if (!inserted) { return false; }
+      try
+      {
+        found->second = make_node(state, element, ranked_points(element));
+      }
+      catch (...)
+      {
+        state.positions.erase(found);
+        throw;
+      }
+      auto const node = found->second;
+      // Later arrivals follow any equal keys.
+      auto const [first, rest] =
+          split(state, state.root, upper_rank(state, state.nodes[node].key));
+      set_root(state, merge(state, merge(state, first, node), rest));
+      return true;
+    }
+
+    /// @param element Element to forget; it need not be live.
+    /// @returns True if @p element was present.
+    auto erase(Element const& element) -> bool
+    {
+      if (!m_tree) { return false; }
+      auto& state = *m_tree;
+      auto const found = state.positions.find(element);
+      if (found == state.positions.end()) { return false; }
+      auto const node = found->second;
+      auto const [first, rest] = split(state, state.root, rank_of(state, node));
+      auto const [erased, last] = split(state, rest, 1);
+      assert(erased == node);
+      state.nodes[erased].parent = NIL;
+      set_root(state, merge(state, first, last));
+      state.positions.erase(found);
+      state.free.push_back(node);
+      return true;
+    }
+  };
+
+  /// @brief Table from persistent simplex ids to live handles.
+  /// @details Each registered handle stores its id in its CGAL base, so both
+  /// directions are a single load. Released ids are reused smallest first,
+  /// which makes the next id depend only on the ids in use, not on the order
+  /// in which they were released. Tables are move-only because their handles
+  /// borrow from one triangulation.
+  /// @tparam Handle Vertex or cell handle whose base provides id() and
+  /// set_id()
+  template <typename Handle>
+  class IdTable
+  {
+    std::vector<Handle>     m_handles;
+    /// Min-heap of ids below m_handles.size() with no handle
+    std::vector<Simplex_id> m_free;
+
+    void take(Simplex_id const id, Handle const handle)
+    {
+      m_handles[id] = handle;
+      handle->set_id(id);
+    }
+
+   public:
+    IdTable() noexcept = default;
+    ~IdTable()         = default;
+
+    /// @brief Register @p handles, keeping any ids they already carry.
+    /// @details Copying a triangulation copies its ids, so a copy's table
+    /// names each simplex by the same id as the original's. Unassigned or
+    /// duplicated ids are replaced in the order of @p handles.
+    /// @param handles Live handles without duplicates.
+    explicit IdTable(std::vector<Handle> const& handles)
+    {
+      std::vector<Handle> unassigned;
+      for (auto const& handle : handles)
+      {
+        auto const id = handle->id();
+        if (id == UNASSIGNED_SIMPLEX_ID)
+        {
+          unassigned.push_back(handle);
+          continue;
+        }
+        if (id >= m_handles.size()) { m_handles.resize(id + std::size_t{1}); }
+        if (m_handles[id] == Handle{}) { m_handles[id] = handle; }
+        else { unassigned.push_back(handle); }
+      }
+      for (auto id = std::size_t{}; id < m_handles.size(); ++id)
+      {
+        if (m_handles[id] == Handle{})
+        {
+          m_free.push_back(static_cast<Simplex_id>(id));
+        }
+      }
+      std::ranges::make_heap(m_free, std::greater<>{});
+      for (auto const& handle : unassigned) { assign(handle); }
+    }
+
+    IdTable(IdTable const&)                    = delete;
+    auto operator=(IdTable const&) -> IdTable& = delete;
+
+    /// @param other Table whose ids are transferred, leaving it empty.
+    IdTable(IdTable&& other) noexcept
+        : m_handles{std::exchange(other.m_handles, {})}
+        , m_free{std::exchange(other.m_free, {})}
+    {}
+
+    /// @param other Table whose ids are transferred.
+    /// @returns This table after replacement.
+    auto operator=(IdTable&& other) noexcept -> IdTable&
+    {
+      IdTable moved{std::move(other)};
+      swap(moved, *this);
+      return *this;
+    }
+
+    friend void swap(IdTable& left, IdTable& right) noexcept
+    {
+      using std::swap;
+      swap(left.m_handles, right.m_handles);
+      swap(left.m_free, right.m_free);
+    }  // swap
+
+    /// @returns Number of registered handles.
+    [[nodiscard]] auto size() const noexcept -> std::size_t
+    { return m_handles.size() - m_free.size(); }
+
+    /// @returns The handle registered under @p id, if any.
+    [[nodiscard]] auto find(Simplex_id const id) const noexcept
+        -> std::optional<Handle>
+    {
+      if (id >= m_handles.size() || m_handles[id] == Handle{})
+      {
+        return std::nullopt;
+      }
+      return m_handles[id];
+    }
+
+    /// @pre @p handle is live.
+    /// @returns True if @p handle is registered under the id it carries.
+    [[nodiscard]] auto contains(Handle const handle) const noexcept -> bool
+    {
+      auto const id = handle->id();
+      return id < m_handles.size() && m_handles[id] == handle;
+    }
+
+    /// @brief Register @p handle under the smallest free id.
+    /// @returns The id now stored in @p handle.
+    auto assign(Handle const handle) -> Simplex_id
+    {
+      if (m_free.empty())
+      {
+        if (m_handles.size() >= UNASSIGNED_SIMPLEX_ID)
+        {
+          throw std::length_error("Simplex ids are exhausted.");
+        }
+        m_handles.push_back(handle);
+        handle->set_id(static_cast<Simplex_id>(m_handles.size() - 1));
+        return handle->id();
+      }
+      std::ranges::pop_heap(m_free, std::greater<>{});
+      auto const id = m_free.back();
+      m_free.pop_back();
+      take(id, handle);
+      return id;
+    }
+
+    /// @brief Register @p handle, keeping the id it carries if that is free.
+    /// @details A vertex restored by a rollback carries the id it had before
+    /// it was removed, and a cell reused by a flip keeps its own.
+    /// @returns The id now stored in @p handle.
+    auto claim(Handle const handle) -> Simplex_id
+    {
+      auto const id = handle->id();
+      if (contains(handle)) { return id; }
+      if (id < m_handles.size() && m_handles[id] == Handle{})
+      {
+        m_free.erase(std::ranges::find(m_free, id));
+        std::ranges::make_heap(m_free, std::greater<>{});
+        take(id, handle);
+        return id;
+      }
+      return assign(handle);
+    }
+
+    /// @brief Free @p id if it still names @p handle.
+    /// @details The handle is only compared, never dereferenced, so it may
+    /// since have been destroyed.
+    /// @returns True if @p id was released.
+    auto release(Simplex_id const id, Handle const handle) -> bool
+    {
+      if (id >= m_handles.size() || m_handles[id] != handle) { return false; }
+      m_free.reserve(m_free.size() + 1);
+      m_handles[id] = Handle{};
+      m_free.push_back(id);
+      std::ranges::push_heap(m_free, std::greater<>{});
+      return true;
+    }
+  };
+
+  /// @brief Compact log of in-place triangulation mutations.
+  /// @details Each journaled operation mutates the triangulation and records
+  /// only the vertex handles needed to locate its inverse. Vertex handles
+  /// survive flips, so a record never refers to a cell that a later operation
+  /// may destroy. rollback() replays the inverses in reverse order, restoring
+  /// the combinatorial triangulation, vertex points, and vertex and cell
+  /// metadata that existed when the journal was last empty, including the id
+  /// of each removed-then-restored vertex. Cell handles and ids and the
+  /// handles of removed-then-restored vertices are not preserved.
+  ///
+  /// Alongside the records, the journal keeps a Footprint of the cells around
+  /// every operation, including the inverses run by rollback(). Only those
+  /// cells and their faces can have changed, so derived caches may be patched
+  /// from the footprint instead of rebuilt.
+  /// @note The journal borrows nothing; the triangulation is passed to every
+  /// call and must be the same object for the lifetime of the records.
+  class UndoJournal
+  {
+    using Delaunay      = Delaunay_t<3>;
+    using Cell_handle   = Cell_handle_t<3>;
+    using Facet         = Facet_t<3>;
+    using Edge_handle   = Edge_handle_t<3>;
+    using Vertex_handle = Vertex_handle_t<3>;
+
+    enum class Operation : std::uint8_t
+    {
+      CREATED_EDGE,     ///< A (2,3) flip created the edge vertices[0..1].
+      CREATED_FACET,    ///< A (3,2) flip created the facet vertices[0..2].
+      INSERTED_VERTEX,  ///< subject was inserted into a facet.
+      REMOVED_VERTEX    ///< subject was removed, leaving cell vertices[0..3].
+    };
+
+    struct Record
+    {
+      Operation                    operation;
+      Vertex_handle                subject{};
+      std::array<Vertex_handle, 4> vertices{};
+      Point_t<3>                   point{};
+      Int_precision                info{0};
+      Simplex_id                   id{UNASSIGNED_SIMPLEX_ID};
+    };
+
+   public:
+    /// @brief A cell next to a journaled operation, and its vertices and id
+    /// then.
+    struct Touched_cell
+    {
+      Cell_handle                  cell;
+      std::array<Vertex_handle, 4> vertices{};
+      Simplex_id                   id{UNASSIGNED_SIMPLEX_ID};
+      /// True if the operation this record precedes destroyed the cell
+      bool                         destroyed{false};
+    };
+
+    /// @brief A vertex removed by a journaled operation.
+    struct Removed_vertex
+    {
+      Vertex_handle vertex;
+      Int_precision timevalue{0};
+      Simplex_id    id{UNASSIGNED_SIMPLEX_ID};
+    };
+
+    /// @brief Simplices that journaled operations may have created or
+    /// destroyed.
+    /// @details Cells are recorded both before and after each operation,
+    /// and a record from before is marked destroyed unless the operation
+    /// records its handle again afterwards. A recorded handle may since have
+    /// been destroyed or reused, but its recorded vertices still name the
+    /// facets and edges it bounded. Inserted vertices are dropped when they
+    /// are removed, so they are all live. Removed vertices keep the
+    /// timevalue and id they had when they were removed.
+    struct Footprint
+    {
+      std::vector<Touched_cell>   cells;
+      std::vector<Vertex_handle>  inserted_vertices;
+      std::vector<Removed_vertex> removed_vertices;
+
+      /// @returns Each recorded cell that is live now, once.
+      /// @details A handle's last record decides, because a destroyed cell
+      /// is recorded again only if a later operation reuses its handle. The
+      /// cost is quadratic in the few records of a move, and no handle is
+      /// looked up in the triangulation.
+      [[nodiscard]] auto live_cells() const -> std::vector<Cell_handle>
+      {
+        std::vector<Cell_handle> seen;
+        std::vector<Cell_handle> live;
+        for (auto const& touched : std::views::reverse(cells))
+        {
+          if (std::ranges::find(seen, touched.cell) != seen.end()) { continue; }
+          seen.push_back(touched.cell);
+          if (!touched.destroyed) { live.push_back(touched.cell); }
+        }
+        return live;
+      }
+    };
+
+    /// @returns The three vertices linking a degree-three edge, if any.
+    /// @details These span the facet a (3,2) flip of @p edge would create.
+    [[nodiscard]] static auto edge_ring(Delaunay const&    triangulation,
+                                        Edge_handle const& edge)
+        -> std::optional<std::array<Vertex_handle, 3>>
+    {
+      auto const first  = edge.first->vertex(edge.second);
+      auto const second = edge.first->vertex(edge.third);
+      std::array<Vertex_handle, 3> ring{};
+      std::size_t                  found{0};
+      std::size_t                  cells{0};
+      auto       circulator = triangulation.incident_cells(edge);
+      auto const done       = circulator;
+      do {
+        if (++cells > 3) { return std::nullopt; }
+        for (auto index = 0; index < 4; ++index)  // NOLINT
+        {
+          auto const vertex = circulator->vertex(index);
+          if (vertex == first || vertex == second ||
+              std::ranges::find(ring.begin(), ring.begin() + found, vertex) !=
+                  ring.begin() + found)
+          {
+            continue;
+          }
+          if (found == ring.size()) { return std::nullopt; }
+          ring[found++] = vertex;
+        }
+      }
+      while (++circulator != done);
+      if (found != ring.size()) { return std::nullopt; }
+      return ring;
+    }  // edge_ring
+
+   private:
+    std::vector<Record>           m_records;
+    Footprint                     m_footprint;
+    /// Ids of the journaled triangulation's vertices, if its owner keeps them
+    IdTable<Vertex_handle> const* m_vertex_ids{nullptr};
+
+    void touch(Cell_handle const cell)
+    {
+      m_footprint.cells.push_back(
+          {.cell     = cell,
+           .vertices = {cell->vertex(0), cell->vertex(1), cell->vertex(2),
+                        cell->vertex(3)},
+           .id       = cell->id()});
+    }  // touch
+
+    /// @brief Record both cells sharing the facet opposite @p index.
+    void touch_facet(Cell_handle const cell, int const index)
+    {
+      touch(cell);
+      touch(cell->neighbor(index));
+    }  // touch_facet
+
+    /// @brief Record both cells sharing the facet spanned by @p vertices.
+    void touch_facet(Delaunay const&                     triangulation,
+                     std::array<Vertex_handle, 3> const& vertices)
+    {
+      Cell_handle cell;
+      int         first{0};
+      int         second{0};
+      int         third{0};
+      if (triangulation.tds().is_facet(vertices[0], vertices[1], vertices[2],
+                                       cell, first, second, third))
+      {
+        touch_facet(cell, 6 - first - second - third);
+      }
+    }  // touch_facet
+
+    /// @brief Record every cell around @p edge.
+    void touch_edge(Delaunay const& triangulation, Edge_handle const& edge)
+    {
+      auto       circulator = triangulation.incident_cells(edge);
+      auto const done       = circulator;
+      do {
+        touch(circulator);
+      }
+      while (++circulator != done);
+    }  // touch_edge
+
+    /// @brief Record every cell around the edge (@p first, @p second).
+    void touch_edge(Delaunay const& triangulation, Vertex_handle const first,
+                    Vertex_handle const second)
+    {
+      Cell_handle cell;
+      int         first_index{0};
+      int         second_index{0};
+      if (triangulation.tds().is_edge(first, second, cell, first_index,
+                                      second_index))
+      {
+        touch_edge(triangulation, Edge_handle{cell, first_index, second_index});
+      }
+    }  // touch_edge
+
+    /// @brief Record every cell incident to @p vertex.
+    void touch_star(Delaunay const& triangulation, Vertex_handle const vertex)
+    {
+      std::vector<Cell_handle> cells;
+      triangulation.tds().incident_cells(vertex, std::back_inserter(cells));
+      for (auto const& cell : cells) { touch(cell); }
+    }  // touch_star
+
+    /// @brief Forget cells touched by an operation that did not happen.
+    void untouch(std::size_t const mark)
+    {
+      m_footprint.cells.erase(
+          m_footprint.cells.begin() + static_cast<std::ptrdiff_t>(mark),
+          m_footprint.cells.end());
+    }  // untouch
+
+    /// @brief Mark the cells recorded from @p before that the operation
+    /// destroyed, i.e. that it did not record again from @p after.
+    void retire(std::size_t const before, std::size_t const after)
+    {
+      auto const cells   = std::span{m_footprint.cells};
+      auto const current = cells.subspan(after);
+      for (auto& touched : cells.subspan(before, after - before))
+      {
+        touched.destroyed = std::ranges::none_of(
+            current, [&touched](Touched_cell const& other) {
+              return other.cell == touched.cell;
+            });
+      }
+    }  // retire
+
+    /// @brief Remove a degree-four vertex, recording its star and remnant.
+    auto remove_vertex(Delaunay& triangulation, Vertex_handle const vertex)
+        -> Cell_handle
+    {
+      m_footprint.removed_vertices.reserve(
+          m_footprint.removed_vertices.size() + 1);
+      auto const mark = m_footprint.cells.size();
+      touch_star(triangulation, vertex);
+      auto const info = vertex->info();
+      auto const id   = vertex->id();
+      auto const cell =
+          triangulation.tds().remove_from_maximal_dimension_simplex(vertex);
+      std::erase(m_footprint.inserted_vertices, vertex);
+      m_footprint.removed_vertices.push_back(
+          {.vertex = vertex, .timevalue = info, .id = id});
+      auto const after = m_footprint.cells.size();
+      touch(cell);
+      retire(mark, after);
+      return cell;
+    }  // remove_vertex
+
+    /// @brief Undo an insertion by flipping one degree-three spoke away and
+    /// removing the now degree-four vertex.
+    void remove_inserted_vertex(Delaunay&           triangulation,
+                                Vertex_handle const vertex)
+    {
+      auto&                    tds = triangulation.tds();
+      std::vector<Edge_handle> spokes;
+      tds.incident_edges(vertex, std::back_inserter(spokes));
+      // Spoke handles are stale after the first successful flip.
+      for (auto const& spoke : spokes)
+      {
+        auto const ring = edge_ring(triangulation, spoke);
+        if (!ring) { continue; }
+        auto const mark = m_footprint.cells.size();
+        touch_edge(triangulation, spoke);
+        if (tds.flip(spoke))
+        {
+          auto const after = m_footprint.cells.size();
+          touch_facet(triangulation, *ring);
+          retire(mark, after);
+          break;
+        }
+        untouch(mark);
+      }
+      if (tds.degree(vertex) != 4)  // NOLINT
+      {
+        throw std::logic_error(
+            "Cannot restore the star of an inserted vertex.");
+      }
+      static_cast<void>(remove_vertex(triangulation, vertex));
+    }  // remove_inserted_vertex
+
+    /// @brief Ensure a record can be appended after the mutation succeeds.
+    void reserve_record() { m_records.reserve(m_records.size() + 1); }
+
+   public:
+    UndoJournal() noexcept = default;
+
+    /// @param vertex_ids Ids of the journaled triangulation's finite vertices,
+    /// which its owner patches from each taken footprint. The table must
+    /// outlive the journal.
+    explicit UndoJournal(IdTable<Vertex_handle> const& vertex_ids) noexcept
+        : m_vertex_ids{&vertex_ids}
+    {}
+
+    /// @returns True if there is nothing to roll back.
+    [[nodiscard]] auto empty() const noexcept -> bool
+    { return m_records.empty(); }
+
+    /// @returns The vertex id table while it describes the triangulation,
+    /// i.e. no operation has touched it since the footprint was taken, or
+    /// nullptr.
+    [[nodiscard]] auto current_vertex_ids() const noexcept
+        -> IdTable<Vertex_handle> const*
+    {
+      auto const untouched = m_footprint.cells.empty() &&
+                             m_footprint.inserted_vertices.empty() &&
+                             m_footprint.removed_vertices.empty();
+      return untouched ? m_vertex_ids : nullptr;
+    }
+
+    /// @returns Number of journaled operations.
+    [[nodiscard]] auto size() const noexcept -> std::size_t
+    { return m_records.size(); }
+
+    /// @brief Forget every record, committing the current triangulation.
+    /// @details The footprint is kept until it is taken.
+    void clear() noexcept { m_records.clear(); }
+
+    /// @returns Cells and vertices touched since the footprint was taken.
+    [[nodiscard]] auto footprint() const noexcept -> Footprint const&
+    { return m_footprint; }
+
+    /// @brief Hand over the footprint, leaving an empty one behind.
+    [[nodiscard]] auto take_footprint() noexcept -> Footprint
+    { return std::exchange(m_footprint, {}); }
+
+    /// @brief Checked (2,3) flip of the facet opposite @p index in @p cell.
+    /// @returns True if CGAL performed the flip.
+    [[nodiscard]] auto flip(Delaunay& triangulation, Cell_handle const cell,
+                            int const index) -> bool
+    {
+      reserve_record();
+      auto const apex   = cell->vertex(index);
+      auto const mirror = triangulation.mirror_vertex(cell, index);
+      auto const mark   = m_footprint.cells.size();
+      touch_facet(cell, index);
+      if (!triangulation.flip(cell, index))
+      {
+        untouch(mark);
+        return false;
+      }
+      m_records.push_back(
+          {.operation = Operation::CREATED_EDGE, .vertices = {apex, mirror}});
+      auto const after = m_footprint.cells.size();
+      touch_edge(triangulation, apex, mirror);
+      retire(mark, after);
+      return true;
+    }  // flip
+
+    /// @brief Checked (3,2) flip of the edge (@p first, @p second) in @p cell.
+    /// @returns True if CGAL performed the flip.
+    [[nodiscard]] auto flip(Delaunay& triangulation, Cell_handle const cell,
+                            int const first, int const second) -> bool
+    {
+      reserve_record();
+      Edge_handle const edge{cell, first, second};
+      auto const        ring = edge_ring(triangulation, edge);
+      if (!ring) { return false; }
+      auto const mark = m_footprint.cells.size();
+      touch_edge(triangulation, edge);
+      if (!triangulation.flip(cell, first, second))
+      {
+        untouch(mark);
+        return false;
+      }
+      m_records.push_back({.operation = Operation::CREATED_FACET,
+                           .vertices  = {(*ring)[0], (*ring)[1], (*ring)[2]}});
+      auto const after = m_footprint.cells.size();
+      touch_facet(triangulation, *ring);
+      retire(mark, after);
+      return true;
+    }  // flip
+
+    /// @brief Unchecked topological (2,3) flip of @p facet.
+    /// @returns True if the triangulation data structure performed the flip.
+    [[nodiscard]] auto flip_topological(Delaunay&    triangulation,
+                                        Facet const& facet) -> bool
+    {
+      reserve_record();
+      auto const apex = facet.first->vertex(facet.second);
+      auto const mirror =
+          triangulation.tds().mirror_vertex(facet.first, facet.second);
+      auto const mark = m_footprint.cells.size();
+      touch_facet(facet.first, facet.second);
+      if (!triangulation.tds().flip(facet))
+      {
+        untouch(mark);
+        return false;
+      }
+      m_records.push_back(
+          {.operation = Operation::CREATED_EDGE, .vertices = {apex, mirror}});
+      auto const after = m_footprint.cells.size();
+      touch_edge(triangulation, apex, mirror);
+      retire(mark, after);
+      return true;
+    }  // flip_topological
+
+    /// @brief Unchecked topological (3,2) flip of @p edge.
+    /// @returns True if the triangulation data structure performed the flip.
+    [[nodiscard]] auto flip_topological(Delaunay&          triangulation,
+                                        Edge_handle const& edge) -> bool
+    {
+      reserve_record();
+      auto const ring = edge_ring(triangulation, edge);
+      if (!ring) { return false; }
+      auto const mark = m_footprint.cells.size();
+      touch_edge(triangulation, edge);
+      if (!triangulation.tds().flip(edge))
+      {
+        untouch(mark);
+        return false;
+      }
+      m_records.push_back({.operation = Operation::CREATED_FACET,
+                           .vertices  = {(*ring)[0], (*ring)[1], (*ring)[2]}});
+      auto const after = m_footprint.cells.size();
+      touch_facet(triangulation, *ring);
+      retire(mark, after);
+      return true;
+    }  // flip_topological
+
+    /// @brief Insert a vertex into the facet opposite @p index in @p cell.
+    /// @returns The inserted vertex; its point and info are left to the caller.
+    [[nodiscard]] auto insert_in_facet(Delaunay&         triangulation,
+                                       Cell_handle const cell,
+                                       int const index) -> Vertex_handle
+    {
+      reserve_record();
+      m_footprint.inserted_vertices.reserve(
+          m_footprint.inserted_vertices.size() + 1);
+      auto const mark = m_footprint.cells.size();
+      touch_facet(cell, index);
+      auto const vertex = triangulation.tds().insert_in_facet(cell, index);
+      m_records.push_back(
+          {.operation = Operation::INSERTED_VERTEX, .subject = vertex});
+      m_footprint.inserted_vertices.push_back(vertex);
+      auto const after = m_footprint.cells.size();
+      touch_star(triangulation, vertex);
+      retire(mark, after);
+      return vertex;
+    }  // insert_in_facet
+
+    /// @brief Remove a degree-four vertex from its star.
+    /// @returns The cell that replaces the star.
+    auto remove_from_maximal_dimension_simplex(
+        Delaunay& triangulation, Vertex_handle const vertex) -> Cell_handle
+    {
+      reserve_record();
+      auto const point = vertex->point();
+      auto const info  = vertex->info();
+      auto const id    = vertex->id();
+      auto const cell  = remove_vertex(triangulation, vertex);
+      m_records.push_back(
+          {.operation = Operation::REMOVED_VERTEX,
+           .subject   = vertex,
+           .vertices  = {cell->vertex(0), cell->vertex(1), cell->vertex(2),
+                         cell->vertex(3)},
+           .point     = point,
+           .info      = info,
+           .id        = id});
+      return cell;
+    }  // remove_from_maximal_dimension_simplex
+
+    /// @brief Undo every journaled operation in reverse order.
+    /// @details Cells around touched vertices are reclassified, so the cell
+    /// metadata matches what it was before the first journaled operation.
+    /// The inverse operations extend the footprint.
+    /// @throws std::logic_error if an inverse cannot be applied, which means
+    /// the triangulation was mutated outside the journal.
+    void rollback(Delaunay& triangulation)
+    {
+      auto&                      tds = triangulation.tds();
+      std::vector<Vertex_handle> touched;
+      for (auto position = m_records.size(); position-- > 0;)
+      {
+        auto const& record = m_records[position];
+        switch (record.operation)
+        {
+          case Operation::CREATED_EDGE:
+          {
+            Cell_handle cell;
+            int         first{0};
+            int         second{0};
+            if (!triangulation.is_edge(record.vertices[0], record.vertices[1],
+                                       cell, first, second))
+            {
+              throw std::logic_error("Cannot undo a journaled (2,3) flip.");
+            }
+            Edge_handle const edge{cell, first, second};
+            auto const        ring = edge_ring(triangulation, edge);
+            auto const        mark = m_footprint.cells.size();
+            touch_edge(triangulation, edge);
+            if (!ring || !tds.flip(cell, first, second))
+            {
+              throw std::logic_error("Cannot undo a journaled (2,3) flip.");
+            }
+            auto const after = m_footprint.cells.size();
+            touch_facet(triangulation, *ring);
+            retire(mark, after);
+            touched.insert(touched.end(), record.vertices.begin(),
+                           record.vertices.begin() + 2);
+            break;
+          }
+          case Operation::CREATED_FACET:
+          {
+            Cell_handle cell;
+            int         first{0};
+            int         second{0};
+            int         third{0};
+            if (!triangulation.is_facet(record.vertices[0], record.vertices[1],
+                                        record.vertices[2], cell, first,
+                                        second, third))
+            {
+              throw std::logic_error("Cannot undo a journaled (3,2) flip.");
+            }
+            auto const index  = 6 - first - second - third;
+            auto const apex   = cell->vertex(index);
+            auto const mirror = tds.mirror_vertex(cell, index);
+            auto const mark   = m_footprint.cells.size();
+            touch_facet(cell, index);
+            if (!tds.flip(cell, index))
+            {
+              throw std::logic_error("Cannot undo a journaled (3,2) flip.");
+            }
+            auto const after = m_footprint.cells.size();
+            touch_edge(triangulation, apex, mirror);
+            retire(mark, after);
+            touched.insert(touched.end(), record.vertices.begin(),
+                           record.vertices.begin() + 3);
+            break;
+          }
+          case Operation::INSERTED_VERTEX:
+          {
+            tds.adjacent_vertices(record.subject, std::back_inserter(touched));
+            remove_inserted_vertex(triangulation, record.subject);
+            break;
+          }
+          case Operation::REMOVED_VERTEX:
+          {
+            Cell_handle cell;
+            if (!triangulation.is_cell(record.vertices[0], record.vertices[1],
+                                       record.vertices[2], record.vertices[3],
+                                       cell))
+            {
+              throw std::logic_error(
+                  "Cannot undo a journaled vertex removal.");
+            }
+            auto const mark = m_footprint.cells.size();
+            touch(cell);
+            auto const restored = tds.insert_in_cell(cell);
+            restored->set_point(record.point);
+            restored->info() = record.info;
+            restored->set_id(record.id);
+            // Earlier records name the removed handle; point them at its
+            // replacement before they are replayed.
+            for (auto& earlier : std::span{m_records}.first(position))
+            {
+              if (earlier.subject == record.subject)
+              {
+                earlier.subject = restored;
+              }
+              std::ranges::replace(earlier.vertices, record.subject, restored);
+            }
+            m_footprint.inserted_vertices.push_back(restored);
+            auto const after = m_footprint.cells.size();
+            touch_star(triangulation, restored);
+            retire(mark, after);
+            touched.push_back(restored);
+            break;
+          }
+        }
+      }
+      m_records.clear();
+
+      std::vector<Cell_handle> cells;
+      for (auto const& vertex : touched)
+      {
+        tds.incident_cells(vertex, std::back_inserter(cells));
+      }
+      for (auto const& cell : cells)
+      {
+        if (triangulation.is_infinite(cell)) { continue; }
+        cell->info() = static_cast<Int_precision>(expected_cell_type<3>(cell));
+      }
+    }  // rollback
+  };
+
+  /// @brief Extent of the invariant checks made after each move.
+  enum class Validation : std::uint8_t
+  {
+    /// Only the cells and vertices a move touched, and their neighbors.
+    LOCAL,
+    /// The whole triangulation as well, as an opt-in diagnostic.
+    GLOBAL
+  };
+
+  /// Validation level used after moves unless a caller asks for another.
+  inline constexpr Validation DEFAULT_VALIDATION =
+#if defined(CDT_ENABLE_GLOBAL_MOVE_VALIDATION) && \
+    CDT_ENABLE_GLOBAL_MOVE_VALIDATION
+      Validation::GLOBAL;
+#else
+      Validation::LOCAL;
+#endif
+
+  /// @brief Check the triangulation data structure around a footprint.
+  /// @details Each cell the footprint records as live, and each of its
+  /// neighbors, must have symmetric, consistently oriented adjacencies, and
+  /// each of their vertices must point back to an incident cell. Only
+  /// recorded cells and their neighbors' adjacency pointers are rewritten by
+  /// journaled operations, so from a valid starting state this replaces
+  /// Tds::is_valid() at a cost proportional to the footprint. Destroyed cells
+  /// are known from the footprint, not searched for in the triangulation.
+  /// @param triangulation Triangulation mutated through the journal.
+  /// @param footprint Cells touched since the triangulation was last valid.
+  /// @returns True if the touched region is combinatorially valid.
+  [[nodiscard]] inline auto is_locally_valid(
+      Delaunay_t<3> const&          triangulation,
+      UndoJournal::Footprint const& footprint) -> bool
+  {
+    auto const& tds           = triangulation.tds();
+    auto const  is_valid_cell = [&tds](Cell_handle_t<3> const& cell) {
+      if (!tds.is_valid(cell)) { return false; }
+      for (auto i = 0; i < 4; ++i)  // NOLINT
+      {
+        if (!tds.is_valid(cell->vertex(i))) { return false; }
+      }
+      return true;
+    };
+    return std::ranges::all_of(
+        footprint.live_cells(), [&](Cell_handle_t<3> const& cell) {
+          if (!is_valid_cell(cell)) { return false; }
+          for (auto i = 0; i < 4; ++i)  // NOLINT
+          {
+            if (!is_valid_cell(cell->neighbor(i))) { return false; }
+          }
+          return true;
+        });
+  }  // is_locally_valid
+
   /// FoliatedTriangulation class template
   /// @tparam dimension Dimensionality of triangulation
   template <int dimension>
@@ -1406,43 +3014,61 @@ namespace cdt::foliated_triangulations
   template <>
   class [[nodiscard("This contains data!")]] FoliatedTriangulation<3>  // NOLINT
   {
-    using Delaunay            = Delaunay_t<3>;
-    using Cell_handle         = Cell_handle_t<3>;
-    using Cell_container      = std::vector<Cell_handle>;
-    using Face_container      = std::vector<Facet_t<3>>;
-    using Edge_container      = std::vector<Edge_handle_t<3>>;
-    using Vertex_handle       = Vertex_handle_t<3>;
-    using Vertex_container    = std::vector<Vertex_handle>;
-    using Volume_entry        = std::pair<Int_precision, Facet_t<3>>;
-    using Volume_by_timeslice = std::vector<Volume_entry>;
-    using Delaunay_state      = detail::Delaunay_state<3>;
+   public:
+    /// Raw proposal domains, each kept in canonical rank order.
+    using Vertex_domain = RankedSet<Vertex_handle_t<3>>;
+    using Cell_domain   = RankedSet<Cell_handle_t<3>>;
+    using Edge_domain   = RankedSet<Edge_key, Simplex_key_hash>;
+    /// Persistent id tables for finite vertices and cells.
+    using Vertex_ids    = IdTable<Vertex_handle_t<3>>;
+    using Cell_ids      = IdTable<Cell_handle_t<3>>;
+
+   private:
+    using Delaunay         = Delaunay_t<3>;
+    using Cell_handle      = Cell_handle_t<3>;
+    using Vertex_handle    = Vertex_handle_t<3>;
+    using Cell_set         = IndexedSet<Cell_handle>;
+    using Facet_set        = IndexedSet<Facet_key, Simplex_key_hash>;
+    using Edge_set         = IndexedSet<Edge_key, Simplex_key_hash>;
+    using Vertex_stars     = StarTable<Vertex_handle_t<3>>;
+    using Edge_stars       = StarTable<Edge_key, Simplex_key_hash>;
+    using Timeslice_counts = std::vector<std::size_t>;
+    using Delaunay_state   = detail::Delaunay_state<3>;
 
     static_assert(std::is_nothrow_swappable_v<double>,
                   "FoliatedTriangulation swap requires non-throwing scalars.");
     static_assert(
         std::is_nothrow_swappable_v<Delaunay_state> &&
-            std::is_nothrow_swappable_v<Vertex_container> &&
-            std::is_nothrow_swappable_v<Cell_container> &&
-            std::is_nothrow_swappable_v<Face_container> &&
-            std::is_nothrow_swappable_v<Edge_container> &&
-            std::is_nothrow_swappable_v<Volume_by_timeslice>,
+            std::is_nothrow_swappable_v<Vertex_domain> &&
+            std::is_nothrow_swappable_v<Vertex_ids> &&
+            std::is_nothrow_swappable_v<Cell_ids> &&
+            std::is_nothrow_swappable_v<Cell_domain> &&
+            std::is_nothrow_swappable_v<Edge_domain> &&
+            std::is_nothrow_swappable_v<Cell_set> &&
+            std::is_nothrow_swappable_v<Facet_set> &&
+            std::is_nothrow_swappable_v<Edge_set> &&
+            std::is_nothrow_swappable_v<Vertex_stars> &&
+            std::is_nothrow_swappable_v<Edge_stars> &&
+            std::is_nothrow_swappable_v<Timeslice_counts>,
         "FoliatedTriangulation swap requires non-throwing container swaps.");
     static_assert(std::is_nothrow_swappable_v<Int_precision>,
                   "FoliatedTriangulation swap requires non-throwing bounds.");
     static_assert(
         std::is_nothrow_move_constructible_v<Delaunay_state> &&
-            std::is_nothrow_move_constructible_v<Vertex_container> &&
-            std::is_nothrow_move_constructible_v<Cell_container> &&
-            std::is_nothrow_move_constructible_v<Face_container> &&
-            std::is_nothrow_move_constructible_v<Edge_container> &&
-            std::is_nothrow_move_constructible_v<Volume_by_timeslice>,
+            std::is_nothrow_move_constructible_v<Vertex_domain> &&
+            std::is_nothrow_move_constructible_v<Vertex_ids> &&
+            std::is_nothrow_move_constructible_v<Cell_ids> &&
+            std::is_nothrow_move_constructible_v<Cell_domain> &&
+            std::is_nothrow_move_constructible_v<Edge_domain> &&
+            std::is_nothrow_move_constructible_v<Cell_set> &&
+            std::is_nothrow_move_constructible_v<Facet_set> &&
+            std::is_nothrow_move_constructible_v<Edge_set> &&
+            std::is_nothrow_move_constructible_v<Vertex_stars> &&
+            std::is_nothrow_move_constructible_v<Edge_stars> &&
+            std::is_nothrow_move_constructible_v<Timeslice_counts>,
         "FoliatedTriangulation move construction requires non-throwing member "
         "moves.");
 
-    [[nodiscard]] static auto cache_spacelike_facets(
-        Face_container const& faces) -> Volume_by_timeslice
-    { return collect_spacelike_facets<3>(std::span{faces}); }
-
     [[nodiscard]] static auto require_nonempty(Delaunay_state state)
         -> Delaunay_state
     {
@@ -1454,6 +3080,15 @@ namespace cdt::foliated_triangulations
       return state;
     }
 
+    [[nodiscard]] static auto is_spacelike(Facet_key const& facet) -> bool
+    {
+      return facet[0]->info() == facet[1]->info() &&
+             facet[1]->info() == facet[2]->info();
+    }
+
+    [[nodiscard]] static auto is_timelike(Edge_key const& edge) -> bool
+    { return edge[0]->info() != edge[1]->info(); }
+
     [[nodiscard]] auto triangulation() noexcept -> Delaunay&
     { return m_delaunay_state.mutable_triangulation_unchecked(); }
 
@@ -1462,23 +3097,77 @@ namespace cdt::foliated_triangulations
 
     /// Data members initialized in order of declaration (Working Draft,
     /// Standard for C++ Programming Language, 11.9.3 section 13.3)
-    Delaunay_state      m_delaunay_state;
-    double              m_initial_radius{INITIAL_RADIUS};
-    double              m_foliation_spacing{FOLIATION_SPACING};
-    Vertex_container    m_vertices;
-    Cell_container      m_cells;
-    Cell_container      m_three_one;
-    Cell_container      m_two_two;
-    Cell_container      m_one_three;
-    Face_container      m_faces;
-    Volume_by_timeslice m_spacelike_facets;
-    Edge_container      m_edges;
-    Edge_container      m_timelike_edges;
-    Edge_container      m_spacelike_edges;
-    Int_precision       m_max_timevalue{0};
-    Int_precision       m_min_timevalue{0};
-
-    [[nodiscard]] auto  has_consistent_structure() const -> bool
+    Delaunay_state   m_delaunay_state;
+    double           m_initial_radius{INITIAL_RADIUS};
+    double           m_foliation_spacing{FOLIATION_SPACING};
+    Vertex_domain    m_vertices;
+    Cell_set         m_cells;
+    Cell_set         m_three_one;
+    Cell_domain      m_two_two;
+    Cell_domain      m_one_three;
+    Facet_set        m_faces;
+    Facet_set        m_spacelike_facets;
+    Edge_set         m_edges;
+    Edge_domain      m_timelike_edges;
+    Edge_domain      m_spacelike_edges;
+    /// Star of each cached vertex and edge, patched with the other caches
+    Vertex_stars     m_vertex_stars;
+    Edge_stars       m_edge_stars;
+    Vertex_ids       m_vertex_ids;
+    Cell_ids         m_cell_ids;
+    /// Vertex count per timevalue, starting at m_min_timevalue
+    Timeslice_counts m_timeslice_vertices;
+    Int_precision    m_max_timevalue{0};
+    Int_precision    m_min_timevalue{0};
+
+    /// @returns True if @p vertex is cached, hence live and finite.
+    /// @details The handle is only compared, so it may be stale. Patching
+    /// brings the vertex cache up to date before any face is checked, so
+    /// liveness is decided without searching the triangulation's storage.
+    [[nodiscard]] auto is_finite_vertex(Vertex_handle const vertex) const
+        -> bool
+    { return m_vertices.contains(vertex); }
+
+    [[nodiscard]] auto is_finite_edge(Edge_key const& edge) const -> bool
+    {
+      Cell_handle cell;
+      int         first{0};
+      int         second{0};
+      return std::ranges::all_of(edge,
+                                 [this](Vertex_handle const vertex) {
+                                   return is_finite_vertex(vertex);
+                                 }) &&
+             triangulation().tds().is_edge(edge[0], edge[1], cell, first,
+                                           second);
+    }
+
+    /// @pre @p edge is a finite edge of the triangulation.
+    [[nodiscard]] auto edge_star_of(Edge_key const& edge) const -> Star
+    {
+      Cell_handle cell;
+      int         first{0};
+      int         second{0};
+      [[maybe_unused]] auto const found =
+          triangulation().tds().is_edge(edge[0], edge[1], cell, first, second);
+      assert(found);
+      return make_edge_star(triangulation(), {cell, first, second});
+    }
+
+    [[nodiscard]] auto is_finite_facet(Facet_key const& facet) const -> bool
+    {
+      Cell_handle cell;
+      int         first{0};
+      int         second{0};
+      int         third{0};
+      return std::ranges::all_of(facet,
+                                 [this](Vertex_handle const vertex) {
+                                   return is_finite_vertex(vertex);
+                                 }) &&
+             triangulation().tds().is_facet(facet[0], facet[1], facet[2], cell,
+                                            first, second, third);
+    }
+
+    [[nodiscard]] auto has_consistent_structure() const -> bool
     {
       auto const& delaunay = triangulation();
       auto const  cells_are_partitioned =
@@ -1487,10 +3176,21 @@ namespace cdt::foliated_triangulations
       auto const edges_are_partitioned =
           m_timelike_edges.size() + m_spacelike_edges.size() == m_edges.size();
       auto const time_bounds_are_valid =
-          m_vertices.empty() ? m_max_timevalue == 0 && m_min_timevalue == 0
-                             : m_min_timevalue <= m_max_timevalue;
+          m_vertices.empty()
+              ? m_timeslice_vertices.empty() && m_max_timevalue == 0 &&
+                    m_min_timevalue == 0
+              : m_min_timevalue <= m_max_timevalue &&
+                    std::cmp_equal(m_max_timevalue - m_min_timevalue + 1,
+                                   m_timeslice_vertices.size()) &&
+                    std::reduce(m_timeslice_vertices.begin(),
+                                m_timeslice_vertices.end(), std::size_t{0}) ==
+                        m_vertices.size();
       return m_delaunay_state.has_consistent_lock_binding() &&
              m_vertices.size() == delaunay.number_of_vertices() &&
+             m_vertex_ids.size() == m_vertices.size() &&
+             m_cell_ids.size() == m_cells.size() &&
+             m_vertex_stars.size() == m_vertices.size() &&
+             m_edge_stars.size() == m_edges.size() &&
              m_spacelike_facets.size() <= m_faces.size() &&
              cells_are_partitioned && edges_are_partitioned &&
              time_bounds_are_valid;
@@ -1508,39 +3208,219 @@ namespace cdt::foliated_triangulations
         return false;
       }
 
-      auto const& tds            = delaunay.tds();
-      auto const  valid_vertices = std::ranges::all_of(
-          m_vertices,
-          [&tds](Vertex_handle const vertex) { return tds.is_vertex(vertex); });
+      // The counts match, so each cache holds exactly the finite simplices
+      // if it holds every one of them.
+      auto const valid_vertices = std::ranges::all_of(
+          delaunay.finite_vertex_handles(), [this](Vertex_handle const vertex) {
+            return m_vertices.contains(vertex) && m_vertex_ids.contains(vertex);
+          });
       auto const valid_cells = std::ranges::all_of(
-          m_cells,
-          [&tds](Cell_handle const cell) { return tds.is_cell(cell); });
-      auto const valid_faces =
-          std::ranges::all_of(m_faces, [&tds](auto const& face) {
-            return tds.is_facet(face.first, face.second);
+          delaunay.finite_cell_handles(), [this](Cell_handle const cell) {
+            return m_cells.contains(cell) && m_cell_ids.contains(cell);
           });
+      auto const valid_faces = std::ranges::all_of(
+          m_faces,
+          [this](Facet_key const& facet) { return is_finite_facet(facet); });
       auto const valid_edges =
-          std::ranges::all_of(m_edges, [&tds](auto const& edge) {
-            return tds.is_valid(edge.first, edge.second, edge.third);
+          std::ranges::all_of(m_edges, [this](Edge_key const& edge) {
+            return is_finite_edge(edge);
           });
       if (!valid_vertices || !valid_cells || !valid_faces || !valid_edges)
       {
         return false;
       }
 
-      if (m_three_one != filter_cells<3>(m_cells, CellType::THREE_ONE) ||
-          m_two_two != filter_cells<3>(m_cells, CellType::TWO_TWO) ||
-          m_one_three != filter_cells<3>(m_cells, CellType::ONE_THREE) ||
-          m_spacelike_facets != cache_spacelike_facets(m_faces) ||
-          m_timelike_edges != filter_edges<3>(m_edges, EdgeType::TIMELIKE) ||
-          m_spacelike_edges != filter_edges<3>(m_edges, EdgeType::SPACELIKE))
+      // Indexed caches have no canonical order, so each subcomplex must be
+      // exactly the members of its parent that satisfy the predicate.
+      auto const is_filtered = [](auto const& parent, auto const& subset,
+                                  auto const& predicate) {
+        return std::cmp_equal(std::ranges::count_if(parent, predicate),
+                              subset.size()) &&
+               std::ranges::all_of(subset, [&](auto const& element) {
+                 return parent.contains(element) && predicate(element);
+               });
+      };
+      auto const has_type = [](CellType const type) {
+        return [type](Cell_handle const cell) {
+          return cell->info() == static_cast<int>(type);
+        };
+      };
+      auto const is_spacelike_edge = [](Edge_key const& edge) {
+        return !is_timelike(edge);
+      };
+      if (!is_filtered(m_cells, m_three_one, has_type(CellType::THREE_ONE)) ||
+          !is_filtered(m_cells, m_two_two, has_type(CellType::TWO_TWO)) ||
+          !is_filtered(m_cells, m_one_three, has_type(CellType::ONE_THREE)) ||
+          !is_filtered(m_faces, m_spacelike_facets, is_spacelike) ||
+          !is_filtered(m_edges, m_timelike_edges, is_timelike) ||
+          !is_filtered(m_edges, m_spacelike_edges, is_spacelike_edge))
+      {
+        return false;
+      }
+      if (!m_vertices.is_ranked() || !m_two_two.is_ranked() ||
+          !m_one_three.is_ranked() || !m_timelike_edges.is_ranked() ||
+          !m_spacelike_edges.is_ranked())
+      {
+        return false;
+      }
+      if (!std::ranges::all_of(m_vertices,
+                               [this, &delaunay](Vertex_handle const vertex) {
+                                 return m_vertex_stars.find(vertex) ==
+                                        make_vertex_star(delaunay, vertex);
+                               }) ||
+          !std::ranges::all_of(m_edges, [this](Edge_key const& edge) {
+            return m_edge_stars.find(edge) == edge_star_of(edge);
+          }))
       {
         return false;
       }
 
       if (m_vertices.empty()) { return true; }
-      return m_max_timevalue == find_max_timevalue<3>(std::span{m_vertices}) &&
-             m_min_timevalue == find_min_timevalue<3>(std::span{m_vertices});
+      Timeslice_counts counts(m_timeslice_vertices.size(), 0);
+      for (auto const& vertex : m_vertices)
+      {
+        auto const timevalue = vertex->info();
+        if (timevalue < m_min_timevalue || timevalue > m_max_timevalue)
+        {
+          return false;
+        }
+        ++counts[static_cast<std::size_t>(timevalue - m_min_timevalue)];
+      }
+      return counts == m_timeslice_vertices && counts.front() != 0 &&
+             counts.back() != 0;
+    }
+
+    void count_timevalue(Int_precision const timevalue)
+    {
+      if (m_timeslice_vertices.empty())
+      {
+        m_timeslice_vertices.assign(1, 0);
+        m_min_timevalue = timevalue;
+        m_max_timevalue = timevalue;
+      }
+      else if (timevalue < m_min_timevalue)
+      {
+        m_timeslice_vertices.insert(
+            m_timeslice_vertices.begin(),
+            static_cast<std::size_t>(m_min_timevalue - timevalue), 0);
+        m_min_timevalue = timevalue;
+      }
+      else if (timevalue > m_max_timevalue)
+      {
+        m_timeslice_vertices.resize(
+            static_cast<std::size_t>(timevalue - m_min_timevalue + 1), 0);
+        m_max_timevalue = timevalue;
+      }
+      ++m_timeslice_vertices[static_cast<std::size_t>(timevalue -
+                                                      m_min_timevalue)];
+    }  // count_timevalue
+
+    void uncount_timevalue(Int_precision const timevalue)
+    {
+      assert(timevalue >= m_min_timevalue && timevalue <= m_max_timevalue);
+      --m_timeslice_vertices[static_cast<std::size_t>(timevalue -
+                                                      m_min_timevalue)];
+      while (!m_timeslice_vertices.empty() && m_timeslice_vertices.back() == 0)
+      {
+        m_timeslice_vertices.pop_back();
+        --m_max_timevalue;
+      }
+      auto const empty_front = std::ranges::find_if(
+          m_timeslice_vertices,
+          [](std::size_t const count) { return count != 0; });
+      m_min_timevalue += static_cast<Int_precision>(
+          std::distance(m_timeslice_vertices.begin(), empty_front));
+      m_timeslice_vertices.erase(m_timeslice_vertices.begin(), empty_front);
+      if (m_timeslice_vertices.empty())
+      {
+        m_min_timevalue = 0;
+        m_max_timevalue = 0;
+      }
+    }  // uncount_timevalue
+
+    /// @brief Cache a finite vertex, classifying it from its embedding.
+    /// @details A vertex restored by a rollback keeps its former id. The id
+    /// is settled before ranking because it breaks ties between coincident
+    /// vertices.
+    void insert_vertex(Vertex_handle const vertex)
+    {
+      vertex->info() = expected_timevalue(vertex);
+      if (m_vertices.contains(vertex)) { return; }
+      m_vertex_ids.claim(vertex);
+      m_vertices.insert(vertex);
+      count_timevalue(vertex->info());
+    }
+
+    /// @brief Cache a finite cell, classifying it from its vertices.
+    /// @details A cell reused by a flip keeps its id if it is still free.
+    void insert_cell(Cell_handle const cell)
+    {
+      cell->info() = static_cast<int>(expected_cell_type<3>(cell));
+      if (!m_cells.insert(cell)) { return; }
+      m_cell_ids.claim(cell);
+      switch (static_cast<CellType>(cell->info()))
+      {
+        case CellType::THREE_ONE: m_three_one.insert(cell); break;
+        case CellType::TWO_TWO: m_two_two.insert(cell); break;
+        case CellType::ONE_THREE: m_one_three.insert(cell); break;
+        default: break;
+      }
+    }
+
+    /// @brief Forget a cell that may since have been destroyed or reused.
+    void erase_cell(Cell_handle const cell)
+    {
+      if (!m_cells.erase(cell)) { return; }
+      // The handle may have been reused, so its info cannot be trusted.
+      m_three_one.erase(cell);
+      m_two_two.erase(cell);
+      m_one_three.erase(cell);
+    }
+
+    void insert_facet(Facet_key const& facet)
+    {
+      if (m_faces.insert(facet) && is_spacelike(facet))
+      {
+        m_spacelike_facets.insert(facet);
+      }
+    }
+
+    /// @pre Every cell around @p edge is cached and classified.
+    void insert_edge(Edge_key const& edge)
+    {
+      if (!m_edges.insert(edge)) { return; }
+      if (is_timelike(edge)) { m_timelike_edges.insert(edge); }
+      else { m_spacelike_edges.insert(edge); }
+      m_edge_stars[edge] = edge_star_of(edge);
+    }
+
+    /// @brief Make the cache entry for @p facet agree with the triangulation.
+    void update_facet(Facet_key const& facet)
+    {
+      m_spacelike_facets.erase(facet);
+      m_faces.erase(facet);
+      if (is_finite_facet(facet)) { insert_facet(facet); }
+    }
+
+    /// @brief Make the cache entry for @p edge agree with the triangulation.
+    void update_edge(Edge_key const& edge)
+    {
+      m_timelike_edges.erase(edge);
+      m_spacelike_edges.erase(edge);
+      m_edges.erase(edge);
+      m_edge_stars.erase(edge);
+      if (is_finite_edge(edge)) { insert_edge(edge); }
+    }
+
+    /// @brief Make the star recorded for @p vertex agree with the
+    /// triangulation.
+    void update_vertex_star(Vertex_handle const vertex)
+    {
+      m_vertex_stars.erase(vertex);
+      if (is_finite_vertex(vertex))
+      {
+        m_vertex_stars[vertex] = make_vertex_star(triangulation(), vertex);
+      }
     }
 
    public:
@@ -1623,6 +3503,11 @@ namespace cdt::foliated_triangulations
       swap(swap_from.m_edges, swap_into.m_edges);
       swap(swap_from.m_timelike_edges, swap_into.m_timelike_edges);
       swap(swap_from.m_spacelike_edges, swap_into.m_spacelike_edges);
+      swap(swap_from.m_vertex_stars, swap_into.m_vertex_stars);
+      swap(swap_from.m_edge_stars, swap_into.m_edge_stars);
+      swap(swap_from.m_vertex_ids, swap_into.m_vertex_ids);
+      swap(swap_from.m_cell_ids, swap_into.m_cell_ids);
+      swap(swap_from.m_timeslice_vertices, swap_into.m_timeslice_vertices);
       swap(swap_from.m_max_timevalue, swap_into.m_max_timevalue);
       swap(swap_from.m_min_timevalue, swap_into.m_min_timevalue);
 
@@ -1650,19 +3535,185 @@ namespace cdt::foliated_triangulations
         : m_delaunay_state{require_nonempty(std::move(state))}
         , m_initial_radius{initial_radius}
         , m_foliation_spacing{foliation_spacing}
-        , m_vertices{classify_vertices(collect_vertices<3>(triangulation()))}
-        , m_cells{classify_cells(collect_cells<3>(triangulation()))}
-        , m_three_one{filter_cells<3>(m_cells, CellType::THREE_ONE)}
-        , m_two_two{filter_cells<3>(m_cells, CellType::TWO_TWO)}
-        , m_one_three{filter_cells<3>(m_cells, CellType::ONE_THREE)}
-        , m_faces{collect_faces()}
-        , m_spacelike_facets{cache_spacelike_facets(m_faces)}
-        , m_edges{foliated_triangulations::collect_edges<3>(triangulation())}
-        , m_timelike_edges{filter_edges<3>(m_edges, EdgeType::TIMELIKE)}
-        , m_spacelike_edges{filter_edges<3>(m_edges, EdgeType::SPACELIKE)}
-        , m_max_timevalue{find_max_timevalue<3>(std::span{m_vertices})}
-        , m_min_timevalue{find_min_timevalue<3>(std::span{m_vertices})}
-    {}
+    {
+      initialize_derived_state();
+    }
+
+    /// @brief Classify the owned triangulation and collect every cache.
+    /// @details Vertex and cell metadata are rewritten from the embedding.
+    /// Proposal domains are ranked with one sort each rather than by repeated
+    /// ordered insertion. Ids already carried by a copied or reloaded
+    /// triangulation are kept; the rest are assigned in point order for
+    /// vertices and iteration order for cells. Vertex ids are assigned first
+    /// because they break ranking ties between coincident vertices.
+    void initialize_derived_state()
+    {
+      auto const& delaunay = triangulation();
+      auto const  cells    = delaunay.number_of_cells();
+      m_cells.reserve(cells);
+      // Euler characteristic zero with two facets per cell.
+      m_faces.reserve(2 * cells);
+      m_edges.reserve(cells + delaunay.number_of_vertices());
+
+      std::vector<Vertex_handle> vertices;
+      for (auto const& vertex : delaunay.finite_vertex_handles())
+      {
+        vertex->info() = expected_timevalue(vertex);
+        count_timevalue(vertex->info());
+        vertices.push_back(vertex);
+      }
+      std::ranges::stable_sort(
+          vertices, point_precedes,
+          [](Vertex_handle const& vertex) -> Point_t<3> const& {
+            return vertex->point();
+          });
+      m_vertex_ids = Vertex_ids{vertices};
+      m_vertices   = Vertex_domain{vertices};
+
+      std::vector<Cell_handle> cells;
+      std::vector<Cell_handle> two_two;
+      std::vector<Cell_handle> one_three;
+      for (auto const& cell : delaunay.finite_cell_handles())
+      {
+        cell->info() = static_cast<int>(expected_cell_type<3>(cell));
+        m_cells.insert(cell);
+        cells.push_back(cell);
+        switch (static_cast<CellType>(cell->info()))
+        {
+          case CellType::THREE_ONE: m_three_one.insert(cell); break;
+          case CellType::TWO_TWO: two_two.push_back(cell); break;
+          case CellType::ONE_THREE: one_three.push_back(cell); break;
+          default: break;
+        }
+      }
+      m_cell_ids = Cell_ids{cells};
+      m_two_two   = Cell_domain{std::move(two_two)};
+      m_one_three = Cell_domain{std::move(one_three)};
+
+      for (auto const& facet : delaunay.finite_facets())
+      {
+        insert_facet(make_facet_key(facet));
+      }
+
+      std::vector<Edge_key> timelike;
+      std::vector<Edge_key> spacelike;
+      for (auto const& edge : delaunay.finite_edges())
+      {
+        auto const key = make_edge_key(edge);
+        m_edges.insert(key);
+        (is_timelike(key) ? timelike : spacelike).push_back(key);
+      }
+      m_timelike_edges  = Edge_domain{std::move(timelike)};
+      m_spacelike_edges = Edge_domain{std::move(spacelike)};
+
+      // Accumulate every star in one pass over the cells and edges rather
+      // than circulating around each simplex.
+      m_vertex_stars.reserve(m_vertices.size());
+      m_edge_stars.reserve(m_edges.size());
+      for (auto const& vertex : m_vertices) { m_vertex_stars[vertex] = {}; }
+      for (auto const& edge : m_edges) { m_edge_stars[edge] = {}; }
+      for (auto const& cell : delaunay.all_cell_handles())
+      {
+        for (auto i = 0; i < 4; ++i)  // NOLINT
+        {
+          auto const vertex = cell->vertex(i);
+          if (delaunay.is_infinite(vertex)) { continue; }
+          m_vertex_stars[vertex].count(delaunay, cell);
+          for (auto j = i + 1; j < 4; ++j)  // NOLINT
+          {
+            if (delaunay.is_infinite(cell->vertex(j))) { continue; }
+            m_edge_stars[make_simplex_key<2>({vertex, cell->vertex(j)})].count(
+                delaunay, cell);
+          }
+        }
+      }
+      for (auto const& edge : delaunay.all_edges())
+      {
+        for (auto const index : {edge.second, edge.third})
+        {
+          auto const vertex = edge.first->vertex(index);
+          if (delaunay.is_infinite(vertex)) { continue; }
+          ++m_vertex_stars[vertex].degree;
+        }
+      }
+    }  // initialize_derived_state
+
+    /// @brief Patch the derived caches after journaled mutations.
+    /// @details Only simplices bounding a footprint cell can have been created
+    /// or destroyed, so each of them is checked against the triangulation and
+    /// its cache entry and classification are made to agree. Likewise only
+    /// the vertices and edges of a footprint cell can have a changed star.
+    /// Which vertices and cells are live is read from the footprint, so the
+    /// work is proportional to the footprint rather than to the triangulation.
+    /// @param footprint Cells and vertices touched since the caches were last
+    /// consistent.
+    void patch_derived_state(UndoJournal::Footprint const& footprint)
+    {
+      auto const& delaunay = triangulation();
+      // Erase before inserting so that reused handles are cached afresh and
+      // released ids can be reclaimed.
+      for (auto const& [vertex, timevalue, id] : footprint.removed_vertices)
+      {
+        if (m_vertices.erase(vertex)) { uncount_timevalue(timevalue); }
+        m_vertex_ids.release(id, vertex);
+        m_vertex_stars.erase(vertex);
+      }
+      for (auto const& vertex : footprint.inserted_vertices)
+      {
+        insert_vertex(vertex);
+      }
+      for (auto const& touched : footprint.cells)
+      {
+        m_cell_ids.release(touched.id, touched.cell);
+        erase_cell(touched.cell);
+      }
+
+      std::vector<Vertex_handle> stars{footprint.inserted_vertices.begin(),
+                                       footprint.inserted_vertices.end()};
+      std::vector<Facet_key>     facets;
+      std::vector<Edge_key>      edges;
+      auto const                 collect_faces =
+          [&stars, &facets,
+           &edges](std::array<Vertex_handle, 4> const& vertices) {
+            stars.insert(stars.end(), vertices.begin(), vertices.end());
+            for (auto i = 0; i < 4; ++i)  // NOLINT
+            {
+              facets.push_back(make_simplex_key<3>(
+                  {vertices[(i + 1) % 4], vertices[(i + 2) % 4],
+                   vertices[(i + 3) % 4]}));
+              for (auto j = i + 1; j < 4; ++j)  // NOLINT
+              {
+                edges.push_back(
+                    make_simplex_key<2>({vertices[i], vertices[j]}));
+              }
+            }
+          };
+      for (auto const& touched : footprint.cells)
+      {
+        collect_faces(touched.vertices);
+      }
+      for (auto const& cell : footprint.live_cells())
+      {
+        collect_faces({cell->vertex(0), cell->vertex(1), cell->vertex(2),
+                       cell->vertex(3)});
+        if (!delaunay.is_infinite(cell)) { insert_cell(cell); }
+      }
+
+      std::ranges::sort(facets, std::less<>{});
+      std::ranges::sort(edges, std::less<>{});
+      auto const last_facet = std::ranges::unique(facets).begin();
+      auto const last_edge  = std::ranges::unique(edges).begin();
+      std::for_each(facets.begin(), last_facet,
+                    [this](Facet_key const& facet) { update_facet(facet); });
+      std::for_each(edges.begin(), last_edge,
+                    [this](Edge_key const& edge) { update_edge(edge); });
+      // A vertex's star changes only if one of its cells was touched.
+      std::ranges::sort(stars, std::less<>{});
+      std::for_each(stars.begin(), std::ranges::unique(stars).begin(),
+                    [this](Vertex_handle const vertex) {
+                      update_vertex_star(vertex);
+                    });
+    }  // patch_derived_state
 
    public:
     /// @brief Constructor with a caller-owned initialization stream.
@@ -1751,6 +3802,42 @@ namespace cdt::foliated_triangulations
       return has_consistent_structure() && is_tds_valid() && check_all_cells();
     }
 
+    /// @return True if the structural and causal invariants hold around
+    /// @p footprint
+    /// @details The local counterpart of is_structurally_correct() for a
+    /// state that was structurally correct before the footprint's mutations
+    /// and whose caches have since been patched. Adjacency and orientation
+    /// are checked by is_locally_valid(); every live finite touched cell must
+    /// be cached, registered, and correctly classified, and every vertex of
+    /// one must be cached and registered with a timevalue inside the
+    /// foliation's bounds.
+    /// @param footprint Cells and vertices touched since the last correct
+    /// state.
+    [[nodiscard]] auto is_locally_correct(
+        UndoJournal::Footprint const& footprint) const -> bool
+    {
+      auto const& delaunay = triangulation();
+      if (!has_consistent_structure() ||
+          !is_locally_valid(delaunay, footprint))
+      {
+        return false;
+      }
+      auto const is_foliated = [this](Vertex_handle const vertex) {
+        return m_vertices.contains(vertex) && m_vertex_ids.contains(vertex) &&
+               vertex->info() >= m_min_timevalue &&
+               vertex->info() <= m_max_timevalue;
+      };
+      return std::ranges::all_of(
+          footprint.live_cells(), [&](Cell_handle const& cell) {
+            if (delaunay.is_infinite(cell)) { return true; }
+            return m_cells.contains(cell) && m_cell_ids.contains(cell) &&
+                   is_cell_type_correct<3>(cell) &&
+                   is_foliated(cell->vertex(0)) &&
+                   is_foliated(cell->vertex(1)) &&
+                   is_foliated(cell->vertex(2)) && is_foliated(cell->vertex(3));
+          });
+    }
+
     /// @return True if the essential simulation-state invariants hold.
     /// @details This deliberately checks TDS, causal, and structural
     /// consistency without requiring the geometric Delaunay predicate, which
@@ -1788,6 +3875,124 @@ namespace cdt::foliated_triangulations
       return changed;
     }  // is_fixed
 
+    /// @brief In-place mutation scope with journaled rollback.
+    /// @details A transaction lends the owned triangulation together with an
+    /// UndoJournal. Callers mutate the triangulation only through the journal,
+    /// then stage() to patch the derived caches around the journal's footprint
+    /// for inspection. Staging and rollback cost time proportional to the
+    /// touched cells, not to the triangulation. commit()
+    /// keeps the mutation; rollback(), or destroying an open transaction,
+    /// restores the triangulation and caches that existed at
+    /// begin_transaction(). Handles borrowed before either outcome must be
+    /// reacquired. The owner must not be copied, moved, or swapped while a
+    /// transaction is open.
+    class Transaction
+    {
+      FoliatedTriangulation* m_owner;
+      UndoJournal            m_journal;
+      UndoJournal::Footprint m_staged;
+      bool                   m_open{true};
+
+      /// @brief Patch the derived caches around the journal's footprint.
+      void patch_footprint()
+      {
+        auto footprint = m_journal.take_footprint();
+        m_owner->patch_derived_state(footprint);
+        auto const append = [](auto& into, auto const& from) {
+          into.insert(into.end(), from.begin(), from.end());
+        };
+        append(m_staged.cells, footprint.cells);
+        for (auto const& removed : footprint.removed_vertices)
+        {
+          std::erase(m_staged.inserted_vertices, removed.vertex);
+        }
+        append(m_staged.inserted_vertices, footprint.inserted_vertices);
+        append(m_staged.removed_vertices, footprint.removed_vertices);
+      }
+
+     public:
+      /// @param owner Triangulation mutated in place.
+      explicit Transaction(FoliatedTriangulation& owner) noexcept
+          : m_owner{&owner}, m_journal{owner.m_vertex_ids}
+      {}
+
+      Transaction(Transaction const&)                    = delete;
+      auto operator=(Transaction const&) -> Transaction& = delete;
+      auto operator=(Transaction&&) -> Transaction&      = delete;
+
+      /// @param other Transaction whose scope is transferred.
+      Transaction(Transaction&& other) noexcept
+          : m_owner{other.m_owner}
+          , m_journal{std::move(other.m_journal)}
+          , m_staged{std::move(other.m_staged)}
+          , m_open{std::exchange(other.m_open, false)}
+      {}
+
+      /// @brief Roll back an open transaction.
+      /// @details A failed rollback means the triangulation was mutated
+      /// outside the journal; terminating is preferable to continuing with a
+      /// corrupt simulation state.
+      ~Transaction()
+      {
+        if (m_open) { rollback(); }
+      }
+
+      /// @return The triangulation to mutate through journal().
+      [[nodiscard]] auto triangulation() noexcept -> Delaunay&
+      { return m_owner->triangulation(); }
+
+      /// @return The journal recording mutations of triangulation().
+      [[nodiscard]] auto journal() noexcept -> UndoJournal&
+      { return m_journal; }
+
+      /// @return The triangulation being mutated, including staged caches.
+      [[nodiscard]] auto foliation() const noexcept
+          -> FoliatedTriangulation const&
+      { return *m_owner; }
+
+      /// @return True until commit() or rollback().
+      [[nodiscard]] auto is_open() const noexcept -> bool { return m_open; }
+
+      /// @return Every cell and vertex touched by the staged mutations and,
+      /// once rolled back, by the rollback as well.
+      /// @details After rollback() this is everything whose cached state may
+      /// differ from that at begin_transaction(), so derived structures kept
+      /// beside the caches can be patched from it rather than rebuilt.
+      [[nodiscard]] auto staged_footprint() const noexcept
+          -> UndoJournal::Footprint const&
+      { return m_staged; }
+
+      /// @brief Patch derived caches so the mutation can be inspected.
+      void stage() { patch_footprint(); }
+
+      /// @brief Keep the mutation and close the transaction.
+      void commit()
+      {
+        if (!m_open) { return; }
+        stage();
+        m_journal.clear();
+        m_open = false;
+      }
+
+      /// @brief Undo the mutation and close the transaction.
+      /// @throws std::logic_error if the journal cannot be replayed.
+      void rollback()
+      {
+        if (!m_open) { return; }
+        m_open = false;
+        if (!m_journal.empty())
+        {
+          m_journal.rollback(m_owner->triangulation());
+        }
+        patch_footprint();
+      }
+    };
+
+    /// @brief Open an in-place mutation scope.
+    /// @return A transaction that rolls back unless committed.
+    [[nodiscard]] auto begin_transaction() noexcept -> Transaction
+    { return Transaction{*this}; }
+
     /// @return An owning snapshot of the Delaunay triangulation
     /// @details Mutating the returned value cannot invalidate this object's
     /// cached topology classifications.
@@ -1800,22 +4005,17 @@ namespace cdt::foliated_triangulations
     }  // delaunay_snapshot
 
     /// @return Number of 3D simplices in triangulation data structure
-    [[nodiscard]] auto number_of_finite_cells() const
-    {
-      return triangulation().number_of_finite_cells();
-    }  // number_of_finite_cells
+    /// @details Read from the cached subcomplex; CGAL counts by iteration.
+    [[nodiscard]] auto number_of_finite_cells() const noexcept -> std::size_t
+    { return m_cells.size(); }  // number_of_finite_cells
 
     /// @return Number of 2D faces in triangulation data structure
-    [[nodiscard]] auto number_of_finite_facets() const
-    {
-      return triangulation().number_of_finite_facets();
-    }  // number_of_finite_facets
+    [[nodiscard]] auto number_of_finite_facets() const noexcept -> std::size_t
+    { return m_faces.size(); }  // number_of_finite_facets
 
     /// @return Number of 1D edges in triangulation data structure
-    [[nodiscard]] auto number_of_finite_edges() const
-    {
-      return triangulation().number_of_finite_edges();
-    }  // number_of_finite_edges
+    [[nodiscard]] auto number_of_finite_edges() const noexcept -> std::size_t
+    { return m_edges.size(); }  // number_of_finite_edges
 
     /// @return Number of vertices in triangulation data structure
     [[nodiscard]] auto number_of_vertices() const
@@ -1826,13 +4026,15 @@ namespace cdt::foliated_triangulations
 
     /// @param timevalue Timeslice whose facets are counted.
     /// @return Number of spacelike facets on the requested timeslice.
+    /// @details Scans the spacelike facets, which are kept unordered so that
+    /// moves can patch them in place.
     [[nodiscard]] auto spacelike_face_count(
         Int_precision const timevalue) const noexcept -> std::size_t
     {
-      auto const matching_facets = std::ranges::equal_range(
-          m_spacelike_facets, timevalue, std::ranges::less{},
-          [](Volume_entry const& entry) noexcept { return entry.first; });
-      return static_cast<std::size_t>(matching_facets.size());
+      return static_cast<std::size_t>(std::ranges::count_if(
+          m_spacelike_facets, [timevalue](Facet_key const& facet) noexcept {
+            return facet[0]->info() == timevalue;
+          }));
     }
 
     /// @return Total number of spacelike facets
@@ -1944,7 +4146,7 @@ namespace cdt::foliated_triangulations
     {
       for (auto const& edge : m_edges)
       {
-        if (classify_edge<3>(edge) == EdgeType::TIMELIKE)
+        if (is_timelike(edge))
         {
           fmt::print("==> timelike\n");
         }
@@ -1955,6 +4157,54 @@ namespace cdt::foliated_triangulations
       }
     }  // print_edges
 
+    /// @param id Persistent vertex id
+    /// @return The finite vertex registered under @p id, if any
+    [[nodiscard]] auto vertex_with_id(Simplex_id const id) const noexcept
+        -> std::optional<Vertex_handle>
+    { return m_vertex_ids.find(id); }
+
+    /// @param id Persistent cell id
+    /// @return The finite cell registered under @p id, if any
+    [[nodiscard]] auto cell_with_id(Simplex_id const id) const noexcept
+        -> std::optional<Cell_handle>
+    { return m_cell_ids.find(id); }
+
+    /// @return Finite vertices, the raw (6,2) proposal sites, by rank
+    [[nodiscard]] auto vertex_domain() const noexcept -> Vertex_domain const&
+    { return m_vertices; }
+
+    /// @return (2,2) cells, the raw (2,3) proposal sites, by rank
+    [[nodiscard]] auto two_two_domain() const noexcept -> Cell_domain const&
+    { return m_two_two; }
+
+    /// @return (1,3) cells, the raw (2,6) proposal sites, by rank
+    [[nodiscard]] auto one_three_domain() const noexcept -> Cell_domain const&
+    { return m_one_three; }
+
+    /// @return Timelike edges, the raw (3,2) proposal sites, by rank
+    [[nodiscard]] auto timelike_edge_domain() const noexcept
+        -> Edge_domain const&
+    { return m_timelike_edges; }
+
+    /// @return Spacelike edges, the raw (4,4) proposal sites, by rank
+    [[nodiscard]] auto spacelike_edge_domain() const noexcept
+        -> Edge_domain const&
+    { return m_spacelike_edges; }
+
+    /// @param vertex A vertex handle
+    /// @return The star of @p vertex if it is a cached finite vertex
+    /// @details A table lookup; the star is patched with the other caches.
+    [[nodiscard]] auto vertex_star(Vertex_handle const& vertex) const
+        -> std::optional<Star>
+    { return m_vertex_stars.find(vertex); }
+
+    /// @param edge A sorted edge key
+    /// @return The star of @p edge if it is a cached finite edge
+    /// @details A table lookup; the star is patched with the other caches.
+    [[nodiscard]] auto edge_star(Edge_key const& edge) const
+        -> std::optional<Star>
+    { return m_edge_stars.find(edge); }
+
     /// @brief Print the number of spacelike faces per timeslice
     void print_volume_per_timeslice() const
     {
@@ -2019,49 +4269,6 @@ namespace cdt::foliated_triangulations
           this->number_of_vertices(), this->number_of_finite_edges(),
           this->number_of_finite_facets(), this->number_of_finite_cells());
     }
-
-   private:
-    [[nodiscard]] auto classify_vertices(Vertex_container const& vertices) const
-        -> Vertex_container
-    {
-      assert(vertices.size() == number_of_vertices());
-      for (auto const& vertex : vertices)
-      {
-        vertex->info() = expected_timevalue(vertex);
-      }
-      return vertices;
-    }  // classify_vertices
-
-    /// @brief Classify cells
-    /// @param cells The container of simplices to classify
-    /// @return A container of simplices with CellType written to
-    /// cell->info()
-    [[nodiscard]] auto classify_cells(Cell_container const& cells) const
-        -> Cell_container
-    {
-      assert(cells.size() == number_of_finite_cells());
-      for (auto const& cell : cells)
-      {
-        cell->info() = static_cast<int>(expected_cell_type<3>(cell));
-      }
-      return cells;
-    }  // classify_cells
-
-    /// @return Container of all the finite facets in the triangulation
-    [[nodiscard]] auto collect_faces() const -> Face_container
-    {
-      // Somewhere in bistellar_flip_really a vertex is rendered invalid
-      assert(is_tds_valid());
-      Face_container init_faces;
-      init_faces.reserve(triangulation().number_of_finite_facets());
-      for (auto const& facet : triangulation().finite_facets())
-      {
-        assert(triangulation().tds().is_facet(facet.first, facet.second));
-        init_faces.emplace_back(facet);
-      }
-      assert(init_faces.size() == triangulation().number_of_finite_facets());
-      return init_faces;
-    }  // collect_faces
   };
 
   /// Three-dimensional foliated Delaunay triangulation.
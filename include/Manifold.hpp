@@ -190,6 +190,126 @@ namespace cdt::manifolds
       };
     }  // updated
 
+    /// @brief In-place mutation scope over the triangulation and geometry.
+    /// @details Wraps a triangulation transaction and remembers the geometry
+    /// and time bounds at begin_transaction(), so a staged proposal can be
+    /// compared with its source without a second manifold. stage() patches
+    /// the triangulation caches around the journaled footprint and rereads
+    /// the geometry from their sizes; rollback(), or destroying an
+    /// open transaction, restores both. The owner must not be copied, moved,
+    /// or swapped while a transaction is open.
+    class Transaction
+    {
+      Manifold*                  m_owner;
+      Triangulation::Transaction m_transaction;
+      Geometry                   m_initial_geometry;
+      Int_precision              m_initial_min_time;
+      Int_precision              m_initial_max_time;
+      bool                       m_staged{false};
+
+     public:
+      /// @param owner Manifold mutated in place.
+      explicit Transaction(Manifold& owner)
+          : m_owner{&owner}
+          , m_transaction{owner.m_triangulation.begin_transaction()}
+          , m_initial_geometry{owner.m_geometry}
+          , m_initial_min_time{owner.min_time()}
+          , m_initial_max_time{owner.max_time()}
+      {}
+
+      Transaction(Transaction const&)                    = delete;
+      Transaction(Transaction&&)                         = delete;
+      auto operator=(Transaction const&) -> Transaction& = delete;
+      auto operator=(Transaction&&) -> Transaction&      = delete;
+
+      /// @brief Roll back an open transaction.
+      ~Transaction()
+      {
+        if (is_open()) { rollback(); }
+      }
+
+      /// @returns The triangulation to mutate through journal().
+      [[nodiscard]] auto triangulation() noexcept -> Delaunay_t<3>&
+      { return m_transaction.triangulation(); }
+
+      /// @returns The journal recording mutations of triangulation().
+      [[nodiscard]] auto journal() noexcept
+          -> foliated_triangulations::UndoJournal&
+      { return m_transaction.journal(); }
+
+      /// @returns The manifold being mutated; caches are current once staged.
+      [[nodiscard]] auto manifold() const noexcept -> Manifold const&
+      { return *m_owner; }
+
+      /// @returns The triangulation being mutated, whose proposal domains are
+      /// ranked for site selection until the first mutation is journaled.
+      [[nodiscard]] auto foliation() const noexcept -> Triangulation const&
+      { return m_transaction.foliation(); }
+
+      /// @returns Geometry at begin_transaction().
+      [[nodiscard]] auto initial_geometry() const noexcept -> Geometry const&
+      { return m_initial_geometry; }
+
+      /// @returns Minimum timevalue at begin_transaction().
+      [[nodiscard]] auto initial_min_time() const noexcept -> Int_precision
+      { return m_initial_min_time; }
+
+      /// @returns Maximum timevalue at begin_transaction().
+      [[nodiscard]] auto initial_max_time() const noexcept -> Int_precision
+      { return m_initial_max_time; }
+
+      /// @returns True until commit() or rollback().
+      [[nodiscard]] auto is_open() const noexcept -> bool
+      { return m_transaction.is_open(); }
+
+      /// @returns Every cell and vertex touched by the staged mutations and,
+      /// once rolled back, by the rollback as well.
+      [[nodiscard]] auto staged_footprint() const noexcept
+          -> foliated_triangulations::UndoJournal::Footprint const&
+      { return m_transaction.staged_footprint(); }
+
+      /// @returns True if the structural and causal invariants hold around
+      /// every staged mutation.
+      /// @details Costs time proportional to the staged footprint rather than
+      /// to the triangulation; see
+      /// FoliatedTriangulation::is_locally_correct().
+      [[nodiscard]] auto is_locally_correct() const -> bool
+      {
+        return m_transaction.foliation().is_locally_correct(
+            m_transaction.staged_footprint());
+      }
+
+      /// @brief Patch triangulation caches and geometry for inspection.
+      void stage()
+      {
+        m_transaction.stage();
+        m_owner->m_geometry = Geometry{m_owner->m_triangulation};
+        m_staged            = true;
+      }
+
+      /// @brief Keep the mutation and close the transaction.
+      void commit()
+      {
+        if (!is_open()) { return; }
+        if (!m_staged) { stage(); }
+        m_transaction.commit();
+      }
+
+      /// @brief Undo the mutation and close the transaction.
+      /// @throws std::logic_error if the journal cannot be replayed.
+      void rollback()
+      {
+        if (!is_open()) { return; }
+        m_transaction.rollback();
+        m_owner->m_geometry = m_initial_geometry;
+      }
+    };
+
+    /// @brief Open an in-place mutation scope.
+    /// @returns A transaction that rolls back unless committed.
+    [[nodiscard]] auto begin_transaction() -> Transaction
+    { return Transaction{*this}; }
+
     /// @returns An owning snapshot of the canonical Delaunay triangulation
     /// @details Handles obtained from the snapshot cannot mutate this manifold
     /// or invalidate its derived geometry and topology caches.
@@ -17,14 +17,23 @@
 #ifndef INCLUDE_METROPOLIS_HPP_
 #define INCLUDE_METROPOLIS_HPP_
 
+#include <array>
+#include <chrono>
 #include <cmath>
+#include <cstddef>
 #include <cstdint>
+#include <ctime>
 #include <expected>
+#include <limits>
 #include <optional>
 #include <stdexcept>
+#include <string>
 #include <utility>
+#include <vector>
 
 // CDT headers
+#include "Autocorrelation.hpp"
+#include "Equilibration.hpp"
 #include "Ergodic_moves_3.hpp"
 #include "Move_run.hpp"
 #include "Move_strategy.hpp"
@@ -34,6 +43,62 @@
 
 namespace cdt
 {
+  /// @brief How a Metropolis strategy evaluates acceptance decisions
+  enum class AcceptanceEvaluation : std::uint8_t
+  {
+    /// Certified long-double bounds from the action table, falling back to
+    /// the MPFR oracle when the trial lies within their error interval
+    CERTIFIED,
+    /// Full MPFR actions, exponential, and proposal-probability quotient
+    MPFR_ORACLE
+  };
+
+  /// @param volume Volume-fixing term of a run's action.
+  /// @returns Its provenance, or an empty optional when it is disabled.
+  [[nodiscard]] inline auto volume_fixing_metadata(
+      s3_action::VolumeFixing const& volume)
+      -> std::optional<utilities::Volume_fixing_metadata>
+  {
+    if (!volume.enabled()) { return std::nullopt; }
+    return utilities::Volume_fixing_metadata{
+        .potential =
+            std::string{s3_action::volume_potential_name(volume.potential)},
+        .epsilon = volume.epsilon,
+        .target  = volume.target};
+  }
+
+  namespace detail
+  {
+    /// @returns CPU seconds consumed so far by the calling thread.
+    /// @details Process CPU time would also count an ensemble's other chains
+    /// and the checkpoint writer thread. Returns zero if the clock fails.
+    [[nodiscard]] inline auto thread_cpu_seconds() -> double
+    {
+#ifdef _WIN32
+      FILETIME creation{};
+      FILETIME exited{};
+      FILETIME kernel{};
+      FILETIME user{};
+      if (!::GetThreadTimes(::GetCurrentThread(), &creation, &exited, &kernel,
+                            &user))
+      {
+        return 0.0;
+      }
+      auto const ticks = [](FILETIME const& time) {
+        return (static_cast<std::uint64_t>(time.dwHighDateTime) << 32U) |
+               time.dwLowDateTime;
+      };
+      // FILETIME counts 100 ns intervals.
+      return static_cast<double>(ticks(kernel) + ticks(user)) * 1.0e-7;
+#else
+      timespec now{};
+      if (::clock_gettime(CLOCK_THREAD_CPUTIME_ID, &now) != 0) { return 0.0; }
+      return static_cast<double>(now.tv_sec) +
+             static_cast<double>(now.tv_nsec) * 1.0e-9;
+#endif
+    }
+  }  // namespace detail
+
   /// @brief Metropolis-Hastings algorithm strategy
   /// @details The Metropolis-Hastings algorithm is a Markov Chain Monte Carlo
   /// method. For target weight \f$\pi(T)\propto e^{-S(T)}\f$, a proposal from
@@ -46,6 +111,11 @@ namespace cdt
   /// [Metropolis-Hastings
   /// algorithm](../REFERENCES.md#metropolis-hastings-algorithm).
   ///
+  /// An optional volume-fixing potential \f$V(N_3)\f$ is added to
+  /// \f$S(T)\f$. With it enabled, a proposal is decided from the fixed
+  /// geometry delta of its move before any site is prepared, so proposals
+  /// far outside the volume window are rejected in constant time.
+  ///
   /// @tparam ManifoldType The type of Manifold on which to apply the algorithm
   template <typename ManifoldType>
     requires(ManifoldType::dimension == 3)
@@ -73,16 +143,68 @@ namespace cdt
 
       /// @brief Explicit self-transitions
       Counter rejected;
+
+      /// @brief Online autocorrelation of the state after each transition
+      autocorrelation::AutocorrelationMonitor autocorrelation;
+
+      /// @brief Chain-thread CPU seconds when the run started
+      double cpu_start{};
+
+      /// @brief Chain-thread CPU seconds used by the run's passes so far
+      double cpu_seconds{};
+
+      /// @brief Automatic burn-in that preceded this run, if enabled
+      std::optional<utilities::Burn_in_metadata> burn_in;
+
+      /// @brief Where the run's budget stopped it, if it stopped early
+      std::optional<utilities::Interruption_metadata> interruption;
     };
 
     using PassResult = detail::MovePassResult<ManifoldType, RunStatistics>;
+    using ActionFactors =
+        std::array<mpfr_values::Value, move_tracker::NUMBER_OF_3D_MOVES>;
+
+    /// @brief Directed long-double enclosure of one tabulated action factor
+    struct FactorBounds
+    {
+      long double lower;
+      long double upper;
+    };
+
+    using FactorBoundTable =
+        std::array<FactorBounds, move_tracker::NUMBER_OF_3D_MOVES>;
+
+    /// @brief Checkpointed run state that the next invocation continues
+    struct ResumePoint
+    {
+      MoveRunCadence                                  cadence;
+      RunStatistics                                   statistics;
+      CommandResults                                  command_results;
+      std::optional<utilities::Interruption_metadata> stopped_pass;
+    };
 
     /// @brief Validated physical parameters used by every action evaluation
     s3_action::PhysicalParameters m_parameters;
 
+    /// @brief Action factor of each move's fixed geometry delta, by move index
+    ActionFactors m_action_factors;
+
+    /// @brief Outward-rounded long-double bounds of m_action_factors
+    FactorBoundTable m_factor_bounds;
+
+    /// @brief Whether accepts() uses the table or the MPFR oracle
+    AcceptanceEvaluation m_acceptance_evaluation{
+        AcceptanceEvaluation::CERTIFIED};
+
     /// @brief Positive pass and checkpoint cadence
     MoveRunCadence m_cadence;
 
+    /// @brief Checkpoint spacing in units of \f$\tau_{int}\f$, if adaptive
+    std::optional<long double> m_checkpoint_tau_multiple;
+
+    /// @brief Maximum automatic burn-in passes, if burn-in is enabled
+    std::optional<Int_precision> m_burn_in_limit;
+
     /// @brief Whether checkpoint and final triangulation files may be written
     bool m_write_files{true};
 
@@ -90,6 +212,9 @@ namespace cdt
     cdt::Random m_generator{
         cdt::Random{}.split(cdt::random_streams::transitions)};
 
+    /// @brief Wall-clock deadline of every invocation, if budgeted
+    std::optional<std::chrono::steady_clock::time_point> m_deadline;
+
     /// @brief Immutable run provenance, refreshed with state at each output.
     utilities::Reproducibility_metadata m_reproducibility;
 
@@ -102,6 +227,12 @@ namespace cdt
     /// @brief Checkpoint events from the latest completed invocation
     Int_precision m_checkpoint_events{};
 
+    /// @brief Passes completed by the latest invocation
+    Int_precision m_completed_passes{};
+
+    /// @brief Checkpoint the next invocation continues, if resuming
+    std::optional<ResumePoint> m_resume;
+
     static void   record_transition(
         RunStatistics& statistics, move_tracker::MoveType const move,
         ergodic_moves::MoveOutcome const outcome) noexcept
@@ -115,6 +246,64 @@ namespace cdt
       ++statistics.transition_count;
     }
 
+    /// @returns The per-move values of @p counter, in move-index order.
+    [[nodiscard]] static auto counter_values(Counter const& counter)
+        -> std::vector<Int_precision>
+    {
+      auto const values = counter.moves_view();
+      return {values.begin(), values.end()};
+    }
+
+    /// @returns A counter holding @p values, one per move type.
+    /// @throws std::invalid_argument If @p values has the wrong length.
+    [[nodiscard]] static auto make_counter(
+        std::vector<Int_precision> const& values) -> Counter
+    {
+      if (values.size() != move_tracker::NUMBER_OF_3D_MOVES)
+      {
+        throw std::invalid_argument{
+            "Checkpoint counters do not match the move types."};
+      }
+      Counter counter;
+      for (auto index = std::size_t{}; index < values.size(); ++index)
+      {
+        counter[static_cast<gsl::index>(index)] = values[index];
+      }
+      return counter;
+    }
+
+    /// @returns \f$e^{-\Delta S}\f$ for the geometry delta of each move.
+    [[nodiscard]] static auto make_action_factors(
+        s3_action::PhysicalParameters const& parameters) -> ActionFactors
+    {
+      ActionFactors factors;
+      for (auto index = std::size_t{0};
+           index < move_tracker::NUMBER_OF_3D_MOVES; ++index)
+      {
+        auto const move  = *move_tracker::move_from_index(index);
+        auto const delta = *ergodic_moves::detail::moved_geometry(
+            Geometry<ManifoldType::dimension>{}, move);
+        factors[index] = mpfr_values::exponential(
+            mpfr_values::negate(s3_action::detail::linear_action(
+                parameters.bulk_coefficients(), delta.N1_TL, delta.N3_31_13,
+                delta.N3_22)));
+      }
+      return factors;
+    }
+
+    /// @returns Each factor rounded toward zero and toward infinity.
+    [[nodiscard]] static auto make_factor_bounds(ActionFactors const& factors)
+        -> FactorBoundTable
+    {
+      FactorBoundTable bounds{};
+      for (auto index = std::size_t{0}; index < factors.size(); ++index)
+      {
+        bounds[index] = {.lower = mpfr_get_ld(factors[index].fr(), MPFR_RNDD),
+                         .upper = mpfr_get_ld(factors[index].fr(), MPFR_RNDU)};
+      }
+      return bounds;
+    }
+
    public:
     MoveStrategy() = delete;
 
@@ -167,6 +356,8 @@ namespace cdt
         std::optional<utilities::Reproducibility_metadata> reproducibility =
             std::nullopt)
         : m_parameters{s3_action::make_physical_parameters(alpha, k, lambda)}
+        , m_action_factors{make_action_factors(m_parameters)}
+        , m_factor_bounds{make_factor_bounds(m_action_factors)}
         , m_cadence{detail::parse_move_run_cadence(passes, checkpoint,
                                                    "Metropolis")}
         , m_write_files{write_files}
@@ -241,6 +432,197 @@ namespace cdt
     /// @returns Whether the strategy writes checkpoint triangulation files
     [[nodiscard]] auto writes_files() const noexcept { return m_write_files; }
 
+    /// @returns How acceptance decisions are evaluated
+    [[nodiscard]] auto acceptance_evaluation() const noexcept
+    { return m_acceptance_evaluation; }
+
+    /// @returns The volume-fixing term added to the action
+    [[nodiscard]] auto volume_fixing() const noexcept
+        -> s3_action::VolumeFixing const&
+    { return m_parameters.volume_fixing(); }
+
+    /// @brief Add a volume-fixing potential to the sampled action.
+    /// @details The term is recorded in every subsequent provenance record.
+    /// @param volume The term used by subsequent transitions.
+    /// @throws std::invalid_argument If an enabled term is out of range.
+    void set_volume_fixing(s3_action::VolumeFixing const& volume)
+    {
+      m_parameters = s3_action::make_physical_parameters(alpha(), k(),
+                                                         lambda(), volume);
+      m_reproducibility.volume_fixing = volume_fixing_metadata(volume);
+    }
+
+    /// @brief Select the certified path or the MPFR verification oracle.
+    /// @details Both paths make the same decision for every trial value.
+    /// @param evaluation The evaluation used by subsequent transitions.
+    void set_acceptance_evaluation(
+        AcceptanceEvaluation const evaluation) noexcept
+    { m_acceptance_evaluation = evaluation; }
+
+    /// @brief Space checkpoint events by a multiple of \f$\tau_{int}\f$.
+    /// @details Until the first estimate is available, and when @p multiple
+    /// is empty, checkpoints follow the fixed cadence. Afterwards an event is
+    /// due once autocorrelation::checkpoint_interval() passes have elapsed
+    /// since the previous one.
+    /// @param multiple Integrated autocorrelation times between checkpoints,
+    /// or an empty optional for the fixed cadence.
+    /// @throws std::invalid_argument If @p multiple is not finite and
+    /// positive.
+    void set_adaptive_checkpoints(std::optional<long double> const multiple)
+    {
+      if (multiple && !(std::isfinite(*multiple) && *multiple > 0.0L))
+      {
+        throw std::invalid_argument{
+            "Adaptive checkpoint multiple must be finite and positive."};
+      }
+      m_checkpoint_tau_multiple = multiple;
+    }
+
+    /// @brief Precede every run with an automatic burn-in phase.
+    /// @details Burn-in runs whole passes, without checkpoints, until the
+    /// MSER test of equilibration::EquilibrationDetector passes on the
+    /// per-pass geometry or @p max_passes is reached. The configured passes
+    /// then run as production, and their counters, trace, autocorrelation
+    /// estimates, and metadata start afresh; the metadata records the burn-in
+    /// length.
+    /// @param max_passes Maximum burn-in passes, or an empty optional to
+    /// disable burn-in.
+    /// @throws std::invalid_argument If @p max_passes is not positive.
+    void set_burn_in(std::optional<Int_precision> const max_passes)
+    {
+      if (max_passes && *max_passes <= 0)
+      {
+        throw std::invalid_argument{"Burn-in pass limit must be positive."};
+      }
+      m_burn_in_limit = max_passes;
+    }
+
+    /// @brief Stop every invocation at a wall-clock deadline.
+    /// @details Before each transition, burn-in and production passes check
+    /// detail::RunBudget, which also honours detail::stop_signal with or
+    /// without a deadline. A run that must stop finishes its current
+    /// transition, checkpoints the partial pass, and returns; the metadata
+    /// records the passes completed and how far the stopped pass got. The
+    /// reserve kept before the deadline follows the measured checkpoint
+    /// writes, so the last checkpoint lands before it.
+    /// @param deadline Time by which output must be written, or an empty
+    /// optional for an unbounded run.
+    void set_deadline(
+        std::optional<std::chrono::steady_clock::time_point> const
+            deadline) noexcept
+    { m_deadline = deadline; }
+
+    /// @returns The wall-clock deadline, if the run is budgeted
+    [[nodiscard]] auto deadline() const noexcept { return m_deadline; }
+
+    /// @returns Passes completed by the latest invocation
+    [[nodiscard]] auto completed_passes() const noexcept
+    { return m_completed_passes; }
+
+    /// @returns Where the latest invocation stopped early, if it did
+    [[nodiscard]] auto interruption() const noexcept
+        -> std::optional<utilities::Interruption_metadata> const&
+    { return m_run_statistics.interruption; }
+
+    /// @brief Continue the next invocation from a checkpoint of this run.
+    /// @details The next invocation skips burn-in and starts after the
+    /// checkpoint's completed passes. A stopped pass is finished from its
+    /// recorded transition, with the attempts it started with. Counters,
+    /// `transition_trace`, the burn-in record, and the transition engine
+    /// continue from the recorded values, so, given the checkpoint's
+    /// triangulation, the result and the metadata of every later output
+    /// equal those of the uninterrupted run. Autocorrelation estimates and
+    /// the adaptive checkpoint schedule restart at the checkpoint.
+    /// @param checkpoint Provenance from utilities::read_resume_metadata().
+    /// @throws std::invalid_argument If @p checkpoint is not a resumable
+    /// checkpoint of a run with this seed, transition stream, and action,
+    /// was stopped during burn-in, or lies beyond the configured passes.
+    void resume_from(utilities::Reproducibility_metadata const& checkpoint)
+    {
+      auto const& resume = checkpoint.resume;
+      if (checkpoint.artifact != utilities::ArtifactKind::CHECKPOINT ||
+          !resume || !checkpoint.completed_passes ||
+          !checkpoint.transition_trace || !checkpoint.transition_count)
+      {
+        throw std::invalid_argument{
+            "Only a resumable Metropolis checkpoint can be resumed."};
+      }
+      if (checkpoint.seed != seed() || checkpoint.transition_stream != stream())
+      {
+        throw std::invalid_argument{
+            "Checkpoint was recorded with a different seed or transition "
+            "stream."};
+      }
+      if (checkpoint.alpha != alpha() || checkpoint.k != k() ||
+          checkpoint.lambda != lambda() ||
+          checkpoint.volume_fixing != volume_fixing_metadata(volume_fixing()))
+      {
+        throw std::invalid_argument{
+            "Checkpoint was recorded with a different action."};
+      }
+      auto const& burn_in = checkpoint.burn_in;
+      if (burn_in && !burn_in->equilibrated && burn_in->passes < burn_in->limit)
+      {
+        throw std::invalid_argument{
+            "A checkpoint stopped during burn-in cannot be resumed."};
+      }
+      auto const& stopped   = checkpoint.interruption;
+      auto const  completed = *checkpoint.completed_passes;
+      auto const  cadence   = m_cadence.resumed_after(completed);
+      if (!cadence || (stopped && completed == passes()))
+      {
+        throw std::invalid_argument{
+            "Checkpoint lies beyond the configured passes."};
+      }
+      if (stopped &&
+          (stopped->pass_attempts <= 0 || stopped->pass_transitions < 0))
+      {
+        throw std::invalid_argument{
+            "Checkpoint records an invalid stopped pass."};
+      }
+
+      auto generator = cdt::Random::restore(seed(), stream(),
+                                            resume->transition_engine);
+      if (!generator)
+      {
+        throw std::invalid_argument{
+            "Checkpoint engine state does not belong to this run's stream."};
+      }
+
+      auto statistics             = RunStatistics{};
+      statistics.transition_trace = *checkpoint.transition_trace;
+      statistics.transition_count = *checkpoint.transition_count;
+      statistics.proposed         = make_counter(resume->proposed);
+      statistics.accepted         = make_counter(resume->accepted);
+      statistics.rejected         = make_counter(resume->rejected);
+      statistics.burn_in          = burn_in;
+      auto command_results =
+          CommandResults{.attempted = make_counter(resume->attempted),
+                         .succeeded = make_counter(resume->succeeded),
+                         .failed    = make_counter(resume->failed)};
+
+      m_generator = std::move(*generator);
+
+      m_resume = ResumePoint{.cadence         = *cadence,
+                             .statistics      = std::move(statistics),
+                             .command_results = std::move(command_results),
+                             .stopped_pass    = stopped};
+    }
+
+    /// @returns Burn-in of the latest invocation, if burn-in was enabled
+    [[nodiscard]] auto burn_in() const noexcept
+        -> std::optional<utilities::Burn_in_metadata> const&
+    { return m_run_statistics.burn_in; }
+
+    /// @returns Checkpoint spacing in \f$\tau_{int}\f$, if adaptive
+    [[nodiscard]] auto adaptive_checkpoints() const noexcept
+    { return m_checkpoint_tau_multiple; }
+
+    /// @returns Online autocorrelation estimates from the latest invocation
+    [[nodiscard]] auto autocorrelation() const noexcept
+        -> autocorrelation::AutocorrelationMonitor const&
+    { return m_run_statistics.autocorrelation; }
+
     /// @returns The effective root seed used for this run.
     [[nodiscard]] auto seed() const noexcept { return m_generator.seed(); }
 
@@ -271,6 +653,11 @@ namespace cdt
                                            m_run_statistics);
     }
 
+    /// @returns The engine positions and counters reached by the latest
+    /// invocation, as a checkpoint written at its end would record them.
+    [[nodiscard]] auto resume_metadata() const -> utilities::Resume_metadata
+    { return make_resume_metadata(m_command_results, m_run_statistics); }
+
     /// @returns The container of trial moves
     [[nodiscard]] auto proposed() const noexcept -> Counter const&
     { return m_run_statistics.proposed; }
@@ -337,6 +724,46 @@ namespace cdt
       return 0;
     }
 
+    /// @brief Site counts whose quotient is the Hastings proposal ratio
+    /// @details The uniform move-type factor cancels, so
+    /// \f$q(T\mid T')/q(T'\mid T) = C_m(T)/C_{m^{-1}}(T')\f$ exactly.
+    struct ProposalSiteRatio
+    {
+      /// @brief Raw sites of the forward move in the current geometry
+      Int_precision forward;
+
+      /// @brief Raw sites of the reverse move in the proposed geometry
+      Int_precision reverse;
+    };
+
+    /// @param current Geometry before applying the proposed move.
+    /// @param proposed Geometry after applying the proposed move.
+    /// @param move Forward move type.
+    /// @returns The forward and reverse raw-site counts of the proposal.
+    /// @throws std::invalid_argument If move has no recognized inverse.
+    /// @throws std::logic_error If either site count is zero.
+    [[nodiscard]] static constexpr auto proposal_site_ratio(
+        Geometry<ManifoldType::dimension> const& current,
+        Geometry<ManifoldType::dimension> const& proposed,
+        move_tracker::MoveType const move) -> ProposalSiteRatio
+    {
+      auto const reverse_type = reverse_move(move);
+      if (!reverse_type)
+      {
+        throw std::invalid_argument{"Cannot reverse an unknown move type."};
+      }
+      auto const ratio =
+          ProposalSiteRatio{.forward = proposal_site_count(current, move),
+                            .reverse = proposal_site_count(proposed,
+                                                           *reverse_type)};
+      if (ratio.forward <= 0 || ratio.reverse <= 0)
+      {
+        throw std::logic_error(
+            "A successful reversible proposal must have nonzero forward and reverse probabilities.");
+      }
+      return ratio;
+    }
+
     /// @returns The probability of selecting a particular raw proposal site
     /// @details Move types are uniform. A raw site is then uniform within its
     /// type-specific domain. Inapplicable sites remain explicit
@@ -365,7 +792,7 @@ namespace cdt
     /// @param proposed Geometry after applying the proposed move.
     /// @param move Forward move type.
     /// @returns Reverse proposal probability divided by the forward proposal
-    /// probability.
+    /// probability, formed as one correctly rounded quotient of site counts.
     /// @throws std::invalid_argument If move has no recognized inverse.
     /// @throws std::logic_error If either proposal probability is zero.
     [[nodiscard]] static auto hastings_ratio(
@@ -373,22 +800,13 @@ namespace cdt
         Geometry<ManifoldType::dimension> const& proposed,
         move_tracker::MoveType const             move) -> mpfr_values::Value
     {
-      auto const forward      = proposal_probability(current, move);
-      auto const reverse_type = reverse_move(move);
-      if (!reverse_type)
-      {
-        throw std::invalid_argument{"Cannot reverse an unknown move type."};
-      }
-      auto const reverse = proposal_probability(proposed, *reverse_type);
-      if (mpfr_zero_p(forward.fr()) != 0 || mpfr_zero_p(reverse.fr()) != 0)
-      {
-        throw std::logic_error(
-            "A successful reversible proposal must have nonzero forward and reverse probabilities.");
-      }
-      return mpfr_values::divide(reverse, forward);
+      auto const sites = proposal_site_ratio(current, proposed, move);
+      return mpfr_values::divide(mpfr_values::from_integer(sites.forward),
+                                 mpfr_values::from_integer(sites.reverse));
     }
 
     /// @brief Calculate the action factor \f$e^{S(T)-S(T')}\f$
+    /// @details \f$S\f$ is the bulk action plus any volume-fixing potential.
     /// @see [Three-dimensional CDT
     /// action](../REFERENCES.md#three-dimensional-cdt-2001)
     /// @param current Geometry before applying the proposed move.
@@ -399,10 +817,15 @@ namespace cdt
         Geometry<ManifoldType::dimension> const& proposed) const
         -> mpfr_values::Value
     {
-      auto const current_action = s3_action::s3_bulk_action(
-          current.N1_TL, current.N3_31_13, current.N3_22, m_parameters);
-      auto const proposed_action = s3_action::s3_bulk_action(
-          proposed.N1_TL, proposed.N3_31_13, proposed.N3_22, m_parameters);
+      auto const& volume         = m_parameters.volume_fixing();
+      auto const  current_action = mpfr_values::add(
+          s3_action::s3_bulk_action(current.N1_TL, current.N3_31_13,
+                                     current.N3_22, m_parameters),
+          s3_action::volume_potential(current.N3, volume));
+      auto const proposed_action = mpfr_values::add(
+          s3_action::s3_bulk_action(proposed.N1_TL, proposed.N3_31_13,
+                                    proposed.N3_22, m_parameters),
+          s3_action::volume_potential(proposed.N3, volume));
       return mpfr_values::exponential(
           mpfr_values::subtract(current_action, proposed_action));
     }
@@ -425,30 +848,93 @@ namespace cdt
       return mpfr_cmp(ratio.fr(), one.fr()) < 0 ? ratio : one;
     }
 
+    /// @param move Pachner move type.
+    /// @returns The tabulated \f$e^{S(T)-S(T')}\f$ of a successful @p move,
+    /// which depends only on its fixed geometry delta.
+    /// @throws std::invalid_argument If move is not a known move type.
+    [[nodiscard]] auto action_factor(move_tracker::MoveType const move) const
+        -> mpfr_values::Value const&
+    {
+      auto const index =
+          static_cast<std::size_t>(move_tracker::as_integer(move));
+      if (index >= m_action_factors.size())
+      {
+        throw std::invalid_argument{"Cannot tabulate an unknown move type."};
+      }
+      return m_action_factors[index];
+    }
+
+    /// @brief Decide a fixed-delta proposal in long double when certain.
+    /// @details Since the trial lies in [0,1], \f$\min(1,r)\ge t\f$ exactly
+    /// when \f$r\ge t\f$. With \f$r = f_m C_m(T)/C_{m^{-1}}(T')\f$ this
+    /// compares the outward-rounded bounds of \f$f_m C_m(T)\f$ with
+    /// \f$t C_{m^{-1}}(T')\f$. Each long-double product has relative error
+    /// below one epsilon, so a margin of four epsilons certifies that the
+    /// exact comparison, and the MPFR oracle, decide the same way.
+    /// A volume-fixing factor \f$e^{x}\f$ enters through the MPFR bounds of
+    /// s3_action::volume_factor_bounds(), which are outward-rounded like
+    /// the action factors, so the same margin applies.
+    /// Subnormal or non-finite operands are never certified.
+    /// @param current Geometry before applying the proposed move.
+    /// @param proposed Geometry after applying the fixed delta of @p move.
+    /// @param move Forward move type.
+    /// @param trial_value Uniform draw in [0,1].
+    /// @returns The decision, or an empty optional when @p trial_value lies
+    /// within the error interval and the MPFR oracle must decide.
+    /// @throws std::invalid_argument If move has no recognized inverse.
+    /// @throws std::logic_error If either proposal-site count is zero.
+    [[nodiscard]] auto certified_acceptance(
+        Geometry<ManifoldType::dimension> const& current,
+        Geometry<ManifoldType::dimension> const& proposed,
+        move_tracker::MoveType const move, long double const trial_value) const
+        -> std::optional<bool>
+    {
+      auto const sites = proposal_site_ratio(current, proposed, move);
+      if (trial_value == 0.0L) { return true; }
+
+      constexpr auto epsilon = std::numeric_limits<long double>::epsilon();
+      constexpr auto margin  = 1.0L + 4.0L * epsilon;
+      auto const     volume  = s3_action::volume_factor_bounds(
+          current.N3, proposed.N3, m_parameters.volume_fixing());
+      auto const& bounds    = m_factor_bounds[static_cast<std::size_t>(
+          move_tracker::as_integer(move))];
+      auto const  forward   = static_cast<long double>(sites.forward);
+      auto const  reverse   = static_cast<long double>(sites.reverse);
+      auto const  lower     = bounds.lower * forward * volume.lower;
+      auto const  upper     = bounds.upper * forward * volume.upper;
+      auto const  threshold = trial_value * reverse;
+      if (!std::isnormal(lower) || !std::isnormal(upper) ||
+          !std::isnormal(threshold))
+      {
+        return std::nullopt;
+      }
+      if (lower > threshold * margin) { return true; }
+      if (upper * margin < threshold) { return false; }
+      return std::nullopt;
+    }
+
    private:
-    [[nodiscard]] auto propose_candidate(ManifoldType const&          current,
-                                         move_tracker::MoveType const move)
-        -> ergodic_moves::MoveResult<ManifoldType>
+    /// @returns True if @p trial_value accepts the proposal.
+    /// @details The certified evaluation requires @p proposed to be
+    /// @p current plus the fixed delta of @p move, which check_move() or the
+    /// dry-run prediction guarantees.
+    /// @throws std::logic_error If either proposal-site count is zero.
+    [[nodiscard]] auto accepts(
+        Geometry<ManifoldType::dimension> const& current,
+        Geometry<ManifoldType::dimension> const& proposed,
+        move_tracker::MoveType const move, long double const trial_value) const
+        -> bool
     {
-      using enum move_tracker::MoveType;
-      switch (move)
+      if (m_acceptance_evaluation == AcceptanceEvaluation::CERTIFIED)
       {
-        case TWO_THREE:
-          return ergodic_moves::propose_23_move(current, m_generator);
-        case THREE_TWO:
-          return ergodic_moves::propose_32_move(current, m_generator);
-        case TWO_SIX:
-          return ergodic_moves::propose_26_move(current, m_generator);
-        case SIX_TWO:
-          return ergodic_moves::propose_62_move(current, m_generator);
-        case FOUR_FOUR:
-          return ergodic_moves::propose_44_move(current, m_generator);
-      }
-      return std::unexpected{
-          ergodic_moves::MoveError{
-                                   .category       = ergodic_moves::MoveFailure::UNKNOWN_MOVE,
-                                   .requested_move = move}
-      };
+        if (auto const decision =
+                certified_acceptance(current, proposed, move, trial_value))
+        {
+          return *decision;
+        }
+      }
+      return mpfr_cmp_ld(acceptance_probability(current, proposed, move).fr(),
+                         trial_value) >= 0;
     }
 
     [[nodiscard]] auto make_reproducibility_metadata(
@@ -462,6 +948,8 @@ namespace cdt
       metadata.completed_passes = completed_passes;
       metadata.transition_trace = statistics.transition_trace;
       metadata.transition_count = statistics.transition_count;
+      metadata.burn_in          = statistics.burn_in;
+      metadata.interruption     = statistics.interruption;
       utilities::update_reproducibility_state(metadata, manifold);
       if (metadata.desired_simplices == 0)
       {
@@ -474,6 +962,21 @@ namespace cdt
       return metadata;
     }
 
+    /// @returns The engine position and counters that let a checkpoint
+    /// taken now be resumed.
+    [[nodiscard]] auto make_resume_metadata(
+        CommandResults const& command_results,
+        RunStatistics const&  statistics) const -> utilities::Resume_metadata
+    {
+      return {.transition_engine = m_generator.state(),
+              .proposed          = counter_values(statistics.proposed),
+              .accepted          = counter_values(statistics.accepted),
+              .rejected          = counter_values(statistics.rejected),
+              .attempted         = counter_values(command_results.attempted),
+              .succeeded         = counter_values(command_results.succeeded),
+              .failed            = counter_values(command_results.failed)};
+    }
+
     auto resolve_transition(ManifoldType&                current,
                             CommandResults&              command_results,
                             RunStatistics&               statistics,
@@ -496,19 +999,72 @@ namespace cdt
 
       statistics.geometry = current.geometry();
       ++statistics.proposed[move];
+
+      // Volume fixing makes most proposals certain rejections. A successful
+      // move's geometry is known from its fixed delta, so the trial is
+      // compared before a site is prepared; an inapplicable site would have
+      // been a self-transition too.
+      if (m_parameters.volume_fixing().enabled())
+      {
+        auto const expected =
+            ergodic_moves::detail::moved_geometry(statistics.geometry, move);
+        if (expected &&
+            proposal_site_count(statistics.geometry, move) > 0 &&
+            proposal_site_count(*expected, *reverse_move(move)) > 0 &&
+            !accepts(statistics.geometry, *expected, move, trial_value))
+        {
+          ++statistics.rejected[move];
+          record_transition(statistics, move,
+                            ergodic_moves::MoveOutcome::METROPOLIS_REJECTED);
+          return ergodic_moves::MoveOutcome::METROPOLIS_REJECTED;
+        }
+      }
       ++command_results.attempted[move];
 
-      auto candidate = propose_candidate(current, move);
-      if (!candidate)
+      // The candidate is applied to the current state in place; every path
+      // that does not accept it rolls the journaled mutation back.
+      auto       transaction = current.begin_transaction();
+      auto const prepared =
+          ergodic_moves::prepare_move(transaction, move, m_generator);
+
+      // A move certain to succeed is judged by its predicted geometry, so a
+      // rejected one is never built. Skipping it consumes the draws building
+      // it would, which keeps the chain and its trace unchanged.
+      auto const predicted =
+          prepared ? prepared->dry_run(transaction.triangulation(),
+                                       transaction.journal(),
+                                       statistics.geometry)
+                   : std::nullopt;
+      if (predicted &&
+          !accepts(statistics.geometry, *predicted, move, trial_value))
       {
+        prepared->skip(transaction.triangulation(), transaction.journal(),
+                       m_generator);
+        transaction.rollback();
+        ++command_results.succeeded[move];
+        ++statistics.rejected[move];
+        record_transition(statistics, move,
+                          ergodic_moves::MoveOutcome::METROPOLIS_REJECTED);
+        return ergodic_moves::MoveOutcome::METROPOLIS_REJECTED;
+      }
+
+      auto const applied = prepared.and_then(
+          [&transaction, this](ergodic_moves::PreparedMove const& candidate) {
+            return candidate.apply(transaction, m_generator);
+          });
+      if (!applied)
+      {
+        transaction.rollback();
         ++command_results.failed[move];
         ++statistics.rejected[move];
-        auto const outcome = ergodic_moves::outcome_from(candidate.error());
+        auto const outcome = ergodic_moves::outcome_from(applied.error());
         record_transition(statistics, move, outcome);
         return outcome;
       }
-      if (!ergodic_moves::detail::check_move(current, *candidate, move))
+      transaction.stage();
+      if (!ergodic_moves::detail::check_move(transaction, move))
       {
+        transaction.rollback();
         ++command_results.failed[move];
         ++statistics.rejected[move];
         record_transition(statistics, move,
@@ -517,11 +1073,11 @@ namespace cdt
       }
 
       ++command_results.succeeded[move];
-      auto const probability = acceptance_probability(
-          statistics.geometry, candidate->geometry(), move);
-      if (mpfr_cmp_ld(probability.fr(), trial_value) >= 0)
+      // A predicted move reaching this point has already been accepted.
+      if (predicted || accepts(statistics.geometry, current.geometry(), move,
+                               trial_value))
       {
-        swap(*candidate, current);
+        transaction.commit();
         statistics.geometry = current.geometry();
         ++statistics.accepted[move];
         record_transition(statistics, move,
@@ -529,6 +1085,7 @@ namespace cdt
         return ergodic_moves::MoveOutcome::METROPOLIS_ACCEPTED;
       }
 
+      transaction.rollback();
       ++statistics.rejected[move];
       record_transition(statistics, move,
                         ergodic_moves::MoveOutcome::METROPOLIS_REJECTED);
@@ -542,24 +1099,89 @@ namespace cdt
     {
       auto const move = move_tracker::generate_random_move_3(m_generator);
       auto const trial_value = utilities::generate_probability(m_generator);
-      return {move, resolve_transition(current, command_results, statistics,
-                                       move, trial_value)};
+      auto const outcome     = resolve_transition(
+          current, command_results, statistics, move, trial_value);
+      statistics.autocorrelation.observe(statistics.geometry);
+      return {move, outcome};
+    }
+
+    /// @brief Ask @p budget whether a pass stops before its next transition.
+    /// @param attempts Transitions the pass makes.
+    /// @param completed Transitions the pass has made.
+    /// @returns Why it stops, also recorded in @p statistics, if it does
+    [[nodiscard]] static auto stop_before_transition(
+        detail::RunBudget const& budget, RunStatistics& statistics,
+        Int_precision const attempts, Int_precision const completed)
+        -> std::optional<RunStop>
+    {
+      auto const stop = budget.exhausted();
+      if (stop)
+      {
+        statistics.interruption = utilities::Interruption_metadata{
+            .reason           = std::string{run_stop_name(*stop)},
+            .pass_attempts    = attempts,
+            .pass_transitions = completed};
+      }
+      return stop;
     }
 
-    [[nodiscard]] auto execute_pass(ManifoldType        current,
-                                    RunStatistics       statistics,
-                                    Int_precision const attempts) -> PassResult
+    /// @brief Run @p attempts transitions, skipping the @p first a stopped
+    /// pass already made.
+    [[nodiscard]] auto execute_pass(ManifoldType             current,
+                                    RunStatistics            statistics,
+                                    Int_precision const      attempts,
+                                    detail::RunBudget const& budget,
+                                    Int_precision const      first = 0)
+        -> PassResult
     {
-      auto command_results = CommandResults{};
-      for (auto move_attempt = Int_precision{0}; move_attempt < attempts;
-           ++move_attempt)
+      auto                   command_results = CommandResults{};
+      std::optional<RunStop> stopped;
+      for (auto move_attempt = first; move_attempt < attempts; ++move_attempt)
       {
+        stopped =
+            stop_before_transition(budget, statistics, attempts, move_attempt);
+        if (stopped) { break; }
         static_cast<void>(
             sample_transition(current, command_results, statistics));
       }
       return {.manifold        = std::move(current),
               .command_results = std::move(command_results),
-              .strategy_state  = std::move(statistics)};
+              .strategy_state  = std::move(statistics),
+              .stopped         = stopped};
+    }
+
+    /// @brief Run passes until the MSER test passes, the limit is reached,
+    /// or @p budget stops a pass.
+    [[nodiscard]] auto run_burn_in(ManifoldType             current,
+                                   detail::RunBudget const& budget)
+        -> std::pair<ManifoldType, utilities::Burn_in_metadata>
+    {
+      auto detector       = equilibration::EquilibrationDetector{};
+      auto statistics     = RunStatistics{};
+      statistics.geometry = current.geometry();
+      detector.observe(statistics.geometry);
+      auto passes = Int_precision{};
+      while (passes < *m_burn_in_limit && !detector.equilibrated())
+      {
+        auto const attempts = current.N3();
+        auto       pass     = execute_pass(std::move(current),
+                                           std::move(statistics), attempts,
+                                           budget);
+        current             = std::move(pass.manifold);
+        statistics          = std::move(pass.strategy_state);
+        if (pass.stopped) { break; }
+        detector.observe(statistics.geometry);
+        ++passes;
+      }
+      auto const equilibrated = detector.equilibrated();
+      fmt::print("Burn-in: {} passes, {}.\n", passes,
+                 equilibrated            ? "equilibrated"
+                 : statistics.interruption ? "stopped early"
+                                           : "stopped at the pass limit");
+      return {std::move(current),
+              utilities::Burn_in_metadata{.passes       = passes,
+                                          .limit        = *m_burn_in_limit,
+                                          .equilibrated = equilibrated}};
     }
 
     static void print_results(CommandResults const& command_results,
@@ -625,6 +1247,27 @@ namespace cdt
           command_results.attempted.four_four_moves(),
           command_results.succeeded.four_four_moves(),
           command_results.failed.four_four_moves());
+
+      auto const& monitor = statistics.autocorrelation;
+      auto const  tau     = monitor.tau_int();
+      if (!tau) { return; }
+      auto const describe = [](autocorrelation::BatchMeans const& series) {
+        auto const series_tau = series.tau_int();
+        return series_tau ? fmt::format("{:.1f}", *series_tau)
+                          : std::string{"n/a"};
+      };
+      auto const samples = *monitor.effective_sample_size();
+      fmt::print(
+          "Integrated autocorrelation time: {:.1f} transitions (N3 {}, "
+          "N1_TL {}, action {}); {:.1f} effective samples",
+          *tau, describe(monitor.n3()), describe(monitor.n1_tl()),
+          describe(monitor.action()), samples);
+      if (statistics.cpu_seconds > 0.0)
+      {
+        fmt::print(", {:.3g} per chain-thread CPU-second",
+                   samples / statistics.cpu_seconds);
+      }
+      fmt::print(".\n");
     }
 
    public:
@@ -667,10 +1310,16 @@ namespace cdt
     /// @brief Execute a fresh run while continuing the owned random stream.
     /// @details The input remains unchanged. Counters, transition statistics,
     /// and checkpoint events are replaced only after the invocation completes.
-    /// If an exception escapes, the owned random stream may already have
-    /// advanced even though those published results remain unchanged.
+    /// Checkpoint snapshots are written by a detail::CheckpointWriter while
+    /// the chain continues, and every one is published before this returns;
+    /// each records the engine positions and counters that resume_from()
+    /// needs. After resume_from(), the invocation instead continues the
+    /// checkpointed run from @p t_manifold. If an exception escapes, the
+    /// owned random stream may already have advanced even though those
+    /// published results remain unchanged.
     /// @param t_manifold Initial canonical state for the run.
-    /// @returns Canonical state after all configured passes complete.
+    /// @returns Canonical state after all configured passes complete, or
+    /// where a stop signal or the deadline ended the run.
     /// @throws std::filesystem::filesystem_error if checkpoint output is
     /// enabled and persistence fails; also propagates failures from move
     /// generation and validation.
@@ -681,35 +1330,117 @@ namespace cdt
       spdlog::debug("{} called.\n", CDT_PRETTY_FUNCTION);
 #endif
 
-      auto initial_statistics     = RunStatistics{};
-      initial_statistics.geometry = t_manifold.geometry();
-      auto result                 = detail::execute_move_run(
-          t_manifold, std::move(initial_statistics), m_cadence,
+      auto initial            = t_manifold;
+      auto initial_statistics = RunStatistics{};
+      auto initial_commands   = CommandResults{};
+      auto run_cadence        = m_cadence;
+      auto resumed_pass = std::optional<utilities::Interruption_metadata>{};
+      auto budget =
+          detail::RunBudget{m_deadline, std::chrono::steady_clock::now()};
+      if (m_resume)
+      {
+        auto resume        = *std::exchange(m_resume, std::nullopt);
+        run_cadence        = resume.cadence;
+        initial_statistics = std::move(resume.statistics);
+        initial_commands   = std::move(resume.command_results);
+        resumed_pass       = std::move(resume.stopped_pass);
+      }
+      else if (m_burn_in_limit)
+      {
+        auto [state, record]       = run_burn_in(std::move(initial), budget);
+        initial                    = std::move(state);
+        initial_statistics.burn_in = record;
+      }
+      initial_statistics.geometry = initial.geometry();
+      initial_statistics.autocorrelation =
+          autocorrelation::AutocorrelationMonitor{m_parameters};
+      initial_statistics.cpu_start = detail::thread_cpu_seconds();
+
+      // Checkpoints are published in the background; completions and
+      // failures surface before the next pass.
+      detail::CheckpointWriter writer;
+      auto const report_published = [](std::vector<Int_precision> const&
+                                            published) {
+        for (auto const pass : published)
+        {
+          fmt::print("Checkpoint for pass {} published.\n", pass);
+        }
+      };
+      auto result = detail::execute_move_run(
+          std::move(initial), std::move(initial_statistics), run_cadence,
           detail::MoveRunIdentity{.algorithm = "Metropolis-Hastings",
                                   .seed      = seed(),
                                   .stream    = stream()},
           m_write_files,
-          [this](ManifoldType current, RunStatistics statistics,
-                 Int_precision const attempts) {
-            return execute_pass(std::move(current), std::move(statistics),
-                                attempts);
+          [this, &writer, &report_published, &budget,
+           stopped_pass = std::move(resumed_pass)](
+              ManifoldType current, RunStatistics statistics,
+              Int_precision attempts) mutable {
+            report_published(writer.poll());
+            budget.reserve_for(writer.longest_write());
+            // A resumed stopped pass keeps the attempts it started with.
+            auto first = Int_precision{};
+            if (stopped_pass)
+            {
+              attempts = stopped_pass->pass_attempts;
+              first    = stopped_pass->pass_transitions;
+              stopped_pass.reset();
+            }
+            auto pass = execute_pass(std::move(current),
+                                     std::move(statistics), attempts, budget,
+                                     first);
+            // Passes run on the chain's thread, so its clock excludes other
+            // chains and the checkpoint writer.
+            pass.strategy_state.cpu_seconds =
+                detail::thread_cpu_seconds() - pass.strategy_state.cpu_start;
+            return pass;
           },
           [](ManifoldType const&, CommandResults const& command_results,
              RunStatistics const& statistics) {
             print_results(command_results, statistics);
           },
-          [this](ManifoldType const&  current, CommandResults const&,
-                 RunStatistics const& statistics,
-                 Int_precision const  pass_number) {
-            utilities::write_file(
-                current, make_reproducibility_metadata(
-                             current, utilities::ArtifactKind::CHECKPOINT,
-                             pass_number, statistics));
-          });
+          [this, &writer](ManifoldType const&   current,
+                          CommandResults const& command_results,
+                          RunStatistics const&  statistics,
+                          Int_precision const   pass_number) {
+            // Engine positions are taken now; the chain moves on at once.
+            writer.submit(pass_number,
+                          [this, snapshot = current, statistics, pass_number,
+                           resume = make_resume_metadata(command_results,
+                                                         statistics)] {
+                            auto metadata = make_reproducibility_metadata(
+                                snapshot, utilities::ArtifactKind::CHECKPOINT,
+                                pass_number, statistics);
+                            metadata.resume = resume;
+                            utilities::write_file(snapshot, metadata);
+                          });
+          },
+          [multiple = m_checkpoint_tau_multiple,
+           last     = run_cadence.completed()](
+              MoveRunCadence const cadence, Int_precision const pass_number,
+              ManifoldType const& current,
+              RunStatistics const& statistics) mutable {
+            auto const tau = statistics.autocorrelation.tau_int();
+            if (!multiple || !tau)
+            {
+              return detail::FixedCheckpointSchedule{}(cadence, pass_number,
+                                                       current, statistics);
+            }
+            if (pass_number - last < autocorrelation::checkpoint_interval(
+                                         *multiple, *tau, current.N3()))
+            {
+              return false;
+            }
+            last = pass_number;
+            return true;
+          },
+          std::move(initial_commands));
+      report_published(writer.drain());
 
       m_command_results   = std::move(result.command_results);
       m_run_statistics    = std::move(result.strategy_state);
       m_checkpoint_events = result.checkpoint_events;
+      m_completed_passes  = result.completed_passes;
       return std::move(result.manifold);
     }
 
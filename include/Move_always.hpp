@@ -40,6 +40,9 @@ namespace cdt
     /// @brief Whether checkpoint triangulation files may be written
     bool m_write_files{true};
 
+    /// @brief Whether sites are drawn from each move's applicable subset
+    bool m_applicable_sites{false};
+
     /// @brief Command counters from the latest completed invocation
     CommandResults m_command_results;
 
@@ -56,7 +59,8 @@ namespace cdt
       {
         command.enqueue(move_tracker::generate_random_move_3(m_random));
       }
-      command.execute(m_random);
+      if (m_applicable_sites) { command.execute_applicable(m_random); }
+      else { command.execute(m_random); }
       auto command_results =
           detail::consume_command_results<ManifoldType>(command);
       return {.manifold        = std::move(command).result(),
@@ -152,6 +156,21 @@ namespace cdt
     /// @returns Whether the strategy writes checkpoint triangulation files.
     [[nodiscard]] auto writes_files() const noexcept { return m_write_files; }
 
+    /// @brief Choose how each pass draws move sites.
+    /// @details By default each move shuffles its whole raw domain, which
+    /// keeps seeded runs and the pinned fixture unchanged. Enabled, each pass
+    /// collects the applicable sites once and applies every move in place at
+    /// a uniformly drawn one, patching the sites around it; see
+    /// MoveCommand::execute_applicable(). The site distribution is the same,
+    /// but a seed yields a different sequence of sites.
+    /// @param enabled Whether to draw from applicable sites.
+    void set_applicable_sites(bool const enabled) noexcept
+    { m_applicable_sites = enabled; }
+
+    /// @returns Whether sites are drawn from each move's applicable subset.
+    [[nodiscard]] auto uses_applicable_sites() const noexcept
+    { return m_applicable_sites; }
+
     /// @returns The MoveTracker of attempted moves
     [[nodiscard]] auto attempted() const noexcept
         -> move_tracker::MoveTracker const&
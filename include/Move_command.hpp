@@ -180,6 +180,48 @@ namespace cdt
       }
     }  // execute
 
+    /**
+     * \brief Execute all moves in the queue at directly chosen applicable sites
+     * \details Unlike execute(), which shuffles each move's entire raw domain
+     * and prepares sites until one applies, the applicable sites of every
+     * move are collected once and patched around each committed move, and
+     * each move is applied in place at a uniformly drawn applicable site. The
+     * site distribution is the same, but a move costs time proportional to
+     * its footprint, so long queues such as thermalization of an initial
+     * configuration run much faster. The generator is consumed differently,
+     * so a given seed yields a different sequence of sites than execute().
+     * Exception guarantees are those of execute().
+     * \tparam Generator Uniform random bit generator type
+     * \param generator Generator advanced by stochastic move selection
+     */
+    template <std::uniform_random_bit_generator Generator>
+    void execute_applicable(Generator& generator)
+    {
+      auto sites = [this] {
+        auto transaction = m_manifold.begin_transaction();
+        return ergodic_moves::ApplicableSites{transaction};
+      }();
+      while (!m_moves.empty())
+      {
+        auto const move = m_moves.back();
+        ++m_attempted[move];
+        auto const applied = ergodic_moves::apply_applicable_move(
+            m_manifold, sites, move, generator);
+        if (applied) { ++m_succeeded[move]; }
+        else
+        {
+          if (applied.error().reason() ==
+              ergodic_moves::MoveFailure::INVARIANT_VIOLATION)
+          {
+            spdlog::warn(
+                "Move violated a manifold invariant or geometry delta.\n");
+          }
+          ++m_failed[move];
+        }
+        m_moves.pop_back();
+      }
+    }  // execute_applicable
+
     /// @brief Apply one queued move using the caller-owned random stream.
     /// @tparam Generator Uniform random bit generator type.
     /// @param manifold Source manifold, which remains unchanged.
@@ -79,6 +79,9 @@ namespace cdt::ergodic_moves
   template <typename ManifoldType>
   using MoveResult = std::expected<ManifoldType, MoveError>;
 
+  /// @brief Value returned by a fallible in-place Pachner-move mutation.
+  using MoveApplication = std::expected<void, MoveError>;
+
   /// @brief Typed state used to route proposal and execution accounting.
   enum class MoveOutcome : std::uint8_t
   {
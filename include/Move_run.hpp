@@ -12,11 +12,23 @@
 
 #include <fmt/format.h>
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <exception>
 #include <expected>
 #include <functional>
+#include <mutex>
+#include <optional>
 #include <stdexcept>
 #include <string_view>
+#include <thread>
 #include <utility>
+#include <vector>
 
 #include "Move_tracker.hpp"
 #include "Random.hpp"
@@ -26,13 +38,15 @@ namespace cdt
   /// @brief Reasons raw move-run cadence cannot become a domain value.
   enum class MoveRunCadenceError
   {
-    NONPOSITIVE_PASSES,     ///< The requested pass count is not positive.
-    NONPOSITIVE_CHECKPOINT  ///< The checkpoint interval is not positive.
+    NONPOSITIVE_PASSES,      ///< The requested pass count is not positive.
+    NONPOSITIVE_CHECKPOINT,  ///< The checkpoint interval is not positive.
+    COMPLETED_OUT_OF_RANGE   ///< Completed passes lie outside the run.
   };
 
   /// @brief Positive pass count and checkpoint interval for a move run.
   /// @details Once parsed, the orchestration core can use both values without
-  /// repeating positivity checks.
+  /// repeating positivity checks. A resumed cadence also records the passes
+  /// an earlier run completed, and its run continues after them.
   class MoveRunCadence
   {
     struct Parsed
@@ -40,6 +54,7 @@ namespace cdt
 
     Int_precision m_passes{1};
     Int_precision m_checkpoint{1};
+    Int_precision m_completed{};
 
     MoveRunCadence(Int_precision const passes, Int_precision const checkpoint,
                    Parsed /*proof*/) noexcept
@@ -73,16 +88,125 @@ namespace cdt
       return MoveRunCadence{passes, checkpoint, Parsed{}};
     }
 
+    /// @brief Continue this cadence after passes of an earlier run.
+    /// @param completed Passes already completed; between zero and passes().
+    /// @returns The cadence whose run starts at pass `completed + 1`, or
+    /// MoveRunCadenceError::COMPLETED_OUT_OF_RANGE.
+    [[nodiscard]] auto resumed_after(Int_precision const completed) const
+        noexcept -> std::expected<MoveRunCadence, MoveRunCadenceError>
+    {
+      if (completed < 0 || completed > m_passes)
+      {
+        return std::unexpected{MoveRunCadenceError::COMPLETED_OUT_OF_RANGE};
+      }
+      auto resumed        = *this;
+      resumed.m_completed = completed;
+      return resumed;
+    }
+
     /// @returns The positive number of passes in a run.
     [[nodiscard]] constexpr auto passes() const noexcept { return m_passes; }
 
     /// @returns The positive number of passes between checkpoint events.
     [[nodiscard]] constexpr auto checkpoint() const noexcept
     { return m_checkpoint; }
+
+    /// @returns Passes completed before the run starts; zero unless resumed.
+    [[nodiscard]] constexpr auto completed() const noexcept
+    { return m_completed; }
+  };
+
+  /// @brief Why a move run ended before its configured passes.
+  enum class RunStop : std::uint8_t
+  {
+    DEADLINE,  ///< The wall-clock budget ran out.
+    SIGNAL     ///< A stop signal arrived.
   };
 
+  /// @returns The name recorded in metadata for @p stop.
+  [[nodiscard]] constexpr auto run_stop_name(RunStop const stop) noexcept
+      -> std::string_view
+  {
+    switch (stop)
+    {
+      case RunStop::DEADLINE: return "deadline";
+      case RunStop::SIGNAL: return "signal";
+    }
+    return "unknown";
+  }
+
   namespace detail
   {
+    /// @brief Number of the first stop signal received, or zero.
+    /// @details Signal handlers store to it, so it is a lock-free atomic with
+    /// static storage. Budgeted strategies poll it between transitions.
+    inline std::atomic<int> stop_signal{0};
+    static_assert(std::atomic<int>::is_always_lock_free);
+
+    /// @brief Wall-clock deadline of a run and the time kept back for its
+    /// final checkpoint
+    /// @details Until a checkpoint has been written the reserve is a
+    /// twentieth of the budget. Afterwards it is twice the longest write
+    /// seen, which covers the stopped run's checkpoint and the caller's final
+    /// output. A pending stop signal exhausts every budget.
+    class RunBudget
+    {
+     public:
+      using Clock = std::chrono::steady_clock;
+
+     private:
+      std::optional<Clock::time_point> m_deadline;
+      Clock::duration                  m_reserve{};
+
+     public:
+      /// @brief Construct a budget bounded only by stop signals.
+      RunBudget() = default;
+
+      /// @param deadline Time by which output must be written, or an empty
+      /// optional for no deadline.
+      /// @param now Start of the budgeted work.
+      RunBudget(std::optional<Clock::time_point> const deadline,
+                Clock::time_point const                now) noexcept
+          : m_deadline{deadline}
+      {
+        if (m_deadline)
+        {
+          m_reserve = std::max(*m_deadline - now, Clock::duration::zero()) / 20;
+        }
+      }
+
+      /// @brief Keep back twice the longest checkpoint write.
+      /// @param longest_write Longest write so far, or zero before the first.
+      void reserve_for(Clock::duration const longest_write) noexcept
+      {
+        if (longest_write > Clock::duration::zero())
+        {
+          m_reserve = 2 * longest_write;
+        }
+      }
+
+      /// @returns The deadline, if any
+      [[nodiscard]] auto deadline() const noexcept { return m_deadline; }
+
+      /// @returns Time kept back before the deadline
+      [[nodiscard]] auto reserve() const noexcept { return m_reserve; }
+
+      /// @returns Why work must stop before its next step, or an empty
+      /// optional while it may continue
+      [[nodiscard]] auto exhausted() const noexcept -> std::optional<RunStop>
+      {
+        if (stop_signal.load(std::memory_order_relaxed) != 0)
+        {
+          return RunStop::SIGNAL;
+        }
+        if (m_deadline && Clock::now() + m_reserve >= *m_deadline)
+        {
+          return RunStop::DEADLINE;
+        }
+        return std::nullopt;
+      }
+    };
+
     /// @brief Convert a raw constructor boundary or throw its established
     /// error.
     [[nodiscard]] inline auto parse_move_run_cadence(
@@ -100,6 +224,9 @@ namespace cdt
         case MoveRunCadenceError::NONPOSITIVE_CHECKPOINT:
           throw std::invalid_argument{fmt::format(
               "{} checkpoint interval must be positive", strategy_name)};
+        case MoveRunCadenceError::COMPLETED_OUT_OF_RANGE:
+          throw std::invalid_argument{fmt::format(
+              "{} completed passes must lie within the run", strategy_name)};
       }
       throw std::logic_error{"Unknown move-run cadence error"};
     }
@@ -142,12 +269,14 @@ namespace cdt
     }
 
     /// @brief Values produced by one strategy-specific pass.
+    /// @details A pass that ended early reports why in `stopped`.
     template <typename ManifoldType, typename StrategyState>
     struct MovePassResult
     {
       ManifoldType                     manifold;
       MoveCommandResults<ManifoldType> command_results;
       StrategyState                    strategy_state;
+      std::optional<RunStop>           stopped;
     };
 
     /// @brief Complete values produced by one move-run invocation.
@@ -158,6 +287,8 @@ namespace cdt
       MoveCommandResults<ManifoldType> command_results;
       StrategyState                    strategy_state;
       Int_precision                    checkpoint_events{};
+      Int_precision                    completed_passes{};
+      std::optional<RunStop>           stopped;
     };
 
     /// @brief Stable identity displayed by the effectful run shell.
@@ -168,35 +299,59 @@ namespace cdt
       cdt::RandomStream stream;
     };
 
+    /// @brief Checkpoint schedule of every cadence.checkpoint() passes.
+    struct FixedCheckpointSchedule
+    {
+      template <typename ManifoldType, typename StrategyState>
+      [[nodiscard]] auto operator()(MoveRunCadence const cadence,
+                                    Int_precision const pass_number,
+                                    ManifoldType const&,
+                                    StrategyState const&) const noexcept
+          -> bool
+      { return pass_number % cadence.checkpoint() == 0; }
+    };
+
     /// @brief Execute shared pass, accounting, checkpoint, and report cadence.
     /// @details The pass callable owns strategy-specific selection and
     /// transition effects. The reporting and checkpoint callables make output
     /// effects explicit. All run values are returned for one commit by the
     /// caller, so a reusable strategy never exposes partially reset counters.
+    /// The schedule decides after each pass whether a checkpoint event is
+    /// due; the default follows the fixed cadence. A pass that stops early
+    /// ends the run: its partial state is checkpointed at once under the
+    /// number of passes completed before it, and no later pass starts. A
+    /// resumed cadence starts after its completed passes, with the command
+    /// totals the earlier run had reached.
     template <typename ManifoldType, typename StrategyState,
-              typename ExecutePass, typename Report, typename Checkpoint>
-    [[nodiscard]] auto execute_move_run(ManifoldType  initial,
-                                        StrategyState initial_strategy_state,
-                                        MoveRunCadence const  cadence,
-                                        MoveRunIdentity const identity,
-                                        bool const            writes_files,
-                                        ExecutePass execute_pass, Report report,
-                                        Checkpoint checkpoint)
+              typename ExecutePass, typename Report, typename Checkpoint,
+              typename Schedule = FixedCheckpointSchedule>
+    [[nodiscard]] auto execute_move_run(
+        ManifoldType initial, StrategyState initial_strategy_state,
+        MoveRunCadence const cadence, MoveRunIdentity const identity,
+        bool const writes_files, ExecutePass execute_pass, Report report,
+        Checkpoint checkpoint, Schedule schedule = {},
+        MoveCommandResults<ManifoldType> initial_command_results = {})
         -> MoveRunResult<ManifoldType, StrategyState>
     {
       auto current           = std::move(initial);
-      auto command_totals    = MoveCommandResults<ManifoldType>{};
+      auto command_totals    = std::move(initial_command_results);
       auto strategy_state    = std::move(initial_strategy_state);
       auto checkpoint_events = Int_precision{};
+      auto completed_passes  = cadence.completed();
+      auto stopped           = std::optional<RunStop>{};
 
       fmt::print("Starting {} algorithm in {}+1 dimensions ...\n",
                  identity.algorithm, ManifoldType::dimension - 1);
       fmt::print("Effective random seed: {} (stream {}).\n", identity.seed,
                  identity.stream);
+      if (cadence.completed() > 0)
+      {
+        fmt::print("Resuming after pass {}.\n", cadence.completed());
+      }
       fmt::print("Making random moves ...\n");
 
-      for (auto pass_index = Int_precision{}; pass_index < cadence.passes();
-           ++pass_index)
+      for (auto pass_index = cadence.completed();
+           pass_index < cadence.passes(); ++pass_index)
       {
         auto const pass_number = pass_index + 1;
         fmt::print("=== Pass {} ===\n", pass_number);
@@ -208,7 +363,26 @@ namespace cdt
                                                     pass.command_results);
         strategy_state = std::move(pass.strategy_state);
 
-        if (pass_number % cadence.checkpoint() == 0)
+        if (pass.stopped)
+        {
+          stopped = pass.stopped;
+          fmt::print("Pass {} stopped early by {}.\n", pass_number,
+                     run_stop_name(*stopped));
+          ++checkpoint_events;
+          if (writes_files)
+          {
+            fmt::print("Writing final checkpoint after pass {}.\n",
+                       pass_index);
+            std::invoke(checkpoint, std::as_const(current),
+                        std::as_const(command_totals),
+                        std::as_const(strategy_state), pass_index);
+          }
+          break;
+        }
+        completed_passes = pass_number;
+
+        if (std::invoke(schedule, cadence, pass_number, std::as_const(current),
+                        std::as_const(strategy_state)))
         {
           ++checkpoint_events;
           std::invoke(report, std::as_const(current),
@@ -230,8 +404,208 @@ namespace cdt
       return {.manifold          = std::move(current),
               .command_results   = std::move(command_totals),
               .strategy_state    = std::move(strategy_state),
-              .checkpoint_events = checkpoint_events};
+              .checkpoint_events = checkpoint_events,
+              .completed_passes  = completed_passes,
+              .stopped           = stopped};
+    }
+
+    /// @brief Invoke independent work items on a bounded set of threads.
+    /// @details Worker w handles items w, w + workers, w + 2 workers, and so
+    /// on, so every item runs exactly once on a thread-confined set of state.
+    /// With one effective worker the items run in order on the caller's
+    /// thread. All workers join before the first captured failure is
+    /// rethrown.
+    /// @param count Number of work items.
+    /// @param workers Maximum number of threads; must be positive.
+    /// @param work Callable invoked with each item index.
+    template <typename Work>
+    void run_on_workers(std::size_t const count, std::size_t const workers,
+                        Work&& work)
+    {
+      auto const threads = std::min(workers, count);
+      if (threads <= 1)
+      {
+        for (std::size_t item = 0; item < count; ++item)
+        {
+          std::invoke(work, item);
+        }
+        return;
+      }
+
+      std::vector<std::exception_ptr> failures(threads);
+      {
+        std::vector<std::jthread> pool;
+        pool.reserve(threads);
+        for (std::size_t worker = 0; worker < threads; ++worker)
+        {
+          pool.emplace_back([&work, &failures, count, threads, worker] {
+            try
+            {
+              for (auto item = worker; item < count; item += threads)
+              {
+                std::invoke(work, item);
+              }
+            }
+            catch (...)
+            {
+              failures[worker] = std::current_exception();
+            }
+          });
+        }
+      }
+      for (auto const& failure : failures)
+      {
+        if (failure) { std::rethrow_exception(failure); }
+      }
     }
+
+    /// @brief Publish checkpoint snapshots on a background thread.
+    /// @details The run thread hands over a job that owns an immutable copy of
+    /// the state and continues immediately. At most `capacity` snapshots are
+    /// queued or being written; submit() blocks while that many are
+    /// outstanding. Jobs run in submission order. The first failure discards
+    /// the jobs still queued and is rethrown by the next submit(), poll(), or
+    /// drain(). Each job keeps the atomic-publication guarantees of
+    /// utilities::write_file(). The longest job is timed so that a budgeted
+    /// run can keep back enough time for its last snapshot. Destruction
+    /// waits for queued jobs.
+    class CheckpointWriter
+    {
+     public:
+      using Job = std::function<void()>;
+
+      /// @brief Default bound on outstanding snapshots
+      static constexpr std::size_t default_capacity = 2;
+
+     private:
+      struct Entry
+      {
+        Int_precision pass_number{};
+        Job           job;
+      };
+
+      std::mutex                          m_mutex;
+      std::condition_variable             m_changed;
+      std::deque<Entry>                   m_queue;
+      std::vector<Int_precision>          m_completed;
+      std::chrono::steady_clock::duration m_longest_write{};
+      std::exception_ptr                  m_failure;
+      std::size_t                         m_capacity;
+      bool                                m_busy{false};
+      bool                                m_stopping{false};
+      std::jthread                        m_worker;
+
+      void work()
+      {
+        std::unique_lock lock(m_mutex);
+        while (true)
+        {
+          m_changed.wait(lock,
+                         [this] { return m_stopping || !m_queue.empty(); });
+          if (m_queue.empty()) { return; }
+          auto entry = std::move(m_queue.front());
+          m_queue.pop_front();
+          m_busy = true;
+          lock.unlock();
+          std::exception_ptr failure;
+          auto const         started = std::chrono::steady_clock::now();
+          try
+          {
+            std::invoke(entry.job);
+          }
+          catch (...)
+          {
+            failure = std::current_exception();
+          }
+          auto const elapsed = std::chrono::steady_clock::now() - started;
+          lock.lock();
+          m_busy          = false;
+          m_longest_write = std::max(m_longest_write, elapsed);
+          if (failure)
+          {
+            if (!m_failure) { m_failure = failure; }
+            m_queue.clear();
+          }
+          else { m_completed.push_back(entry.pass_number); }
+          m_changed.notify_all();
+        }
+      }
+
+      /// @returns Completed passes since the last report; requires the lock.
+      [[nodiscard]] auto take_completed() -> std::vector<Int_precision>
+      {
+        if (m_failure) { std::rethrow_exception(std::exchange(m_failure, {})); }
+        return std::exchange(m_completed, {});
+      }
+
+     public:
+      /// @param capacity Maximum outstanding snapshots.
+      /// @throws std::invalid_argument If @p capacity is zero.
+      explicit CheckpointWriter(std::size_t const capacity = default_capacity)
+          : m_capacity{capacity}
+      {
+        if (m_capacity == 0)
+        {
+          throw std::invalid_argument{
+              "Checkpoint queue capacity must be positive."};
+        }
+        m_worker = std::jthread{[this] { work(); }};
+      }
+
+      CheckpointWriter(CheckpointWriter const&)                    = delete;
+      auto operator=(CheckpointWriter const&) -> CheckpointWriter& = delete;
+
+      ~CheckpointWriter()
+      {
+        {
+          std::scoped_lock const lock(m_mutex);
+          m_stopping = true;
+        }
+        m_changed.notify_all();
+      }
+
+      /// @brief Queue a snapshot job, waiting while the queue is full.
+      /// @param pass_number Pass whose snapshot the job publishes.
+      /// @param job Callable owning everything it writes.
+      /// @throws The first failure of an earlier job, without queueing @p job.
+      void submit(Int_precision const pass_number, Job job)
+      {
+        std::unique_lock lock(m_mutex);
+        m_changed.wait(lock, [this] {
+          return m_failure ||
+                 m_queue.size() + (m_busy ? 1U : 0U) < m_capacity;
+        });
+        if (m_failure) { std::rethrow_exception(std::exchange(m_failure, {})); }
+        m_queue.push_back({.pass_number = pass_number, .job = std::move(job)});
+        m_changed.notify_all();
+      }
+
+      /// @returns Passes whose snapshots were published since the last
+      /// report, in submission order.
+      /// @throws The first failure of an earlier job.
+      [[nodiscard]] auto poll() -> std::vector<Int_precision>
+      {
+        std::scoped_lock const lock(m_mutex);
+        return take_completed();
+      }
+
+      /// @returns Duration of the longest job so far, or zero
+      [[nodiscard]] auto longest_write() -> std::chrono::steady_clock::duration
+      {
+        std::scoped_lock const lock(m_mutex);
+        return m_longest_write;
+      }
+
+      /// @brief Wait until every queued snapshot is published.
+      /// @returns Passes published since the last report.
+      /// @throws The first failure of an earlier job.
+      [[nodiscard]] auto drain() -> std::vector<Int_precision>
+      {
+        std::unique_lock lock(m_mutex);
+        m_changed.wait(lock, [this] { return m_queue.empty() && !m_busy; });
+        return take_completed();
+      }
+    };
   }  // namespace detail
 }  // namespace cdt
 
@@ -8,7 +8,7 @@
 /// @brief Template class for move algorithms (strategies) on manifolds
 /// @author Adam Getchell
 /// @details Template class for all move algorithms, e.g. Metropolis,
-/// MoveAlways.
+/// MoveAlways, ParallelTempering, RejectionFree.
 
 #ifndef INCLUDE_MOVE_STRATEGY_HPP_
 #define INCLUDE_MOVE_STRATEGY_HPP_
@@ -20,8 +20,10 @@ namespace cdt
    */
   enum class MoveStrategyKind
   {
-    MOVE_ALWAYS,  ///< Execute every applicable proposal.
-    METROPOLIS    ///< Apply Metropolis-Hastings acceptance.
+    MOVE_ALWAYS,         ///< Execute every applicable proposal.
+    METROPOLIS,          ///< Apply Metropolis-Hastings acceptance.
+    PARALLEL_TEMPERING,  ///< Exchange Metropolis replicas across couplings.
+    REJECTION_FREE       ///< Sample only accepted Metropolis transitions.
   };
 
   /**
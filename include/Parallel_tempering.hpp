@@ -0,0 +1,457 @@
+/*******************************************************************************
+ Causal Dynamical Triangulations in C++ using CGAL
+
+ Copyright © 2026 Adam Getchell
+ ******************************************************************************/
+
+/// @file Parallel_tempering.hpp
+/// @brief Replica-exchange Metropolis-Hastings over a ladder of couplings
+/// @details Each rung of the ladder runs an independent Metropolis chain on
+/// its own manifold and random stream. Between passes, neighbouring rungs
+/// propose to exchange configurations.
+
+#ifndef INCLUDE_PARALLEL_TEMPERING_HPP_
+#define INCLUDE_PARALLEL_TEMPERING_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <stdexcept>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "Metropolis.hpp"
+#include "Move_run.hpp"
+#include "Move_strategy.hpp"
+#include "Random.hpp"
+#include "S3Action.hpp"
+#include "Utilities.hpp"
+
+namespace cdt
+{
+  /// @brief The coupling that varies along a parallel-tempering ladder
+  enum class TemperedCoupling : std::uint8_t
+  {
+    K,      ///< Normalized Newton constant \f$k\f$.
+    LAMBDA  ///< Normalized cosmological constant \f$\lambda\f$.
+  };
+
+  /// @param coupling Tempered coupling.
+  /// @return Stable metadata name of the coupling.
+  [[nodiscard]] constexpr auto format_as(TemperedCoupling const coupling)
+      noexcept -> std::string_view
+  { return coupling == TemperedCoupling::K ? "k" : "lambda"; }
+
+  /// @param name Metadata or command-line name of a coupling.
+  /// @return The tempered coupling named by @p name.
+  /// @throws std::invalid_argument If @p name is neither "k" nor "lambda".
+  [[nodiscard]] inline auto parse_tempered_coupling(
+      std::string_view const name) -> TemperedCoupling
+  {
+    if (name == "k") { return TemperedCoupling::K; }
+    if (name == "lambda") { return TemperedCoupling::LAMBDA; }
+    throw std::invalid_argument{"Tempered coupling must be k or lambda."};
+  }
+
+  /// @brief Parallel-tempering (replica-exchange) strategy
+  /// @details Rung \f$r\f$ samples \f$e^{-S_r(T)}\f$, where \f$S_r\f$ uses the
+  /// r-th ladder value of the tempered coupling. Every pass runs one
+  /// Metropolis pass on each rung, on up to `threads` worker threads, and then
+  /// proposes swaps between the neighbouring pairs \f$(r, r+1)\f$ of one
+  /// parity, alternating between even and odd \f$r\f$. A swap of
+  /// configurations \f$T\f$ at rung \f$r\f$ and \f$T'\f$ at rung \f$r+1\f$ is
+  /// accepted with probability
+  ///
+  /// \f[\min\left(1, e^{S_r(T)+S_{r+1}(T')-S_r(T')-S_{r+1}(T)}\right).\f]
+  ///
+  /// Rung \f$r\f$ draws its transitions from `random_streams::replica(r)` and
+  /// every swap decision comes from `random_streams::exchange`, so a seed
+  /// replays the same run for any thread count.
+  ///
+  /// @tparam ManifoldType The type of Manifold on which to apply the algorithm
+  template <typename ManifoldType>
+    requires(ManifoldType::dimension == 3)
+  class MoveStrategy<MoveStrategyKind::PARALLEL_TEMPERING, ManifoldType>
+  {
+    using Replica = MoveStrategy<MoveStrategyKind::METROPOLIS, ManifoldType>;
+    using Counts  = std::vector<std::uint64_t>;
+
+    struct ExchangeStatistics
+    {
+      /// @brief Swap proposals of each adjacent rung pair
+      Counts attempted;
+
+      /// @brief Accepted swaps of each adjacent rung pair
+      Counts accepted;
+    };
+
+    /// @brief The coupling that varies between rungs
+    TemperedCoupling m_coupling;
+
+    /// @brief Tempered coupling value of each rung
+    std::vector<long double> m_ladder;
+
+    /// @brief Validated physical parameters of each rung
+    std::vector<s3_action::PhysicalParameters> m_parameters;
+
+    /// @brief Metropolis chain of each rung
+    std::vector<Replica> m_replicas;
+
+    /// @brief Positive pass and checkpoint cadence
+    MoveRunCadence m_cadence;
+
+    /// @brief Whether checkpoint files may be written
+    bool m_write_files{true};
+
+    /// @brief Maximum number of worker threads running replica passes
+    std::size_t m_threads{1};
+
+    /// @brief Run-owned random engine used only for swap decisions
+    cdt::Random m_exchange_random;
+
+    /// @brief Swap statistics from the latest completed invocation
+    ExchangeStatistics m_statistics;
+
+    /// @brief Checkpoint events from the latest completed invocation
+    Int_precision m_checkpoint_events{};
+
+    [[nodiscard]] static auto action(
+        Geometry<ManifoldType::dimension> const& geometry,
+        s3_action::PhysicalParameters const&     parameters)
+        -> mpfr_values::Value
+    {
+      return s3_action::s3_bulk_action(geometry.N1_TL, geometry.N3_31_13,
+                                       geometry.N3_22, parameters);
+    }
+
+    static void run_replica_pass(Replica& replica, ManifoldType& manifold)
+    {
+      auto const attempts = manifold.N3();
+      for (auto attempt = Int_precision{0}; attempt < attempts; ++attempt)
+      {
+        static_cast<void>(replica.attempt_transition(manifold));
+      }
+    }
+
+    void execute_replica_passes(std::vector<ManifoldType>& manifolds)
+    {
+      detail::run_on_workers(m_replicas.size(), m_threads,
+                             [this, &manifolds](std::size_t const rung) {
+                               run_replica_pass(m_replicas[rung],
+                                                manifolds[rung]);
+                             });
+    }
+
+    void exchange_sweep(std::vector<ManifoldType>& manifolds,
+                        ExchangeStatistics&        statistics,
+                        Int_precision const        pass_index)
+    {
+      auto const first = static_cast<std::size_t>(pass_index % 2);
+      for (auto rung = first; rung + 1 < manifolds.size(); rung += 2)
+      {
+        auto const trial = utilities::generate_probability(m_exchange_random);
+        ++statistics.attempted[rung];
+        auto const probability = exchange_probability(
+            rung, manifolds[rung].geometry(), manifolds[rung + 1].geometry());
+        if (mpfr_cmp_ld(probability.fr(), trial) >= 0)
+        {
+          using std::swap;
+          swap(manifolds[rung], manifolds[rung + 1]);
+          ++statistics.accepted[rung];
+        }
+      }
+    }
+
+    [[nodiscard]] auto make_reproducibility_metadata(
+        std::size_t const rung, ManifoldType const& manifold,
+        utilities::ArtifactKind const artifact,
+        Int_precision const           completed_passes,
+        ExchangeStatistics const&     statistics) const
+        -> utilities::Reproducibility_metadata
+    {
+      auto metadata = m_replicas.at(rung).reproducibility_metadata(
+          manifold, artifact, completed_passes);
+      metadata.tempering = utilities::Tempering_metadata{
+          .coupling      = std::string{format_as(m_coupling)},
+          .replica       = rung,
+          .ladder        = m_ladder,
+          .swap_attempts = statistics.attempted,
+          .swap_accepts  = statistics.accepted};
+      return metadata;
+    }
+
+    void print_results(std::vector<ManifoldType> const& manifolds,
+                       ExchangeStatistics const&        statistics) const
+    {
+      fmt::print("=== Replica Exchange Results ===\n");
+      for (std::size_t rung = 0; rung < m_ladder.size(); ++rung)
+      {
+        fmt::print("Rung {} ({} = {}): N3 = {}, {} accepted of {} proposed.\n",
+                   rung, format_as(m_coupling), m_ladder[rung],
+                   manifolds[rung].N3(),
+                   m_replicas[rung].accepted().total(),
+                   m_replicas[rung].proposed().total());
+      }
+      for (std::size_t pair = 0; pair < statistics.attempted.size(); ++pair)
+      {
+        fmt::print("Swaps {}<->{}: {} accepted of {} proposed.\n", pair,
+                   pair + 1, statistics.accepted[pair],
+                   statistics.attempted[pair]);
+      }
+    }
+
+   public:
+    MoveStrategy() = delete;
+
+    /// @brief Construct a replica-exchange run from a root PCG stream.
+    /// @param alpha Timelike edge length shared by every rung.
+    /// @param k Normalized Newton constant, replaced by the ladder when
+    /// @p coupling is TemperedCoupling::K.
+    /// @param lambda Normalized cosmological constant, replaced by the ladder
+    /// when @p coupling is TemperedCoupling::LAMBDA.
+    /// @param coupling The coupling that varies between rungs.
+    /// @param ladder Value of the tempered coupling at each rung.
+    /// @param passes Number of passes to execute.
+    /// @param checkpoint Interval between checkpoint events.
+    /// @param write_files Whether checkpoint events may write files.
+    /// @param random Root stream; only its seed is used to derive the replica
+    /// and exchange streams.
+    /// @param threads Maximum worker threads running replica passes.
+    /// @param reproducibility Optional initialization and requested-state
+    /// provenance shared by every rung.
+    /// @throws std::invalid_argument If the ladder has fewer than two rungs,
+    /// @p threads is zero, a coupling is non-finite, or either cadence value
+    /// is nonpositive.
+    /// @throws std::domain_error If `alpha` is not greater than 1/2.
+    MoveStrategy(long double const alpha, long double const k,
+                 long double const lambda, TemperedCoupling const coupling,
+                 std::vector<long double> ladder, Int_precision const passes,
+                 Int_precision const checkpoint, bool const write_files,
+                 cdt::Random const& random, std::size_t const threads = 1,
+                 std::optional<utilities::Reproducibility_metadata>
+                     reproducibility = std::nullopt)
+        : m_coupling{coupling}
+        , m_ladder{std::move(ladder)}
+        , m_cadence{detail::parse_move_run_cadence(passes, checkpoint,
+                                                   "Parallel tempering")}
+        , m_write_files{write_files}
+        , m_threads{threads}
+        , m_exchange_random{random.split(random_streams::exchange)}
+    {
+      if (m_ladder.size() < 2)
+      {
+        throw std::invalid_argument{
+            "Parallel tempering needs at least two replicas."};
+      }
+      if (m_threads == 0)
+      {
+        throw std::invalid_argument{
+            "Parallel tempering needs at least one worker thread."};
+      }
+      m_parameters.reserve(m_ladder.size());
+      m_replicas.reserve(m_ladder.size());
+      for (std::size_t rung = 0; rung < m_ladder.size(); ++rung)
+      {
+        auto const rung_k =
+            coupling == TemperedCoupling::K ? m_ladder[rung] : k;
+        auto const rung_lambda =
+            coupling == TemperedCoupling::LAMBDA ? m_ladder[rung] : lambda;
+        m_parameters.push_back(
+            s3_action::make_physical_parameters(alpha, rung_k, rung_lambda));
+        m_replicas.emplace_back(
+            alpha, rung_k, rung_lambda, passes, checkpoint, false,
+            random.split(random_streams::replica(rung)), reproducibility);
+      }
+      m_statistics = {.attempted = Counts(m_ladder.size() - 1),
+                      .accepted  = Counts(m_ladder.size() - 1)};
+    }
+
+    /// @returns The number of rungs on the ladder
+    [[nodiscard]] auto replicas() const noexcept { return m_ladder.size(); }
+
+    /// @returns The coupling that varies between rungs
+    [[nodiscard]] auto coupling() const noexcept { return m_coupling; }
+
+    /// @returns The tempered coupling value of each rung
+    [[nodiscard]] auto ladder() const noexcept
+        -> std::vector<long double> const&
+    { return m_ladder; }
+
+    /// @param rung Ladder index.
+    /// @returns The Metropolis chain of @p rung. Its counters accumulate every
+    /// transition since construction.
+    /// @throws std::out_of_range If @p rung is not on the ladder.
+    [[nodiscard]] auto replica(std::size_t const rung) const -> Replica const&
+    { return m_replicas.at(rung); }
+
+    /// @returns The number of passes to make
+    [[nodiscard]] auto passes() const noexcept { return m_cadence.passes(); }
+
+    /// @returns The number of passes before writing checkpoint files
+    [[nodiscard]] auto checkpoint() const noexcept
+    { return m_cadence.checkpoint(); }
+
+    /// @returns Checkpoint events completed by the latest invocation.
+    [[nodiscard]] auto checkpoint_events() const noexcept
+    { return m_checkpoint_events; }
+
+    /// @returns The maximum number of worker threads
+    [[nodiscard]] auto threads() const noexcept { return m_threads; }
+
+    /// @brief Select the acceptance evaluation of every rung.
+    /// @param evaluation The evaluation used by subsequent transitions.
+    void set_acceptance_evaluation(
+        AcceptanceEvaluation const evaluation) noexcept
+    {
+      for (auto& replica : m_replicas)
+      {
+        replica.set_acceptance_evaluation(evaluation);
+      }
+    }
+
+    /// @brief Add a volume-fixing potential to the action of every rung.
+    /// @details The potential is the same at every rung, so it cancels from
+    /// exchange probabilities.
+    /// @param volume The term used by subsequent transitions.
+    /// @throws std::invalid_argument If an enabled term is out of range.
+    void set_volume_fixing(s3_action::VolumeFixing const& volume)
+    {
+      for (auto& replica : m_replicas) { replica.set_volume_fixing(volume); }
+    }
+
+    /// @returns The effective root seed used for this run.
+    [[nodiscard]] auto seed() const noexcept
+    { return m_exchange_random.seed(); }
+
+    /// @returns Swap proposals of each adjacent rung pair in the latest
+    /// invocation.
+    [[nodiscard]] auto swap_attempts() const noexcept -> Counts const&
+    { return m_statistics.attempted; }
+
+    /// @returns Accepted swaps of each adjacent rung pair in the latest
+    /// invocation.
+    [[nodiscard]] auto swap_accepts() const noexcept -> Counts const&
+    { return m_statistics.accepted; }
+
+    /// @param pair Index \f$r\f$ of the rung pair \f$(r, r+1)\f$.
+    /// @returns The fraction of proposed swaps accepted, or zero when none
+    /// were proposed.
+    /// @throws std::out_of_range If @p pair is not an adjacent rung pair.
+    [[nodiscard]] auto swap_rate(std::size_t const pair) const -> long double
+    {
+      auto const attempted = m_statistics.attempted.at(pair);
+      if (attempted == 0) { return 0.0L; }
+      return static_cast<long double>(m_statistics.accepted.at(pair)) /
+             static_cast<long double>(attempted);
+    }
+
+    /// @brief Calculate the acceptance probability of one exchange.
+    /// @param rung Lower rung \f$r\f$ of the adjacent pair.
+    /// @param lower Geometry currently at rung \f$r\f$.
+    /// @param upper Geometry currently at rung \f$r+1\f$.
+    /// @returns \f$\min(1, e^{S_r(T)+S_{r+1}(T')-S_r(T')-S_{r+1}(T)})\f$
+    /// @throws std::out_of_range If @p rung is not the lower rung of a pair.
+    [[nodiscard]] auto exchange_probability(
+        std::size_t const rung, Geometry<ManifoldType::dimension> const& lower,
+        Geometry<ManifoldType::dimension> const& upper) const
+        -> mpfr_values::Value
+    {
+      auto const& here  = m_parameters.at(rung);
+      auto const& above = m_parameters.at(rung + 1);
+      auto const  kept =
+          mpfr_values::add(action(lower, here), action(upper, above));
+      auto const swapped =
+          mpfr_values::add(action(upper, here), action(lower, above));
+      auto const ratio =
+          mpfr_values::exponential(mpfr_values::subtract(kept, swapped));
+      auto const one = mpfr_values::from_integer(1);
+      return mpfr_cmp(ratio.fr(), one.fr()) < 0 ? ratio : one;
+    }
+
+    /// @brief Materialize output provenance for one rung.
+    /// @param rung Ladder index of @p manifold.
+    /// @param manifold State currently at @p rung.
+    /// @param artifact Kind of artifact being described.
+    /// @param completed_passes Number of passes completed before output.
+    /// @returns The rung's Metropolis provenance with the ladder and the swap
+    /// counts of the latest invocation.
+    /// @throws std::out_of_range If @p rung is not on the ladder.
+    [[nodiscard]] auto reproducibility_metadata(
+        std::size_t const rung, ManifoldType const& manifold,
+        utilities::ArtifactKind const artifact,
+        Int_precision const           completed_passes) const
+        -> utilities::Reproducibility_metadata
+    {
+      return make_reproducibility_metadata(rung, manifold, artifact,
+                                           completed_passes, m_statistics);
+    }
+
+    /// @brief Execute a fresh replica-exchange run.
+    /// @details Every rung starts from a copy of @p initial. Swap statistics
+    /// and checkpoint events are replaced only after the invocation
+    /// completes; replica and exchange streams continue across invocations.
+    /// @param initial Initial canonical state for every rung.
+    /// @returns The state at each rung after all configured passes complete,
+    /// in ladder order.
+    /// @throws std::filesystem::filesystem_error if checkpoint output is
+    /// enabled and persistence fails; also rethrows the first failure of a
+    /// replica pass.
+    [[nodiscard]] auto operator()(ManifoldType const& initial)
+        -> std::vector<ManifoldType>
+    {
+      auto manifolds  = std::vector<ManifoldType>(m_replicas.size(), initial);
+      auto statistics = ExchangeStatistics{
+          .attempted = Counts(m_replicas.size() - 1),
+          .accepted  = Counts(m_replicas.size() - 1)};
+      auto checkpoint_events = Int_precision{};
+
+      fmt::print("Starting parallel tempering over {} {} values in {}+1 "
+                 "dimensions ...\n",
+                 m_ladder.size(), format_as(m_coupling),
+                 ManifoldType::dimension - 1);
+      fmt::print("Effective random seed: {} (exchange stream {}).\n", seed(),
+                 m_exchange_random.stream());
+
+      for (auto pass_index = Int_precision{}; pass_index < m_cadence.passes();
+           ++pass_index)
+      {
+        auto const pass_number = pass_index + 1;
+        fmt::print("=== Pass {} ===\n", pass_number);
+        execute_replica_passes(manifolds);
+        exchange_sweep(manifolds, statistics, pass_index);
+
+        if (pass_number % m_cadence.checkpoint() == 0)
+        {
+          ++checkpoint_events;
+          print_results(manifolds, statistics);
+          if (m_write_files)
+          {
+            fmt::print("Writing checkpoints for pass {}.\n", pass_number);
+            for (std::size_t rung = 0; rung < manifolds.size(); ++rung)
+            {
+              utilities::write_file(
+                  manifolds[rung],
+                  make_reproducibility_metadata(
+                      rung, manifolds[rung],
+                      utilities::ArtifactKind::CHECKPOINT, pass_number,
+                      statistics));
+            }
+          }
+        }
+      }
+
+      fmt::print("=== Run results ===\n");
+      print_results(manifolds, statistics);
+      m_statistics        = std::move(statistics);
+      m_checkpoint_events = checkpoint_events;
+      return manifolds;
+    }
+  };  // Parallel tempering
+
+  /// Parallel-tempering strategy for the supported 3D manifold.
+  using ParallelTempering_3 =
+      MoveStrategy<MoveStrategyKind::PARALLEL_TEMPERING, manifolds::Manifold_3>;
+}  // namespace cdt
+
+#endif  // INCLUDE_PARALLEL_TEMPERING_HPP_
@@ -13,8 +13,13 @@
 #include <concepts>
 #include <cstdint>
 #include <limits>
+#include <locale>
+#include <optional>
 #include <ostream>
 #include <random>
+#include <sstream>
+#include <string>
+#include <string_view>
 
 #include "pcg_random.hpp"
 
@@ -96,6 +101,24 @@ namespace cdt
     inline constexpr RandomStream initialization{0};
     /// Stream reserved for stochastic state transitions.
     inline constexpr RandomStream transitions{1};
+    /// Stream reserved for replica-exchange swap decisions.
+    inline constexpr RandomStream exchange{2};
+    /// First transition stream of the per-replica range.
+    inline constexpr std::uint64_t first_replica{16};
+
+    /// @param index Zero-based replica index.
+    /// @return The transition stream owned by that replica.
+    [[nodiscard]] constexpr auto replica(std::uint64_t const index) noexcept
+        -> RandomStream
+    { return RandomStream{first_replica + index}; }
+    /// First transition stream of the per-chain ensemble range.
+    inline constexpr std::uint64_t first_chain{std::uint64_t{1} << 32};
+
+    /// @param index Zero-based ensemble chain index.
+    /// @return The transition stream owned by that chain.
+    [[nodiscard]] constexpr auto chain(std::uint64_t const index) noexcept
+        -> RandomStream
+    { return RandomStream{first_chain + index}; }
   }  // namespace random_streams
 
   /// @brief A run-owned PCG engine with a recorded seed and stream identifier.
@@ -169,6 +192,42 @@ namespace cdt
     /// @return A new engine at the beginning of the selected sequence.
     [[nodiscard]] auto split(RandomStream const stream) const -> Random
     { return Random{m_seed, stream}; }
+
+    /// @returns The engine position as PCG's text form: multiplier,
+    /// increment, and state in decimal, separated by spaces.
+    [[nodiscard]] auto state() const -> std::string
+    {
+      std::ostringstream output;
+      output.imbue(std::locale::classic());
+      output << m_engine;
+      return output.str();
+    }
+
+    /// @brief Recreate an engine at a position recorded by state().
+    /// @details The PCG state carries its stream but not its seed, so only
+    /// the stream is checked; @p seed is recorded as given.
+    /// @param seed Root seed of the recorded engine.
+    /// @param stream PCG stream selector of the recorded engine.
+    /// @param state Text returned by state().
+    /// @return The engine, which continues exactly where the recorded one
+    /// stopped, or an empty optional if @p state is malformed or belongs to
+    /// another stream.
+    [[nodiscard]] static auto restore(RandomSeed const       seed,
+                                      RandomStream const     stream,
+                                      std::string_view const state)
+        -> std::optional<Random>
+    {
+      auto               random = Random{seed, stream};
+      std::istringstream input{std::string{state}};
+      input.imbue(std::locale::classic());
+      input >> random.m_engine;
+      if (input.fail() || !(input >> std::ws).eof() ||
+          random.m_engine.stream() != stream.value())
+      {
+        return std::nullopt;
+      }
+      return random;
+    }
   };
 
   static_assert(std::uniform_random_bit_generator<Random>);
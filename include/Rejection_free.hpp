@@ -0,0 +1,519 @@
+/*******************************************************************************
+ Causal Dynamical Triangulations in C++ using CGAL
+
+ Copyright © 2026 Adam Getchell
+ ******************************************************************************/
+
+/// @file Rejection_free.hpp
+/// @brief Rejection-free (n-fold way) sampling of the Metropolis chain
+/// @details Selects only transitions Metropolis-Hastings would accept and
+/// advances a clock measured in equivalent Metropolis transitions.
+/// @see [Metropolis-Hastings
+/// algorithm](../REFERENCES.md#metropolis-hastings-algorithm)
+
+#ifndef INCLUDE_REJECTION_FREE_HPP_
+#define INCLUDE_REJECTION_FREE_HPP_
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <stdexcept>
+#include <utility>
+
+#include "Ergodic_moves_3.hpp"
+#include "Metropolis.hpp"
+#include "Move_run.hpp"
+#include "Move_strategy.hpp"
+#include "Random.hpp"
+#include "S3Action.hpp"
+#include "Utilities.hpp"
+
+namespace cdt
+{
+  /// @brief Result of one rejection-free transition
+  struct RejectionFreeTransition
+  {
+    /// @brief Move class selected in proportion to its acceptance weight
+    move_tracker::MoveType move;
+
+    /// @brief INAPPLICABLE, EXECUTION_FAILED, or METROPOLIS_ACCEPTED
+    ergodic_moves::MoveOutcome outcome;
+
+    /// @brief Expected Metropolis transitions spent in the state before it
+    long double residence;
+  };
+
+  /// @brief Rejection-free strategy equivalent to Metropolis-Hastings
+  /// @details A Metropolis transition selects move class \f$m\f$ with
+  /// probability 1/5, a raw site uniformly from its \f$C_m(T)\f$ sites, and
+  /// accepts a successful candidate with probability
+  /// \f$a_m = \min(1, e^{S(T)-S(T')} C_m(T)/C_{m^{-1}}(T'))\f$. Every move
+  /// has a fixed geometry delta, so \f$a_m\f$ depends only on the counts of
+  /// \f$T\f$ and is the same for every site of the class. The acceptance
+  /// draw is therefore independent of the site: a transition whose draw
+  /// fails is a self-transition whatever the site would have done.
+  ///
+  /// This strategy samples only the transitions whose draw succeeds. Such a
+  /// transition has probability \f$W = \sum_m a_m / 5\f$, so it selects
+  /// class \f$m\f$ with probability \f$a_m / (5W)\f$ and a uniform raw site,
+  /// and commits the move if the site can host it. The state sequence is the
+  /// Metropolis sequence with its rejected draws removed. Each transition
+  /// credits the \f$1/W\f$ Metropolis transitions expected in the state, so
+  /// a time average weights each state by its residence.
+  ///
+  /// Inapplicable sites and refused flips are still explicit
+  /// self-transitions: a site's applicability is known only by preparing
+  /// it, and (2,3) and (3,2) flips only by attempting them.
+  ///
+  /// @tparam ManifoldType The type of Manifold on which to apply the algorithm
+  template <typename ManifoldType>
+    requires(ManifoldType::dimension == 3)
+  class MoveStrategy<MoveStrategyKind::REJECTION_FREE, ManifoldType>
+  {
+    using Metropolis =
+        MoveStrategy<MoveStrategyKind::METROPOLIS, ManifoldType>;
+    using Counter        = move_tracker::MoveTracker;
+    using CommandResults = detail::MoveCommandResults<ManifoldType>;
+    using Weights = std::array<long double, move_tracker::NUMBER_OF_3D_MOVES>;
+
+    struct RunStatistics
+    {
+      /// @brief Compact fingerprint of ordered transition outcomes
+      std::uint64_t transition_trace{14695981039346656037ULL};
+
+      /// @brief Number of transition records in the fingerprint
+      std::uint64_t transition_count{};
+
+      /// @brief Move classes selected by acceptance weight
+      Counter selected;
+
+      /// @brief Selections committed as state transitions
+      Counter accepted;
+
+      /// @brief Equivalent Metropolis transitions elapsed
+      long double metropolis_time{};
+    };
+
+    using PassResult = detail::MovePassResult<ManifoldType, RunStatistics>;
+
+    /// @brief Validated physical parameters used by every action evaluation
+    s3_action::PhysicalParameters m_parameters;
+
+    /// @brief \f$e^{S(T)-S(T')}\f$ of each move's fixed delta, by move index
+    Weights m_action_factors;
+
+    /// @brief Positive pass and checkpoint cadence
+    MoveRunCadence m_cadence;
+
+    /// @brief Whether checkpoint files may be written
+    bool m_write_files{true};
+
+    /// @brief Run-owned random engine used for class and site draws
+    cdt::Random m_generator;
+
+    /// @brief Immutable run provenance, refreshed with state at each output.
+    utilities::Reproducibility_metadata m_reproducibility;
+
+    /// @brief Command counters from the latest completed invocation
+    CommandResults m_command_results;
+
+    /// @brief Transition statistics from the latest completed invocation
+    RunStatistics m_run_statistics;
+
+    /// @brief Checkpoint events from the latest completed invocation
+    Int_precision m_checkpoint_events{};
+
+    static void record_transition(
+        RunStatistics& statistics, move_tracker::MoveType const move,
+        ergodic_moves::MoveOutcome const outcome) noexcept
+    {
+      auto const append = [&statistics](std::uint8_t const value) {
+        statistics.transition_trace ^= value;
+        statistics.transition_trace *= 1099511628211ULL;
+      };
+      append(static_cast<std::uint8_t>(move));
+      append(static_cast<std::uint8_t>(outcome));
+      ++statistics.transition_count;
+    }
+
+    /// @returns \f$e^{-\Delta S}\f$ for the geometry delta of each move,
+    /// rounded once to long double.
+    [[nodiscard]] static auto make_action_factors(
+        s3_action::PhysicalParameters const& parameters) -> Weights
+    {
+      Weights factors{};
+      for (auto index = std::size_t{0}; index < factors.size(); ++index)
+      {
+        auto const move  = *move_tracker::move_from_index(index);
+        auto const delta = *ergodic_moves::detail::moved_geometry(
+            Geometry<ManifoldType::dimension>{}, move);
+        auto const factor = mpfr_values::exponential(
+            mpfr_values::negate(s3_action::detail::linear_action(
+                parameters.bulk_coefficients(), delta.N1_TL, delta.N3_31_13,
+                delta.N3_22)));
+        factors[index] = mpfr_get_ld(factor.fr(), MPFR_RNDN);
+      }
+      return factors;
+    }
+
+    [[nodiscard]] static auto select_move(Weights const&    weights,
+                                          long double const target)
+        -> move_tracker::MoveType
+    {
+      auto cumulative = 0.0L;
+      auto selected   = std::size_t{0};
+      for (auto index = std::size_t{0}; index < weights.size(); ++index)
+      {
+        if (weights[index] <= 0.0L) { continue; }
+        selected = index;
+        cumulative += weights[index];
+        if (target < cumulative) { break; }
+      }
+      return *move_tracker::move_from_index(selected);
+    }
+
+    auto resolve_transition(ManifoldType&                current,
+                            CommandResults&              command_results,
+                            RunStatistics&               statistics,
+                            move_tracker::MoveType const move)
+        -> ergodic_moves::MoveOutcome
+    {
+      ++statistics.selected[move];
+      ++command_results.attempted[move];
+
+      auto       transaction = current.begin_transaction();
+      auto const applied =
+          ergodic_moves::prepare_move(transaction, move, m_generator)
+              .and_then([&transaction, this](
+                            ergodic_moves::PreparedMove const& candidate) {
+                return candidate.apply(transaction, m_generator);
+              });
+      if (!applied)
+      {
+        transaction.rollback();
+        ++command_results.failed[move];
+        auto const outcome = ergodic_moves::outcome_from(applied.error());
+        record_transition(statistics, move, outcome);
+        return outcome;
+      }
+      transaction.stage();
+      if (!ergodic_moves::detail::check_move(transaction, move))
+      {
+        transaction.rollback();
+        ++command_results.failed[move];
+        record_transition(statistics, move,
+                          ergodic_moves::MoveOutcome::EXECUTION_FAILED);
+        return ergodic_moves::MoveOutcome::EXECUTION_FAILED;
+      }
+
+      // The acceptance draw was made when the class was selected.
+      transaction.commit();
+      ++command_results.succeeded[move];
+      ++statistics.accepted[move];
+      record_transition(statistics, move,
+                        ergodic_moves::MoveOutcome::METROPOLIS_ACCEPTED);
+      return ergodic_moves::MoveOutcome::METROPOLIS_ACCEPTED;
+    }
+
+    [[nodiscard]] auto sample_transition(ManifoldType&   current,
+                                         CommandResults& command_results,
+                                         RunStatistics&  statistics)
+        -> RejectionFreeTransition
+    {
+      auto const weights = acceptance_weights(current.geometry());
+      auto const total   = std::ranges::fold_left(weights, 0.0L, std::plus{});
+      if (!(total > 0.0L))
+      {
+        throw std::logic_error{
+            "No move class can be accepted from this triangulation."};
+      }
+      auto const residence =
+          static_cast<long double>(move_tracker::NUMBER_OF_3D_MOVES) / total;
+      auto const move = select_move(
+          weights, total * utilities::generate_probability(m_generator));
+      statistics.metropolis_time += residence;
+      return {.move      = move,
+              .outcome   = resolve_transition(current, command_results,
+                                              statistics, move),
+              .residence = residence};
+    }
+
+    [[nodiscard]] auto execute_pass(ManifoldType        current,
+                                    RunStatistics       statistics,
+                                    Int_precision const attempts) -> PassResult
+    {
+      auto       command_results = CommandResults{};
+      auto const pass_end =
+          statistics.metropolis_time + static_cast<long double>(attempts);
+      while (statistics.metropolis_time < pass_end)
+      {
+        static_cast<void>(
+            sample_transition(current, command_results, statistics));
+      }
+      return {.manifold        = std::move(current),
+              .command_results = std::move(command_results),
+              .strategy_state  = std::move(statistics)};
+    }
+
+    [[nodiscard]] auto make_reproducibility_metadata(
+        ManifoldType const& manifold, utilities::ArtifactKind const artifact,
+        Int_precision const  completed_passes,
+        RunStatistics const& statistics) const
+        -> utilities::Reproducibility_metadata
+    {
+      auto metadata             = m_reproducibility;
+      metadata.artifact         = artifact;
+      metadata.completed_passes = completed_passes;
+      metadata.transition_trace = statistics.transition_trace;
+      metadata.transition_count = statistics.transition_count;
+      metadata.metropolis_time  = statistics.metropolis_time;
+      utilities::update_reproducibility_state(metadata, manifold);
+      if (metadata.desired_simplices == 0)
+      {
+        metadata.desired_simplices = manifold.N3();
+      }
+      if (metadata.desired_timeslices == 0)
+      {
+        metadata.desired_timeslices = manifold.max_time();
+      }
+      return metadata;
+    }
+
+    static void print_results(CommandResults const& command_results,
+                              RunStatistics const&  statistics)
+    {
+      fmt::print("=== Move Results ===\n");
+      fmt::print(
+          "{} rejection-free transitions stood for {} Metropolis "
+          "transitions; {} were accepted and {} selected sites failed.\n",
+          statistics.selected.total(), statistics.metropolis_time,
+          statistics.accepted.total(), command_results.failed.total());
+      fmt::print(
+          "Accepted (2,3): {}, (3,2): {}, (2,6): {}, (6,2): {}, (4,4): {}.\n",
+          statistics.accepted.two_three_moves(),
+          statistics.accepted.three_two_moves(),
+          statistics.accepted.two_six_moves(),
+          statistics.accepted.six_two_moves(),
+          statistics.accepted.four_four_moves());
+    }
+
+   public:
+    MoveStrategy() = delete;
+
+    /// @brief Construct a run from an already selected PCG stream.
+    /// @param alpha Timelike edge length.
+    /// @param k Normalized Newton constant.
+    /// @param lambda Normalized cosmological constant.
+    /// @param passes Number of passes to execute. A pass lasts
+    /// \f$N_3\f$ equivalent Metropolis transitions.
+    /// @param checkpoint Interval between checkpoint events.
+    /// @param write_files Whether checkpoint events may write files.
+    /// @param random Random-number stream owned by this strategy.
+    /// @param reproducibility Optional initialization and requested-state
+    /// provenance to merge with the effective run configuration.
+    /// @throws std::invalid_argument If a coupling is non-finite or either
+    /// cadence value is nonpositive.
+    /// @throws std::domain_error If `alpha` is not greater than 1/2.
+    MoveStrategy(long double const alpha, long double const k,
+                 long double const lambda, Int_precision const passes,
+                 Int_precision const checkpoint, bool const write_files,
+                 cdt::Random random,
+                 std::optional<utilities::Reproducibility_metadata>
+                     reproducibility = std::nullopt)
+        : m_parameters{s3_action::make_physical_parameters(alpha, k, lambda)}
+        , m_action_factors{make_action_factors(m_parameters)}
+        , m_cadence{detail::parse_move_run_cadence(passes, checkpoint,
+                                                   "Rejection-free")}
+        , m_write_files{write_files}
+        , m_generator{std::move(random)}
+        , m_reproducibility{reproducibility.value_or(
+              utilities::Reproducibility_metadata{})}
+    {
+      m_reproducibility.seed                = m_generator.seed();
+      m_reproducibility.transition_stream   = m_generator.stream();
+      m_reproducibility.alpha               = m_parameters.alpha();
+      m_reproducibility.k                   = m_parameters.k();
+      m_reproducibility.lambda              = m_parameters.lambda();
+      m_reproducibility.configured_passes   = m_cadence.passes();
+      m_reproducibility.checkpoint_interval = m_cadence.checkpoint();
+    }
+
+    /// @returns The length of the timelike edge
+    [[nodiscard]] auto alpha() const noexcept { return m_parameters.alpha(); }
+
+    /// @returns The normalized Newton's constant
+    [[nodiscard]] auto k() const noexcept { return m_parameters.k(); }
+
+    /// @returns The normalized cosmological constant
+    [[nodiscard]] auto lambda() const noexcept { return m_parameters.lambda(); }
+
+    /// @returns The volume-fixing term added to the action
+    [[nodiscard]] auto volume_fixing() const noexcept
+        -> s3_action::VolumeFixing const&
+    { return m_parameters.volume_fixing(); }
+
+    /// @brief Add a volume-fixing potential to the sampled action.
+    /// @param volume The term used by subsequent transitions.
+    /// @throws std::invalid_argument If an enabled term is out of range.
+    void set_volume_fixing(s3_action::VolumeFixing const& volume)
+    {
+      m_parameters = s3_action::make_physical_parameters(alpha(), k(),
+                                                         lambda(), volume);
+      m_reproducibility.volume_fixing = volume_fixing_metadata(volume);
+    }
+
+    /// @returns The number of passes to make
+    [[nodiscard]] auto passes() const noexcept { return m_cadence.passes(); }
+
+    /// @returns The number of passes before writing checkpoint files
+    [[nodiscard]] auto checkpoint() const noexcept
+    { return m_cadence.checkpoint(); }
+
+    /// @returns Checkpoint events completed by the latest invocation.
+    [[nodiscard]] auto checkpoint_events() const noexcept
+    { return m_checkpoint_events; }
+
+    /// @returns The effective root seed used for this run.
+    [[nodiscard]] auto seed() const noexcept { return m_generator.seed(); }
+
+    /// @returns The PCG stream selector used for transitions.
+    [[nodiscard]] auto stream() const noexcept { return m_generator.stream(); }
+
+    /// @returns FNV-1a fingerprint of the ordered move/outcome trace.
+    [[nodiscard]] auto transition_trace() const noexcept
+    { return m_run_statistics.transition_trace; }
+
+    /// @returns Number of transitions represented by transition_trace().
+    [[nodiscard]] auto transition_count() const noexcept
+    { return m_run_statistics.transition_count; }
+
+    /// @returns Equivalent Metropolis transitions elapsed
+    [[nodiscard]] auto metropolis_time() const noexcept
+    { return m_run_statistics.metropolis_time; }
+
+    /// @returns The MoveTracker of move classes selected
+    [[nodiscard]] auto selected() const noexcept -> Counter const&
+    { return m_run_statistics.selected; }
+
+    /// @returns The MoveTracker of committed transitions
+    [[nodiscard]] auto accepted() const noexcept -> Counter const&
+    { return m_run_statistics.accepted; }
+
+    /// @returns The MoveTracker of attempted candidate constructions
+    [[nodiscard]] auto attempted() const noexcept -> Counter const&
+    { return m_command_results.attempted; }
+
+    /// @returns The MoveTracker of successful candidate constructions
+    [[nodiscard]] auto succeeded() const noexcept -> Counter const&
+    { return m_command_results.succeeded; }
+
+    /// @returns The MoveTracker of inapplicable or failed selected sites
+    [[nodiscard]] auto failed() const noexcept -> Counter const&
+    { return m_command_results.failed; }
+
+    /// @brief Calculate the Metropolis acceptance of each move class.
+    /// @details Any volume-fixing factor is included. A class with no raw
+    /// sites, or whose reverse move would have no raw sites afterwards, can
+    /// never be accepted and has weight zero.
+    /// @param geometry Geometry of the current triangulation.
+    /// @returns \f$a_m = \min(1, e^{S(T)-S(T')}C_m(T)/C_{m^{-1}}(T'))\f$ by
+    /// move index.
+    [[nodiscard]] auto acceptance_weights(
+        Geometry<ManifoldType::dimension> const& geometry) const -> Weights
+    {
+      Weights weights{};
+      for (auto index = std::size_t{0}; index < weights.size(); ++index)
+      {
+        auto const move     = *move_tracker::move_from_index(index);
+        auto const proposed =
+            ergodic_moves::detail::moved_geometry(geometry, move);
+        if (!proposed) { continue; }
+        auto const forward = Metropolis::proposal_site_count(geometry, move);
+        auto const reverse = Metropolis::proposal_site_count(
+            *proposed, *Metropolis::reverse_move(move));
+        if (forward <= 0 || reverse <= 0) { continue; }
+        auto const volume_factor = std::exp(s3_action::volume_exponent(
+            geometry.N3, proposed->N3, m_parameters.volume_fixing()));
+        weights[index] =
+            std::min(1.0L, m_action_factors[index] * volume_factor *
+                               static_cast<long double>(forward) /
+                               static_cast<long double>(reverse));
+      }
+      return weights;
+    }
+
+    /// @brief Sample and resolve one rejection-free transition.
+    /// @param current Canonical state, updated when the selected site can
+    /// host the move.
+    /// @returns The selected class, its outcome, and the residence credited.
+    /// @throws std::logic_error If no move class can be accepted.
+    [[nodiscard]] auto attempt_transition(ManifoldType& current)
+        -> RejectionFreeTransition
+    { return sample_transition(current, m_command_results, m_run_statistics); }
+
+    /// @brief Materialize output provenance for the supplied canonical state.
+    /// @param manifold Canonical state represented by the output artifact.
+    /// @param artifact Kind of artifact being described.
+    /// @param completed_passes Number of passes completed before output.
+    /// @returns Provenance including the equivalent Metropolis time.
+    [[nodiscard]] auto reproducibility_metadata(
+        ManifoldType const& manifold, utilities::ArtifactKind const artifact,
+        Int_precision const completed_passes) const
+        -> utilities::Reproducibility_metadata
+    {
+      return make_reproducibility_metadata(manifold, artifact, completed_passes,
+                                           m_run_statistics);
+    }
+
+    /// @brief Execute a fresh run while continuing the owned random stream.
+    /// @details Counters, statistics, and checkpoint events are replaced only
+    /// after the invocation completes.
+    /// @param t_manifold Initial canonical state for the run.
+    /// @returns Canonical state after all configured passes complete.
+    /// @throws std::filesystem::filesystem_error if checkpoint output is
+    /// enabled and persistence fails; also propagates failures from move
+    /// generation and validation.
+    [[nodiscard]] auto operator()(ManifoldType const& t_manifold)
+        -> ManifoldType
+    {
+      auto result = detail::execute_move_run(
+          t_manifold, RunStatistics{}, m_cadence,
+          detail::MoveRunIdentity{.algorithm = "rejection-free Metropolis",
+                                  .seed      = seed(),
+                                  .stream    = stream()},
+          m_write_files,
+          [this](ManifoldType current, RunStatistics statistics,
+                 Int_precision const attempts) {
+            return execute_pass(std::move(current), std::move(statistics),
+                                attempts);
+          },
+          [](ManifoldType const&, CommandResults const& command_results,
+             RunStatistics const& statistics) {
+            print_results(command_results, statistics);
+          },
+          [this](ManifoldType const&  current, CommandResults const&,
+                 RunStatistics const& statistics,
+                 Int_precision const  pass_number) {
+            utilities::write_file(
+                current, make_reproducibility_metadata(
+                             current, utilities::ArtifactKind::CHECKPOINT,
+                             pass_number, statistics));
+          });
+
+      m_command_results   = std::move(result.command_results);
+      m_run_statistics    = std::move(result.strategy_state);
+      m_checkpoint_events = result.checkpoint_events;
+      return std::move(result.manifold);
+    }
+  };  // Rejection-free
+
+  /// Rejection-free Metropolis strategy for the supported 3D manifold.
+  using RejectionFree_3 =
+      MoveStrategy<MoveStrategyKind::REJECTION_FREE, manifolds::Manifold_3>;
+}  // namespace cdt
+
+#endif  // INCLUDE_REJECTION_FREE_HPP_
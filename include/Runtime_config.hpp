@@ -16,6 +16,7 @@
 #include <stdexcept>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "Random.hpp"
 #include "Utilities.hpp"
@@ -177,6 +178,42 @@ namespace cdt::runtime_config
     { return m_write_files; }
   };
 
+  /// Validated chain, worker, and tempering options for one process.
+  /// @details Instances can only be created by make_sampling(). A single
+  /// chain with an empty ladder is the ordinary Metropolis run.
+  class Sampling
+  {
+    friend auto make_sampling(long long chains, long long workers,
+                              std::vector<long double> ladder) -> Sampling;
+
+    std::size_t              m_chains;
+    std::size_t              m_workers;
+    std::vector<long double> m_ladder;
+
+    explicit Sampling(std::size_t const chains, std::size_t const workers,
+                      std::vector<long double> ladder) noexcept
+        : m_chains{chains}, m_workers{workers}, m_ladder{std::move(ladder)}
+    {}
+
+   public:
+    /// @return Positive number of independent chains.
+    [[nodiscard]] auto chains() const noexcept -> std::size_t
+    { return m_chains; }
+
+    /// @return Positive maximum number of chain or replica worker threads.
+    [[nodiscard]] auto workers() const noexcept -> std::size_t
+    { return m_workers; }
+
+    /// @return Finite tempered coupling values, empty without tempering.
+    [[nodiscard]] auto ladder() const noexcept
+        -> std::vector<long double> const&
+    { return m_ladder; }
+
+    /// @return Whether the run exchanges replicas along a coupling ladder.
+    [[nodiscard]] auto tempering() const noexcept -> bool
+    { return !m_ladder.empty(); }
+  };
+
   namespace detail
   {
     template <typename FloatingPoint>
@@ -395,6 +432,52 @@ namespace cdt::runtime_config
                       checked_lambda, checked_passes, checked_checkpoint,
                       write_files};
   }
+  /// @brief Validate the chain, worker, and tempering options.
+  /// @details Unlike `--threads`, workers run whole chains or replicas, so
+  /// they are available in the canonical serial build.
+  /// @param chains Positive number of independent Metropolis chains.
+  /// @param workers Positive maximum number of worker threads.
+  /// @param ladder Tempered coupling values; empty for no tempering.
+  /// @return A validated sampling configuration.
+  /// @throws std::invalid_argument for a nonpositive count, a ladder with one
+  /// rung or a non-finite value, or tempering combined with several chains.
+  /// @throws std::out_of_range when a count exceeds the supported size range.
+  [[nodiscard]] inline auto make_sampling(long long const          chains,
+                                          long long const          workers,
+                                          std::vector<long double> ladder)
+      -> Sampling
+  {
+    if (chains <= 0)
+    {
+      throw std::invalid_argument("Chain count must be positive.");
+    }
+    if (workers <= 0)
+    {
+      throw std::invalid_argument("Worker count must be positive.");
+    }
+    if (!std::in_range<std::size_t>(chains) ||
+        !std::in_range<std::size_t>(workers))
+    {
+      throw std::out_of_range(
+          "Chain or worker count exceeds the supported size range.");
+    }
+    for (auto const value : ladder)
+    {
+      static_cast<void>(detail::checked_finite("Ladder value", value));
+    }
+    if (ladder.size() == 1)
+    {
+      throw std::invalid_argument(
+          "A tempering ladder needs at least two values.");
+    }
+    if (!ladder.empty() && chains != 1)
+    {
+      throw std::invalid_argument(
+          "Parallel tempering runs one chain per ladder value; omit --chains.");
+    }
+    return Sampling{static_cast<std::size_t>(chains),
+                    static_cast<std::size_t>(workers), std::move(ladder)};
+  }
 }  // namespace cdt::runtime_config
 
 #endif  // CDT_PLUSPLUS_RUNTIME_CONFIG_HPP
@@ -20,7 +20,10 @@
 #define INCLUDE_S3ACTION_HPP_
 
 #include <cmath>
+#include <cstdint>
+#include <cstdlib>
 #include <stdexcept>
+#include <string_view>
 #include <utility>
 
 #include "Mpfr_value.hpp"
@@ -30,45 +33,381 @@
 
 namespace cdt::s3_action
 {
+  /// @brief MPFR coefficients of an S3 bulk action, which is linear in
+  /// \f$N_1^{TL}\f$, \f$N_3^{(3,1)}\f$, and \f$N_3^{(2,2)}\f$.
+  /// @details The coefficients depend only on the couplings, so they are
+  /// evaluated once and an action then costs three products and two sums.
+  struct ActionCoefficients
+  {
+    /// @brief Coefficient of the number of timelike links
+    mpfr_values::Value n1_tl;
+
+    /// @brief Coefficient of the number of (3,1) and (1,3) simplices
+    mpfr_values::Value n3_31_13;
+
+    /// @brief Coefficient of the number of (2,2) simplices
+    mpfr_values::Value n3_22;
+  };
+
+  namespace detail
+  {
+    [[nodiscard]] inline auto make_finite_couplings(long double const k,
+                                                    long double const lambda)
+        -> std::pair<long double, long double>
+    {
+      if (!std::isfinite(k) || !std::isfinite(lambda))
+      {
+        throw std::invalid_argument("Physical parameters must be finite.");
+      }
+      return {k, lambda};
+    }
+
+    /// @returns The action with @p coefficients at the given simplex counts.
+    [[nodiscard]] inline auto linear_action(
+        ActionCoefficients const& coefficients,
+        Int_precision const n1_tl_count, Int_precision const n3_31_13_count,
+        Int_precision const n3_22_count) -> mpfr_values::Value
+    {
+      auto const n1_tl = mpfr_values::from_integer(n1_tl_count);
+      auto const n3_31 = mpfr_values::from_integer(n3_31_13_count);
+      auto const n3_22 = mpfr_values::from_integer(n3_22_count);
+
+      auto const first  = mpfr_values::multiply(coefficients.n1_tl, n1_tl);
+      auto const second = mpfr_values::multiply(n3_31, coefficients.n3_31_13);
+      auto const third  = mpfr_values::multiply(n3_22, coefficients.n3_22);
+
+      // Result is third+(first+second)
+      return mpfr_values::add(third, mpfr_values::add(first, second));
+    }
+
+    /// @returns Coefficients of the \f$\alpha=-1\f$ imaginary coefficient.
+    [[nodiscard]] inline auto alpha_minus_one_imaginary_coefficients(
+        long double const k_value, long double const lambda_value)
+        -> ActionCoefficients
+    {
+      auto const [checked_k, checked_lambda] =
+          make_finite_couplings(k_value, lambda_value);
+
+      // Set input parameters and constants to MPFR equivalents
+      auto const k         = mpfr_values::from_long_double(checked_k);
+      auto const lambda    = mpfr_values::from_long_double(checked_lambda);
+      auto const two       = mpfr_values::from_integer(2);
+      auto const pi        = mpfr_values::pi();
+      auto const const2673 = mpfr_values::from_decimal("2.673");
+      auto const const118  = mpfr_values::from_decimal("0.118");
+      auto const const7386 = mpfr_values::from_decimal("7.386");
+
+      // First coefficient is -r2
+      auto const r1 = mpfr_values::multiply(two, pi);  // r1 = 2*pi
+      auto const r2 = mpfr_values::multiply(r1, k);    // r2 = 2*pi*k
+
+      // Second coefficient is r6
+      auto const r4 = mpfr_values::multiply(const2673, k);  // r4 = 2.673*k
+      auto const r5 =
+          mpfr_values::multiply(const118, lambda);  // r5 = 0.118*lambda
+      auto const r6 = mpfr_values::add(r4, r5);     // r6 = r4 + r5
+
+      // Third coefficient is r10
+      auto const r8 = mpfr_values::multiply(const7386, k);  // r8 = 7.386*k
+      auto const r9 =
+          mpfr_values::multiply(const118, lambda);  // r9 = 0.118*lambda
+      auto const r10 = mpfr_values::add(r8, r9);    // r10 = r8+r9
+
+      return {.n1_tl    = mpfr_values::negate(r2),
+              .n3_31_13 = r6,
+              .n3_22    = r10};
+    }  // alpha_minus_one_imaginary_coefficients()
+
+    /// @returns Coefficients of the \f$\alpha=1\f$ action.
+    [[nodiscard]] inline auto alpha_one_coefficients(
+        long double const k_value, long double const lambda_value)
+        -> ActionCoefficients
+    {
+      auto const [checked_k, checked_lambda] =
+          make_finite_couplings(k_value, lambda_value);
+
+      // Set input parameters and constants to MPFR equivalents
+      auto const k         = mpfr_values::from_long_double(checked_k);
+      auto const lambda    = mpfr_values::from_long_double(checked_lambda);
+      auto const two       = mpfr_values::from_integer(2);
+      auto const pi        = mpfr_values::pi();
+      auto const const3548 = mpfr_values::from_decimal("-3.548");
+      auto const const167  = mpfr_values::from_decimal("-0.167");
+      auto const const5355 = mpfr_values::from_decimal("-5.355");
+      auto const const204  = mpfr_values::from_decimal("-0.204");
+
+      // First coefficient is r2
+      auto const r1 = mpfr_values::multiply(two, pi);  // r1 = 2*pi
+      auto const r2 = mpfr_values::multiply(r1, k);    // r2 = 2*pi*k
+
+      // Second coefficient is r6
+      auto const r4 = mpfr_values::multiply(const3548, k);  // r4 = -3.548*k
+      auto const r5 =
+          mpfr_values::multiply(const167, lambda);  // r5 = -0.167*lambda
+      auto const r6 = mpfr_values::add(r4, r5);     // r6 = r4 + r5
+
+      // Third coefficient is r10
+      auto const r8 = mpfr_values::multiply(const5355, k);  // r8 = -5.355*k
+      auto const r9 =
+          mpfr_values::multiply(const204, lambda);  // r9 = -0.204*lambda
+      auto const r10 = mpfr_values::add(r8, r9);    // r10 = r8+r9
+
+      return {.n1_tl = r2, .n3_31_13 = r6, .n3_22 = r10};
+    }  // alpha_one_coefficients()
+
+    /// @returns Coefficients of the generalized action.
+    /// @pre @p alpha_value, @p k_value, and @p lambda_value are validated.
+    [[nodiscard]] inline auto bulk_coefficients(long double const alpha_value,
+                                                long double const k_value,
+                                                long double const lambda_value)
+        -> ActionCoefficients
+    {
+      // Set input parameters and constants to MPFR equivalents
+      auto const alpha  = mpfr_values::from_long_double(alpha_value);
+      auto const k      = mpfr_values::from_long_double(k_value);
+      auto const lambda = mpfr_values::from_long_double(lambda_value);
+      auto const two    = mpfr_values::from_integer(2);
+      auto const pi     = mpfr_values::pi();
+      auto const three  = mpfr_values::from_integer(3);
+      auto const four   = mpfr_values::from_integer(4);
+      auto const one    = mpfr_values::from_integer(1);
+      auto const twelve = mpfr_values::from_integer(12);
+
+      // First coefficient is r4
+      auto const r1     = mpfr_values::multiply(two, pi);   // r1 = 2*pi
+      auto const r2     = mpfr_values::multiply(r1, k);     // r2 = 2*pi*k
+      auto const r3     = mpfr_values::square_root(alpha);  // r3 = sqrt(alpha)
+      auto const r4 =
+          mpfr_values::multiply(r3, r2);  // r4 = r3*r2 = 2*pi*k*sqrt(alpha)
+
+      // Second coefficient is r29
+      auto const r6 = mpfr_values::square_root(three);     // r6 = sqrt(3)
+      auto const r7 = mpfr_values::multiply(four, alpha);  // r7 = 4*alpha
+      auto const r8 = mpfr_values::add(one, r7);  // r8 = r7+1 = 4*alpha+1
+      auto const r9 =
+          mpfr_values::square_root(r8);  // r9 = sqrt(r8) = sqrt(4*alpha+1)
+      auto const r10 = mpfr_values::multiply(r6, r9);  // r10 = r6*r9
+      auto const r11 = mpfr_values::divide(one, r10);  // r11 = 1/r10
+      auto const r12 =
+          mpfr_values::inverse_hyperbolic_sine(r11);   // r12 = arcsinh(r11)
+      auto const r13 = mpfr_values::negate(three);     // r13 = -3
+      auto const r14 = mpfr_values::multiply(r13, k);  // r14 = r13*k = -3*k
+      // r15 = r14*r12 = -3*k*arcsinh(r11)
+      auto const r15 = mpfr_values::multiply(r14, r12);
+
+      auto const r16 = mpfr_values::multiply(two, alpha);  // r16 = 2*alpha
+      auto const r17 = mpfr_values::add(r16, one);         // r17 = 2*alpha+1
+      auto const r18 =
+          mpfr_values::divide(r17, r8);  // r18 = (2*alpha+1)/(4*alpha+1)
+      auto const r19 = mpfr_values::arc_cosine(r18);  // r19 = arccos(r18)
+      auto const r20 =
+          mpfr_values::multiply(r14, r3);  // r20 = -3*k*sqrt(alpha)
+      auto const r21 = mpfr_values::multiply(
+          r20, r19);  // r21 = -3*k*sqrt(alpha)*arccos(r18)
+
+      auto const r22 = mpfr_values::multiply(three, alpha);  // r22 = 3*alpha
+      auto const r23 = mpfr_values::add(r22, one);  // r23 = 3*alpha+1
+      auto const r24 =
+          mpfr_values::square_root(r23);  // r24 = sqrt(3*alpha+1)
+      auto const r25 = mpfr_values::negate(lambda);       // r25 = -lambda
+      auto const r26 = mpfr_values::divide(r25, twelve);  // r26 = -lambda/12
+      auto const r27 = mpfr_values::multiply(
+          r26, r24);  // r27 = (-lambda/12)*sqrt(3*alpha+1)
+
+      // Accumulate partial sums of second coefficient
+      auto const r28 = mpfr_values::add(r15, r21);  // r28 = r15+r21
+      auto const r29 = mpfr_values::add(r28, r27);  // r29 = r28+r27
+
+      // Third coefficient is r50
+      auto const r31 = mpfr_values::multiply(two, k);    // r31 = 2*k
+      auto const r32 = mpfr_values::square_root(two);    // r32 = sqrt(2)
+      auto const r33 = mpfr_values::multiply(two, r32);  // r33 = 2*sqrt(2)
+      auto const r34 =
+          mpfr_values::square_root(r17);  // r34 = sqrt(2*alpha+1)
+      auto const r35 = mpfr_values::multiply(r33, r34);  // r35 = r33*r34
+      auto const r36 =
+          mpfr_values::divide(r35, r8);  // r36 = 2*sqrt(2)*sqrt(2*alpha+1)/
+                                         //       4*alpha+1
+      auto const r37 =
+          mpfr_values::inverse_hyperbolic_sine(r36);  // r37 = arcsinh(r36)
+      auto const r38 =
+          mpfr_values::multiply(r31, r37);  // r38 = 2*k*arcsinh(r36)
+
+      auto const r39 = mpfr_values::negate(one);      // r39 = -1
+      auto const r40 = mpfr_values::divide(r39, r8);  // r40 = -1/(4*alpha+1)
+      auto const r41 = mpfr_values::arc_cosine(r40);  // r41 = arccos(r40)
+      auto const r42 = mpfr_values::negate(four);     // r42 = -4
+      auto const r43 = mpfr_values::multiply(r42, k);  // r43 = -4*k
+      auto const r44 =
+          mpfr_values::multiply(r43, r3);  // r44 = -4*k*sqrt(alpha)
+      auto const r45 = mpfr_values::multiply(
+          r44, r41);  // r45 = -4*k*sqrt(alpha)*arccos(r40)
+
+      auto const r46 = mpfr_values::add(r7, two);  // r46 = 4*alpha+2
+      auto const r47 =
+          mpfr_values::square_root(r46);  // r47 = sqrt(4*alpha+2)
+      auto const r48 = mpfr_values::multiply(
+          r26, r47);  // r48 = (-lambda/12)*sqrt(4*alpha+2)
+
+      // Accumulate partial sums of third coefficient
+      auto const r49 = mpfr_values::add(r38, r45);  // r49 = r38+r45
+      auto const r50 = mpfr_values::add(r49, r48);  // r50 = r49+r48
+
+      return {.n1_tl = r4, .n3_31_13 = r29, .n3_22 = r50};
+    }  // bulk_coefficients()
+  }  // namespace detail
+
+  /// @brief Shape of the optional volume-fixing potential
+  enum class VolumePotential : std::uint8_t
+  {
+    NONE,      ///< No volume fixing.
+    LINEAR,    ///< \f$\epsilon|N_3-\bar{N}_3|\f$
+    QUADRATIC  ///< \f$\epsilon(N_3-\bar{N}_3)^2\f$
+  };
+
+  /// @brief Volume-fixing term \f$V(N_3)\f$ added to the bulk action
+  /// @details Construct enabled instances with make_volume_fixing().
+  struct VolumeFixing
+  {
+    /// @brief Shape of the potential
+    VolumePotential potential{VolumePotential::NONE};
+
+    /// @brief Strength \f$\epsilon\f$ of the potential
+    long double epsilon{};
+
+    /// @brief Target volume \f$\bar{N}_3\f$
+    Int_precision target{};
+
+    /// @returns True unless the potential is NONE
+    [[nodiscard]] auto enabled() const noexcept -> bool
+    { return potential != VolumePotential::NONE; }
+  };
+
+  /// @brief Validate a volume-fixing term.
+  /// @param potential Shape of the potential.
+  /// @param epsilon Strength; must be finite and positive unless
+  /// @p potential is NONE.
+  /// @param target Target volume; must be positive unless @p potential is
+  /// NONE.
+  /// @returns The validated term, or a disabled term for NONE.
+  /// @throws std::invalid_argument If an enabled term is out of range.
+  [[nodiscard]] inline auto make_volume_fixing(VolumePotential const potential,
+                                               long double const epsilon,
+                                               Int_precision const target)
+      -> VolumeFixing
+  {
+    if (potential == VolumePotential::NONE) { return {}; }
+    if (!std::isfinite(epsilon) || epsilon <= 0.0L)
+    {
+      throw std::invalid_argument(
+          "Volume-fixing epsilon must be finite and positive.");
+    }
+    if (target <= 0)
+    {
+      throw std::invalid_argument("Volume-fixing target must be positive.");
+    }
+    return {.potential = potential, .epsilon = epsilon, .target = target};
+  }
+
+  /// @param name `linear` or `quadratic`.
+  /// @returns The named potential.
+  /// @throws std::invalid_argument If @p name is neither.
+  [[nodiscard]] inline auto parse_volume_potential(std::string_view const name)
+      -> VolumePotential
+  {
+    if (name == "linear") { return VolumePotential::LINEAR; }
+    if (name == "quadratic") { return VolumePotential::QUADRATIC; }
+    throw std::invalid_argument(
+        "Volume potential must be linear or quadratic.");
+  }
+
+  /// @returns `none`, `linear`, or `quadratic`.
+  [[nodiscard]] constexpr auto volume_potential_name(
+      VolumePotential const potential) noexcept -> std::string_view
+  {
+    switch (potential)
+    {
+      case VolumePotential::LINEAR: return "linear";
+      case VolumePotential::QUADRATIC: return "quadratic";
+      case VolumePotential::NONE: break;
+    }
+    return "none";
+  }
+
   /// @brief Finite physical couplings used to evaluate the Euclidean action.
   /// @details Construct instances with make_physical_parameters() so invalid
   /// or non-finite coupling combinations are rejected at the API boundary.
+  /// The action coefficients of the couplings are evaluated once, at
+  /// construction, so a run pays for the transcendental functions only once.
   class PhysicalParameters
   {
-    long double m_alpha;
-    long double m_k;
-    long double m_lambda;
-
-    explicit constexpr PhysicalParameters(long double const alpha,
-                                          long double const k,
-                                          long double const lambda) noexcept
-        : m_alpha{alpha}, m_k{k}, m_lambda{lambda}
+    long double        m_alpha;
+    long double        m_k;
+    long double        m_lambda;
+    ActionCoefficients m_bulk;
+    ActionCoefficients m_alpha_one;
+    ActionCoefficients m_alpha_minus_one_imaginary;
+    VolumeFixing       m_volume;
+
+    explicit PhysicalParameters(long double const alpha, long double const k,
+                                long double const  lambda,
+                                VolumeFixing const volume)
+        : m_alpha{alpha}
+        , m_k{k}
+        , m_lambda{lambda}
+        , m_bulk{detail::bulk_coefficients(alpha, k, lambda)}
+        , m_alpha_one{detail::alpha_one_coefficients(k, lambda)}
+        , m_alpha_minus_one_imaginary{
+              detail::alpha_minus_one_imaginary_coefficients(k, lambda)}
+        , m_volume{volume}
     {}
 
     friend auto make_physical_parameters(long double alpha, long double k,
-                                         long double lambda)
+                                         long double  lambda,
+                                         VolumeFixing volume)
         -> PhysicalParameters;
 
    public:
     /// @return Wick-rotation parameter, constrained to be greater than 1/2.
-    [[nodiscard]] constexpr auto alpha() const noexcept { return m_alpha; }
+    [[nodiscard]] auto alpha() const noexcept { return m_alpha; }
     /// @return Inverse Newton coupling supplied at construction.
-    [[nodiscard]] constexpr auto k() const noexcept { return m_k; }
+    [[nodiscard]] auto k() const noexcept { return m_k; }
     /// @return Cosmological coupling supplied at construction.
-    [[nodiscard]] constexpr auto lambda() const noexcept { return m_lambda; }
+    [[nodiscard]] auto lambda() const noexcept { return m_lambda; }
+
+    /// @return Coefficients of the generalized action s3_bulk_action().
+    [[nodiscard]] auto bulk_coefficients() const noexcept
+        -> ActionCoefficients const&
+    { return m_bulk; }
+
+    /// @return Coefficients of s3_bulk_action_alpha_one() at k and lambda.
+    [[nodiscard]] auto alpha_one_coefficients() const noexcept
+        -> ActionCoefficients const&
+    { return m_alpha_one; }
+
+    /// @return Coefficients of
+    /// s3_bulk_action_alpha_minus_one_imaginary_coefficient() at k and lambda.
+    [[nodiscard]] auto alpha_minus_one_imaginary_coefficients() const noexcept
+        -> ActionCoefficients const&
+    { return m_alpha_minus_one_imaginary; }
+
+    /// @return Volume-fixing term added to the bulk action.
+    [[nodiscard]] auto volume_fixing() const noexcept -> VolumeFixing const&
+    { return m_volume; }
   };
 
   /// @brief Validate physical couplings for three-dimensional action APIs.
   /// @param alpha Wick-rotation parameter; must be finite and greater than 1/2.
   /// @param k Inverse Newton coupling; must be finite.
   /// @param lambda Cosmological coupling; must be finite.
-  /// @return Validated coupling values.
-  /// @throws std::invalid_argument if any coupling is non-finite.
+  /// @param volume Optional volume-fixing term.
+  /// @return Validated coupling values and their action coefficients.
+  /// @throws std::invalid_argument if any coupling is non-finite or an
+  /// enabled volume-fixing term is out of range.
   /// @throws std::domain_error if `alpha` is not greater than 1/2.
-  [[nodiscard]] inline auto make_physical_parameters(long double const alpha,
-                                                     long double const k,
-                                                     long double const lambda)
-      -> PhysicalParameters
+  [[nodiscard]] inline auto make_physical_parameters(
+      long double const alpha, long double const k, long double const lambda,
+      VolumeFixing const volume = {}) -> PhysicalParameters
   {
     if (!std::isfinite(alpha) || !std::isfinite(k) || !std::isfinite(lambda))
     {
@@ -78,22 +417,11 @@ namespace cdt::s3_action
     {
       throw std::domain_error("Alpha in 3D must be greater than 1/2.");
     }
-    return PhysicalParameters{alpha, k, lambda};
+    return PhysicalParameters{
+        alpha, k, lambda,
+        make_volume_fixing(volume.potential, volume.epsilon, volume.target)};
   }
 
-  namespace detail
-  {
-    [[nodiscard]] inline auto make_finite_couplings(long double const k,
-                                                    long double const lambda)
-        -> std::pair<long double, long double>
-    {
-      if (!std::isfinite(k) || !std::isfinite(lambda))
-      {
-        throw std::invalid_argument("Physical parameters must be finite.");
-      }
-      return {k, lambda};
-    }
-  }  // namespace detail
   /// @brief Calculates the coefficient of \f$i\f$ in the
   /// \f$\alpha=-1\f$ S3 bulk action.
   ///
@@ -121,45 +449,30 @@ namespace cdt::s3_action
       Int_precision const n3_22_count, long double const k_value,
       long double const lambda_value) -> mpfr_values::Value
   {
-    auto const [checked_k, checked_lambda] =
-        detail::make_finite_couplings(k_value, lambda_value);
-
-    // Set input parameters and constants to MPFR equivalents
-    auto const n1_tl     = mpfr_values::from_integer(n1_tl_count);
-    auto const n3_31     = mpfr_values::from_integer(n3_31_13_count);
-    auto const n3_22     = mpfr_values::from_integer(n3_22_count);
-    auto const k         = mpfr_values::from_long_double(checked_k);
-    auto const lambda    = mpfr_values::from_long_double(checked_lambda);
-    auto const two       = mpfr_values::from_integer(2);
-    auto const pi        = mpfr_values::pi();
-    auto const const2673 = mpfr_values::from_decimal("2.673");
-    auto const const118  = mpfr_values::from_decimal("0.118");
-    auto const const7386 = mpfr_values::from_decimal("7.386");
-
-    // First term accumulates in r3
-    auto const r1        = mpfr_values::multiply(two, pi);  // r1 = 2*pi
-    auto const r2        = mpfr_values::multiply(r1, k);    // r2 = 2*pi*k
-    auto const r3 = mpfr_values::multiply(r2, n1_tl);       // r3 = 2*pi*k*n1_tl
-
-    // Second term accumulates in r7
-    auto const r4 = mpfr_values::multiply(const2673, k);  // r4 = 2.673*k
-    auto const r5 =
-        mpfr_values::multiply(const118, lambda);       // r5 = 0.118*lambda
-    auto const r6 = mpfr_values::add(r4, r5);          // r6 = r4 + r5
-    auto const r7 = mpfr_values::multiply(n3_31, r6);  // r7 = n3_31*r6
-
-    // Third term accumulates in r11
-    auto const r8 = mpfr_values::multiply(const7386, k);  // r8 = 7.386*k
-    auto const r9 =
-        mpfr_values::multiply(const118, lambda);           // r9 = 0.118*lambda
-    auto const r10   = mpfr_values::add(r8, r9);           // r10 = r8+r9
-    auto const r11   = mpfr_values::multiply(n3_22, r10);  // r11 = n3_22*r10
-
-    // Result is r3+r7+r11
-    auto const r12   = mpfr_values::subtract(r7, r3);  // r12 = r7-r3
-    auto const total = mpfr_values::add(r11, r12);     // total = r11+r12
-
-    return total;
+    return detail::linear_action(
+        detail::alpha_minus_one_imaginary_coefficients(k_value, lambda_value),
+        n1_tl_count, n3_31_13_count, n3_22_count);
+  }  // s3_bulk_action_alpha_minus_one_imaginary_coefficient()
+
+  /// @brief Calculates the coefficient of \f$i\f$ in the
+  /// \f$\alpha=-1\f$ S3 bulk action from cached coefficients.
+  /// @details Uses the k and lambda of @p parameters; alpha is not used.
+  /// @param n1_tl_count \f$N_1^{TL}\f$ is the number of timelike links
+  /// @param n3_31_13_count \f$N_3^{(3,1)}\f$ is the number of (3,1) and (1,3)
+  /// simplices
+  /// @param n3_22_count \f$N_3^{(2,2)}\f$ is the number of (2,2) simplices
+  /// @param parameters Validated physical parameters for the action
+  /// @returns The real coefficient \f$S^{(3)}(\alpha=-1)/i\f$ as a 256-bit
+  /// MPFR value
+  [[nodiscard]] inline auto
+  s3_bulk_action_alpha_minus_one_imaginary_coefficient(
+      Int_precision const n1_tl_count, Int_precision const n3_31_13_count,
+      Int_precision const n3_22_count, PhysicalParameters const& parameters)
+      -> mpfr_values::Value
+  {
+    return detail::linear_action(
+        parameters.alpha_minus_one_imaginary_coefficients(), n1_tl_count,
+        n3_31_13_count, n3_22_count);
   }  // s3_bulk_action_alpha_minus_one_imaginary_coefficient()
 
   /// @brief Calculates S3 bulk action for \f$\alpha\f$=1.
@@ -182,46 +495,27 @@ namespace cdt::s3_action
       Int_precision const n3_22_count, long double const k_value,
       long double const lambda_value) -> mpfr_values::Value
   {
-    auto const [checked_k, checked_lambda] =
-        detail::make_finite_couplings(k_value, lambda_value);
-
-    // Set input parameters and constants to MPFR equivalents
-    auto const n1_tl     = mpfr_values::from_integer(n1_tl_count);
-    auto const n3_31     = mpfr_values::from_integer(n3_31_13_count);
-    auto const n3_22     = mpfr_values::from_integer(n3_22_count);
-    auto const k         = mpfr_values::from_long_double(checked_k);
-    auto const lambda    = mpfr_values::from_long_double(checked_lambda);
-    auto const two       = mpfr_values::from_integer(2);
-    auto const pi        = mpfr_values::pi();
-    auto const const3548 = mpfr_values::from_decimal("-3.548");
-    auto const const167  = mpfr_values::from_decimal("-0.167");
-    auto const const5355 = mpfr_values::from_decimal("-5.355");
-    auto const const204  = mpfr_values::from_decimal("-0.204");
-
-    // First term accumulates in r3
-    auto const r1        = mpfr_values::multiply(two, pi);  // r1 = 2*pi
-    auto const r2        = mpfr_values::multiply(r1, k);    // r2 = 2*pi*k
-    auto const r3 = mpfr_values::multiply(r2, n1_tl);       // r3 = 2*pi*k*n1_tl
-
-    // Second term accumulates in r7
-    auto const r4 = mpfr_values::multiply(const3548, k);  // r4 = -3.548*k
-    auto const r5 =
-        mpfr_values::multiply(const167, lambda);       // r5 = -0.167*lambda
-    auto const r6 = mpfr_values::add(r4, r5);          // r6 = r4 + r5
-    auto const r7 = mpfr_values::multiply(n3_31, r6);  // r7 = n3_31*r6
-
-    // Third term accumulates in r11
-    auto const r8 = mpfr_values::multiply(const5355, k);  // r8 = -5.355*k
-    auto const r9 =
-        mpfr_values::multiply(const204, lambda);           // r9 = -0.204*lambda
-    auto const r10   = mpfr_values::add(r8, r9);           // r10 = r8+r9
-    auto const r11   = mpfr_values::multiply(n3_22, r10);  // r11 = n3_22*r10
-
-    // Result is r3+r7+r11
-    auto const r12   = mpfr_values::add(r3, r7);    // r12 = r3+r7
-    auto const total = mpfr_values::add(r11, r12);  // total = r11+r12
-
-    return total;
+    return detail::linear_action(
+        detail::alpha_one_coefficients(k_value, lambda_value), n1_tl_count,
+        n3_31_13_count, n3_22_count);
+  }  // s3_bulk_action_alpha_one()
+
+  /// @brief Calculates S3 bulk action for \f$\alpha\f$=1 from cached
+  /// coefficients.
+  /// @details Uses the k and lambda of @p parameters; alpha is not used.
+  /// @param n1_tl_count \f$N_1^{TL}\f$ is the number of timelike links
+  /// @param n3_31_13_count \f$N_3^{(3,1)}\f$ is the number of (3,1) and (1,3)
+  /// simplices
+  /// @param n3_22_count \f$N_3^{(2,2)}\f$ is the number of (2,2) simplices
+  /// @param parameters Validated physical parameters for the action
+  /// @returns \f$S^{(3)}(\alpha=1)\f$ as a 256-bit MPFR value
+  [[nodiscard]] inline auto s3_bulk_action_alpha_one(
+      Int_precision const n1_tl_count, Int_precision const n3_31_13_count,
+      Int_precision const n3_22_count, PhysicalParameters const& parameters)
+      -> mpfr_values::Value
+  {
+    return detail::linear_action(parameters.alpha_one_coefficients(),
+                                 n1_tl_count, n3_31_13_count, n3_22_count);
   }  // s3_bulk_action_alpha_one()
 
   /// @brief Calculates the generalized S3 bulk action in terms of \f$\alpha\f$,
@@ -241,6 +535,8 @@ namespace cdt::s3_action
   /// {4\alpha +1}\right)-4k\sqrt{\alpha}\text{arccos}\left(\frac{-1}{4\alpha+1}
   /// \right)-\frac{\lambda}{12}\sqrt{4\alpha +2}\right]\f}
   ///
+  /// The bracketed coefficients are cached in @p parameters.
+  ///
   /// @param n1_tl_count \f$N_1^{TL}\f$ is the number of timelike links
   /// @param n3_31_13_count \f$N_3^{(3,1)}\f$ is the number of (3,1) and (1,3)
   /// simplices
@@ -256,107 +552,95 @@ namespace cdt::s3_action
                                            PhysicalParameters const& parameters)
       -> mpfr_values::Value
   {
-    // Set input parameters and constants to MPFR equivalents
-    auto const n1_tl  = mpfr_values::from_integer(n1_tl_count);
-    auto const n3_31  = mpfr_values::from_integer(n3_31_13_count);
-    auto const n3_22  = mpfr_values::from_integer(n3_22_count);
-    auto const alpha  = mpfr_values::from_long_double(parameters.alpha());
-    auto const k      = mpfr_values::from_long_double(parameters.k());
-    auto const lambda = mpfr_values::from_long_double(parameters.lambda());
-    auto const two    = mpfr_values::from_integer(2);
-    auto const pi     = mpfr_values::pi();
-    auto const three  = mpfr_values::from_integer(3);
-    auto const four   = mpfr_values::from_integer(4);
-    auto const one    = mpfr_values::from_integer(1);
-    auto const twelve = mpfr_values::from_integer(12);
-
-    // First term accumulates in r5
-    auto const r1     = mpfr_values::multiply(two, pi);   // r1 = 2*pi
-    auto const r2     = mpfr_values::multiply(r1, k);     // r2 = 2*pi*k
-    auto const r3     = mpfr_values::square_root(alpha);  // r3 = sqrt(alpha)
-    auto const r4 =
-        mpfr_values::multiply(r3, r2);  // r4 = r3*r2 = 2*pi*k*sqrt(alpha)
-    auto const r5 = mpfr_values::multiply(r4, n1_tl);  // r5 = r4*n1_tl
-
-    // Second term accumulates in r30
-    auto const r6 = mpfr_values::square_root(three);     // r6 = sqrt(3)
-    auto const r7 = mpfr_values::multiply(four, alpha);  // r7 = 4*alpha
-    auto const r8 = mpfr_values::add(one, r7);  // r8 = r7+1 = 4*alpha+1
-    auto const r9 =
-        mpfr_values::square_root(r8);  // r9 = sqrt(r8) = sqrt(4*alpha+1)
-    auto const r10 = mpfr_values::multiply(r6, r9);  // r10 = r6*r9
-    auto const r11 = mpfr_values::divide(one, r10);  // r11 = 1/r10
-    auto const r12 =
-        mpfr_values::inverse_hyperbolic_sine(r11);   // r12 = arcsinh(r11)
-    auto const r13 = mpfr_values::negate(three);     // r13 = -3
-    auto const r14 = mpfr_values::multiply(r13, k);  // r14 = r13*k = -3*k
-    // r15 = r14*r12 = -3*k*arcsinh(r11)
-    auto const r15 = mpfr_values::multiply(r14, r12);
-
-    auto const r16 = mpfr_values::multiply(two, alpha);  // r16 = 2*alpha
-    auto const r17 = mpfr_values::add(r16, one);         // r17 = 2*alpha+1
-    auto const r18 =
-        mpfr_values::divide(r17, r8);  // r18 = (2*alpha+1)/(4*alpha+1)
-    auto const r19 = mpfr_values::arc_cosine(r18);    // r19 = arccos(r18)
-    auto const r20 = mpfr_values::multiply(r14, r3);  // r20 = -3*k*sqrt(alpha)
-    auto const r21 =
-        mpfr_values::multiply(r20, r19);  // r21 = -3*k*sqrt(alpha)*arccos(r18)
-
-    auto const r22 = mpfr_values::multiply(three, alpha);  // r22 = 3*alpha
-    auto const r23 = mpfr_values::add(r22, one);           // r23 = 3*alpha+1
-    auto const r24 = mpfr_values::square_root(r23);     // r24 = sqrt(3*alpha+1)
-    auto const r25 = mpfr_values::negate(lambda);       // r25 = -lambda
-    auto const r26 = mpfr_values::divide(r25, twelve);  // r26 = -lambda/12
-    auto const r27 =
-        mpfr_values::multiply(r26, r24);  // r27 = (-lambda/12)*sqrt(3*alpha+1)
-
-    // Accumulate partial sums of second term
-    auto const r28 = mpfr_values::add(r15, r21);  // r28 = r15+r21
-    auto const r29 = mpfr_values::add(r28, r27);  // r29 = r28+r27
-
-    // Multiply by overall factor of n3_31
-    auto const r30 = mpfr_values::multiply(n3_31, r29);  // r30 = n3_31*r29
-
-    // Third term accumulates in r51
-    auto const r31 = mpfr_values::multiply(two, k);    // r31 = 2*k
-    auto const r32 = mpfr_values::square_root(two);    // r32 = sqrt(2)
-    auto const r33 = mpfr_values::multiply(two, r32);  // r33 = 2*sqrt(2)
-    auto const r34 = mpfr_values::square_root(r17);    // r34 = sqrt(2*alpha+1)
-    auto const r35 = mpfr_values::multiply(r33, r34);  // r35 = r33*r34
-    auto const r36 =
-        mpfr_values::divide(r35, r8);  // r36 = 2*sqrt(2)*sqrt(2*alpha+1)/
-                                       //       4*alpha+1
-    auto const r37 =
-        mpfr_values::inverse_hyperbolic_sine(r36);     // r37 = arcsinh(r36)
-    auto const r38 = mpfr_values::multiply(r31, r37);  // r38 = 2*k*arcsinh(r36)
-
-    auto const r39 = mpfr_values::negate(one);        // r39 = -1
-    auto const r40 = mpfr_values::divide(r39, r8);    // r40 = -1/(4*alpha+1)
-    auto const r41 = mpfr_values::arc_cosine(r40);    // r41 = arccos(r40)
-    auto const r42 = mpfr_values::negate(four);       // r42 = -4
-    auto const r43 = mpfr_values::multiply(r42, k);   // r43 = -4*k
-    auto const r44 = mpfr_values::multiply(r43, r3);  // r44 = -4*k*sqrt(alpha)
-    auto const r45 =
-        mpfr_values::multiply(r44, r41);  // r45 = -4*k*sqrt(alpha)*arccos(r40)
-
-    auto const r46 = mpfr_values::add(r7, two);      // r46 = 4*alpha+2
-    auto const r47 = mpfr_values::square_root(r46);  // r47 = sqrt(4*alpha+2)
-    auto const r48 =
-        mpfr_values::multiply(r26, r47);  // r48 = (-lambda/12)*sqrt(4*alpha+2)
-
-    // Accumulate partial sums of third term
-    auto const r49   = mpfr_values::add(r38, r45);  // r49 = r38+r45
-    auto const r50   = mpfr_values::add(r49, r48);  // r50 = r49+r48
-
-    // Multiply by overall factor of n3_22
-    auto const r51   = mpfr_values::multiply(n3_22, r50);  // r51 = n3_22*r50
-
-    auto const r52   = mpfr_values::add(r5, r30);   // r52 = r5+r30
-    auto const total = mpfr_values::add(r51, r52);  // total = r51+r52
-
-    return total;
+    return detail::linear_action(parameters.bulk_coefficients(), n1_tl_count,
+                                 n3_31_13_count, n3_22_count);
   }  // s3_bulk_action()
 
+  /// @brief Calculates the volume-fixing potential \f$V(N_3)\f$.
+  /// @param n3_count \f$N_3\f$ is the number of simplices
+  /// @param volume Volume-fixing term
+  /// @returns \f$\epsilon|N_3-\bar{N}_3|\f$, \f$\epsilon(N_3-\bar{N}_3)^2\f$,
+  /// or zero when @p volume is disabled, as a 256-bit MPFR value
+  [[nodiscard]] inline auto volume_potential(Int_precision const n3_count,
+                                             VolumeFixing const& volume)
+      -> mpfr_values::Value
+  {
+    if (!volume.enabled()) { return mpfr_values::zero(); }
+    auto const distance = static_cast<long>(n3_count) - volume.target;
+    auto const epsilon  = mpfr_values::from_long_double(volume.epsilon);
+    if (volume.potential == VolumePotential::LINEAR)
+    {
+      return mpfr_values::multiply(
+          epsilon, mpfr_values::from_integer(std::abs(distance)));
+    }
+    auto const offset = mpfr_values::from_integer(distance);
+    return mpfr_values::multiply(epsilon,
+                                 mpfr_values::multiply(offset, offset));
+  }  // volume_potential()
+
+  /// @brief Evaluate \f$V(N_3)-V(N_3')\f$ in long double.
+  /// @details The integer difference is exact, so the result carries at most
+  /// two roundings: a relative error below two epsilons.
+  /// @param current_n3 \f$N_3\f$ before a move
+  /// @param proposed_n3 \f$N_3'\f$ after a move
+  /// @param volume Volume-fixing term
+  /// @returns The exponent of the volume factor \f$e^{V(N_3)-V(N_3')}\f$
+  [[nodiscard]] inline auto volume_exponent(Int_precision const current_n3,
+                                            Int_precision const proposed_n3,
+                                            VolumeFixing const& volume) noexcept
+      -> long double
+  {
+    if (!volume.enabled()) { return 0.0L; }
+    auto const current  = static_cast<long>(current_n3) - volume.target;
+    auto const proposed = static_cast<long>(proposed_n3) - volume.target;
+    auto const difference =
+        volume.potential == VolumePotential::LINEAR
+            ? static_cast<long double>(std::abs(current) - std::abs(proposed))
+            : static_cast<long double>(current - proposed) *
+                  static_cast<long double>(current + proposed);
+    return volume.epsilon * difference;
+  }  // volume_exponent()
+
+  /// @brief Outward-rounded long-double bounds on a volume factor
+  struct VolumeFactorBounds
+  {
+    long double lower{1.0L};
+    long double upper{1.0L};
+  };
+
+  /// @brief Bound \f$e^{V(N_3)-V(N_3')}\f$ from below and above.
+  /// @details The exponent is exact at the project precision: epsilon has
+  /// 64 significant bits and the integer difference fewer than 128. MPFR
+  /// then rounds the exponential and its narrowing to long double toward
+  /// zero for the lower bound and toward infinity for the upper one.
+  /// @param current_n3 \f$N_3\f$ before a move
+  /// @param proposed_n3 \f$N_3'\f$ after a move
+  /// @param volume Volume-fixing term
+  /// @returns Bounds that bracket the exact factor, or {1, 1} when
+  /// @p volume is disabled
+  [[nodiscard]] inline auto volume_factor_bounds(
+      Int_precision const current_n3, Int_precision const proposed_n3,
+      VolumeFixing const& volume) -> VolumeFactorBounds
+  {
+    if (!volume.enabled()) { return {}; }
+    auto const current  = static_cast<long>(current_n3) - volume.target;
+    auto const proposed = static_cast<long>(proposed_n3) - volume.target;
+    auto const epsilon  = mpfr_values::from_long_double(volume.epsilon);
+    auto const difference =
+        volume.potential == VolumePotential::LINEAR
+            ? mpfr_values::from_integer(std::abs(current) - std::abs(proposed))
+            : mpfr_values::multiply(
+                  mpfr_values::from_integer(current - proposed),
+                  mpfr_values::from_integer(current + proposed));
+    auto const exponent = mpfr_values::multiply(epsilon, difference);
+    auto       lower    = mpfr_values::zero();
+    auto       upper    = mpfr_values::zero();
+    mpfr_exp(lower.fr(), exponent.fr(), MPFR_RNDD);
+    mpfr_exp(upper.fr(), exponent.fr(), MPFR_RNDU);
+    return {.lower = mpfr_get_ld(lower.fr(), MPFR_RNDD),
+            .upper = mpfr_get_ld(upper.fr(), MPFR_RNDU)};
+  }  // volume_factor_bounds()
+
 #pragma GCC diagnostic pop
 
 }  // namespace cdt::s3_action
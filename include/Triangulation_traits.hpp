@@ -20,13 +20,51 @@
 #include <CGAL/Triangulation_data_structure_3.h>
 #include <CGAL/Triangulation_vertex_base_with_info_3.h>
 
+#include <cstdint>
+#include <limits>
 #include <utility>
 #include <vector>
 
 #include "Settings.hpp"
 
+namespace cdt
+{
+  /// Persistent identifier of a vertex or cell within one triangulation.
+  using Simplex_id = std::uint32_t;
+
+  /// Identifier of a vertex or cell not yet registered with a triangulation.
+  inline constexpr Simplex_id UNASSIGNED_SIMPLEX_ID =
+      std::numeric_limits<Simplex_id>::max();
+}  // namespace cdt
+
 namespace cdt::detail
 {
+  /// @brief Adds a persistent 32-bit identifier to a CGAL vertex or cell base.
+  /// @details The identifier is copied with the triangulation and is not read
+  /// by CGAL. A freshly created vertex or cell is unassigned until a foliated
+  /// triangulation registers it.
+  /// @tparam Base CGAL vertex or cell base to extend
+  template <typename Base>
+  class Simplex_base_with_id : public Base
+  {
+    Simplex_id m_id{UNASSIGNED_SIMPLEX_ID};
+
+   public:
+    template <typename TDS2>
+    struct Rebind_TDS
+    {
+      using Base2 = typename Base::template Rebind_TDS<TDS2>::Other;
+      using Other = Simplex_base_with_id<Base2>;
+    };
+
+    Simplex_base_with_id() = default;
+    using Base::Base;
+
+    [[nodiscard]] auto id() const noexcept -> Simplex_id { return m_id; }
+
+    void set_id(Simplex_id const id) noexcept { m_id = id; }
+  };
+
   template <int dimension>
   struct TriangulationTraits;
 
@@ -34,12 +72,14 @@ namespace cdt::detail
   struct TriangulationTraits<3>
   {
     using Kernel = CGAL::Exact_predicates_inexact_constructions_kernel;
-    using Vertex_base =
-        CGAL::Triangulation_vertex_base_with_info_3<Int_precision, Kernel>;
+    /// Timevalue in info() and a vertex id in id()
+    using Vertex_base = Simplex_base_with_id<
+        CGAL::Triangulation_vertex_base_with_info_3<Int_precision, Kernel>>;
     using Delaunay_cell_base = CGAL::Delaunay_triangulation_cell_base_3<Kernel>;
-    using Cell_base =
+    /// Cell type in info() and a cell id in id()
+    using Cell_base = Simplex_base_with_id<
         CGAL::Triangulation_cell_base_with_info_3<Int_precision, Kernel,
-                                                  Delaunay_cell_base>;
+                                                  Delaunay_cell_base>>;
 #if defined(CDT_ENABLE_PARALLEL_TRIANGULATION) && \
     CDT_ENABLE_PARALLEL_TRIANGULATION
 #ifndef CGAL_LINKED_WITH_TBB
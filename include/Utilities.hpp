@@ -100,12 +100,65 @@ namespace cdt::utilities
     FINAL_TRIANGULATION     ///< Final state after the configured move run.
   };
 
+  /// @brief Replica-exchange provenance of one rung of a tempering ladder.
+  struct Tempering_metadata
+  {
+    std::string                coupling;       ///< Tempered coupling name.
+    std::uint64_t              replica{};      ///< Ladder rung of the artifact.
+    std::vector<long double>   ladder;         ///< Coupling value of each rung.
+    std::vector<std::uint64_t> swap_attempts;  ///< Per adjacent rung pair.
+    std::vector<std::uint64_t> swap_accepts;   ///< Per adjacent rung pair.
+  };
+
+  /// @brief Volume-fixing term of the action sampled by a run.
+  struct Volume_fixing_metadata
+  {
+    std::string   potential;  ///< `linear` or `quadratic`.
+    long double   epsilon{};  ///< Strength of the potential.
+    Int_precision target{};   ///< Target number of simplices.
+
+    /// @param other Term to compare.
+    /// @return Whether both terms are the same potential.
+    [[nodiscard]] auto operator==(Volume_fixing_metadata const& other) const
+        -> bool = default;
+  };
+
+  /// @brief Automatic burn-in that preceded the recorded production run.
+  struct Burn_in_metadata
+  {
+    Int_precision passes{};        ///< Burn-in passes executed.
+    Int_precision limit{};         ///< Configured maximum burn-in passes.
+    bool          equilibrated{};  ///< Whether the MSER test passed.
+  };
+
+  /// @brief Early stop of a run before its configured passes.
+  struct Interruption_metadata
+  {
+    std::string   reason;              ///< `deadline` or `signal`.
+    Int_precision pass_attempts{};     ///< Attempts the pass started with.
+    Int_precision pass_transitions{};  ///< Transitions the pass completed.
+  };
+
+  /// @brief Engine positions and counters that let a checkpoint be resumed.
+  /// @details Counters hold one value per move type, in move-index order.
+  struct Resume_metadata
+  {
+    std::string                transition_engine;  ///< Random::state().
+    std::vector<Int_precision> proposed;           ///< Proposed moves.
+    std::vector<Int_precision> accepted;           ///< Accepted moves.
+    std::vector<Int_precision> rejected;           ///< Rejected moves.
+    std::vector<Int_precision> attempted;          ///< Tried constructions.
+    std::vector<Int_precision> succeeded;          ///< Built candidates.
+    std::vector<Int_precision> failed;             ///< Failed candidates.
+  };
+
   /// @brief Provenance recorded next to every stochastic triangulation.
-  /// @details Checkpoints are deliberately snapshots rather than resumable
-  /// simulation states: the payload does not serialize mutable RNG state.
-  /// Payload-derived counts, time bounds, and fingerprints are reconciled
-  /// with the serialized triangulation before publication. Callers remain
-  /// responsible for supplying truthful run configuration and RNG provenance.
+  /// @details A Metropolis checkpoint also records its engine positions and
+  /// counters, which makes it resumable; every other artifact is a snapshot
+  /// and serializes no mutable RNG state. Payload-derived counts, time
+  /// bounds, and fingerprints are reconciled with the serialized
+  /// triangulation before publication. Callers remain responsible for
+  /// supplying truthful run configuration and RNG provenance.
   struct Reproducibility_metadata
   {
     ArtifactKind artifact{
@@ -139,6 +192,14 @@ namespace cdt::utilities
     std::optional<std::uint64_t> transition_count;  ///< Hashed transitions.
     std::optional<std::uint64_t> placement_fingerprint;  ///< Coordinate hash.
     std::optional<std::uint64_t> topology_fingerprint;   ///< Incidence hash.
+    std::optional<std::uint64_t>      chain;      ///< Ensemble chain index.
+    std::optional<Tempering_metadata> tempering;  ///< Replica exchange.
+    std::optional<long double> metropolis_time;  ///< Rejection-free clock.
+    std::optional<Volume_fixing_metadata> volume_fixing;  ///< N3 potential.
+    std::optional<Burn_in_metadata>       burn_in;  ///< Automatic burn-in.
+    std::optional<long double>   max_runtime;  ///< Wall-clock budget, in s.
+    std::optional<Interruption_metadata> interruption;  ///< Early stop.
+    std::optional<Resume_metadata>       resume;  ///< Resumable run state.
   };
 
   /// @param payload Triangulation payload path.
@@ -545,6 +606,19 @@ namespace cdt::utilities
       return fingerprint_records(records);
     }
 
+    /// @returns The trailer record of @p simplex at payload @p index, with
+    /// its persistent id when the simplex carries one.
+    template <typename Handle>
+    [[nodiscard]] auto causal_record(std::uint64_t const index,
+                                     Handle const&       simplex) -> std::string
+    {
+      if constexpr (requires { simplex->id(); })
+      {
+        return fmt::format("{}|{}|{}", index, simplex->info(), simplex->id());
+      }
+      else { return fmt::format("{}|{}", index, simplex->info()); }
+    }
+
     template <typename TriangulationType>
     void write_causal_info(std::ostream&            output,
                            TriangulationType const& triangulation)
@@ -553,15 +627,15 @@ namespace cdt::utilities
       {
         // CGAL writes and recreates vertices and cells in container order.
         // Persist those payload indices because distinct TDS vertices may be
-        // geometrically coincident after topological moves.
+        // geometrically coincident after topological moves. Persistent ids
+        // follow, since they break ranking ties between coincident vertices.
         std::vector<std::string> vertices;
         vertices.reserve(
             static_cast<std::size_t>(triangulation.number_of_vertices()));
         std::uint64_t vertex_index{};
         for (auto const vertex : triangulation.finite_vertex_handles())
         {
-          vertices.emplace_back(
-              fmt::format("{}|{}", vertex_index, vertex->info()));
+          vertices.emplace_back(causal_record(vertex_index, vertex));
           ++vertex_index;
         }
 
@@ -571,7 +645,7 @@ namespace cdt::utilities
         std::uint64_t cell_index{};
         for (auto const cell : triangulation.finite_cell_handles())
         {
-          cells.emplace_back(fmt::format("{}|{}", cell_index, cell->info()));
+          cells.emplace_back(causal_record(cell_index, cell));
           ++cell_index;
         }
 
@@ -595,7 +669,7 @@ namespace cdt::utilities
           "payload.size={}\n"
           "payload.fnv1a64={:016x}\n"
           "artifact={}\n"
-          "resume_supported=false\n"
+          "resume_supported={}\n"
           "fresh_topology_replay_supported=false\n"
           "transition_replay_requires_identical_start=true\n"
           "cdt.version={}\n"
@@ -624,11 +698,11 @@ namespace cdt::utilities
           "initial_radius={}\n"
           "foliation_spacing={}\n",
           payload.size, payload.digest, artifact_name(metadata.artifact),
-          cdt::VERSION, cdt::BUILD_COMPILER_ID, cdt::BUILD_COMPILER_VERSION,
-          cdt::BUILD_CONFIGURATION, cdt::BUILD_SYSTEM_NAME,
-          cdt::BUILD_SYSTEM_PROCESSOR, standard_library_name(),
-          CGAL_VERSION_STR, metadata.seed, metadata.initialization_stream,
-          metadata.transition_stream,
+          metadata.resume.has_value(), cdt::VERSION, cdt::BUILD_COMPILER_ID,
+          cdt::BUILD_COMPILER_VERSION, cdt::BUILD_CONFIGURATION,
+          cdt::BUILD_SYSTEM_NAME, cdt::BUILD_SYSTEM_PROCESSOR,
+          standard_library_name(), CGAL_VERSION_STR, metadata.seed,
+          metadata.initialization_stream, metadata.transition_stream,
           metadata.topology == Topology::SPHERICAL ? "spherical" : "toroidal",
           metadata.dimension, metadata.desired_simplices,
           metadata.desired_timeslices, metadata.actual_vertices,
@@ -665,6 +739,71 @@ namespace cdt::utilities
         text += fmt::format("topology.fnv1a64={:016x}\n",
                             *metadata.topology_fingerprint);
       }
+      if (metadata.chain)
+      {
+        text += fmt::format("ensemble.chain={}\n", *metadata.chain);
+      }
+      auto const join = [](auto const& values) {
+        std::string joined;
+        for (auto const& value : values)
+        {
+          if (!joined.empty()) { joined += ','; }
+          joined += fmt::format("{}", value);
+        }
+        return joined;
+      };
+      if (metadata.tempering)
+      {
+        auto const& tempering = *metadata.tempering;
+        text += fmt::format(
+            "tempering.coupling={}\ntempering.replica={}\n"
+            "tempering.ladder={}\ntempering.swap_attempts={}\n"
+            "tempering.swap_accepts={}\n",
+            tempering.coupling, tempering.replica, join(tempering.ladder),
+            join(tempering.swap_attempts), join(tempering.swap_accepts));
+      }
+      if (metadata.volume_fixing)
+      {
+        text += fmt::format(
+            "volume_fixing.potential={}\nvolume_fixing.epsilon={}\n"
+            "volume_fixing.target={}\n",
+            metadata.volume_fixing->potential, metadata.volume_fixing->epsilon,
+            metadata.volume_fixing->target);
+      }
+      if (metadata.metropolis_time)
+      {
+        text += fmt::format("rejection_free.metropolis_time={}\n",
+                            *metadata.metropolis_time);
+      }
+      if (metadata.burn_in)
+      {
+        text += fmt::format(
+            "burn_in.passes={}\nburn_in.limit={}\nburn_in.equilibrated={}\n",
+            metadata.burn_in->passes, metadata.burn_in->limit,
+            metadata.burn_in->equilibrated);
+      }
+      append_optional("budget.max_runtime_seconds", metadata.max_runtime);
+      if (metadata.interruption)
+      {
+        text += fmt::format(
+            "interruption.reason={}\ninterruption.pass_attempts={}\n"
+            "interruption.pass_transitions={}\n",
+            metadata.interruption->reason,
+            metadata.interruption->pass_attempts,
+            metadata.interruption->pass_transitions);
+      }
+      if (metadata.resume)
+      {
+        auto const& resume = *metadata.resume;
+        text += fmt::format("resume.transition_engine={}\n",
+                            resume.transition_engine);
+        text += fmt::format(
+            "resume.proposed={}\nresume.accepted={}\nresume.rejected={}\n"
+            "resume.attempted={}\nresume.succeeded={}\nresume.failed={}\n",
+            join(resume.proposed), join(resume.accepted),
+            join(resume.rejected), join(resume.attempted),
+            join(resume.succeeded), join(resume.failed));
+      }
       return text;
     }
 
@@ -741,10 +880,19 @@ namespace cdt::utilities
       return value;
     }
 
+    /// @brief Causal metadata of one payload vertex or cell.
+    struct Causal_record
+    {
+      Int_precision                info{};
+      /// Persistent id; absent from trailers written before ids were saved
+      std::optional<std::uint64_t> id;
+    };
+
+    /// @returns The payload index and record of an `index|info[|id]` line.
     [[nodiscard]] inline auto parse_record(std::string const&           line,
                                            std::string_view const       prefix,
                                            std::filesystem::path const& path)
-        -> std::pair<std::string, Int_precision>
+        -> std::pair<std::string, Causal_record>
     {
       if (!line.starts_with(prefix))
       {
@@ -753,7 +901,7 @@ namespace cdt::utilities
             std::make_error_code(std::errc::illegal_byte_sequence));
       }
       auto const record    = std::string_view{line}.substr(prefix.size());
-      auto const separator = record.rfind('|');
+      auto const separator = record.find('|');
       if (separator == std::string_view::npos || separator == 0 ||
           separator + 1 == record.size())
       {
@@ -761,8 +909,16 @@ namespace cdt::utilities
             "Malformed causal triangulation metadata", path,
             std::make_error_code(std::errc::illegal_byte_sequence));
       }
+      auto const fields   = record.substr(separator + 1);
+      auto const id_field = fields.find('|');
+      if (id_field == std::string_view::npos)
+      {
+        return {std::string{record.substr(0, separator)},
+                {.info = parse_info(fields, path)}};
+      }
       return {std::string{record.substr(0, separator)},
-              parse_info(record.substr(separator + 1), path)};
+              {.info = parse_info(fields.substr(0, id_field), path),
+               .id   = parse_unsigned(fields.substr(id_field + 1), 10, path)}};
     }
 
     [[nodiscard]] inline auto parse_count_line(
@@ -782,9 +938,9 @@ namespace cdt::utilities
     [[nodiscard]] inline auto read_indexed_info(
         std::istream& input, std::string_view const prefix,
         std::uint64_t const count, std::filesystem::path const& path)
-        -> std::vector<Int_precision>
+        -> std::vector<Causal_record>
     {
-      std::vector<std::optional<Int_precision>> indexed(
+      std::vector<std::optional<Causal_record>> indexed(
           static_cast<std::size_t>(count));
       std::string line;
       for (std::uint64_t record_index = 0; record_index < count; ++record_index)
@@ -806,7 +962,7 @@ namespace cdt::utilities
         indexed[static_cast<std::size_t>(index)] = value;
       }
 
-      std::vector<Int_precision> values;
+      std::vector<Causal_record> values;
       values.reserve(indexed.size());
       for (auto const& value : indexed)
       {
@@ -821,6 +977,26 @@ namespace cdt::utilities
       return values;
     }
 
+    /// @brief Restore the causal metadata of @p simplex from @p record.
+    template <typename Handle>
+    void apply_causal_record(Handle const& simplex, Causal_record const& record,
+                             std::filesystem::path const& path)
+    {
+      simplex->info() = record.info;
+      if constexpr (requires { simplex->set_id(simplex->id()); })
+      {
+        if (!record.id) { return; }
+        using Id = decltype(simplex->id());
+        if (*record.id > std::numeric_limits<Id>::max())
+        {
+          throw std::filesystem::filesystem_error(
+              "Malformed causal triangulation metadata", path,
+              std::make_error_code(std::errc::illegal_byte_sequence));
+        }
+        simplex->set_id(static_cast<Id>(*record.id));
+      }
+    }
+
     template <typename TriangulationType>
     void read_causal_info(std::istream& input, TriangulationType& triangulation,
                           std::filesystem::path const& path)
@@ -871,13 +1047,13 @@ namespace cdt::utilities
       std::size_t vertex_index{};
       for (auto const vertex : triangulation.finite_vertex_handles())
       {
-        vertex->info() = vertex_info.at(vertex_index);
+        apply_causal_record(vertex, vertex_info.at(vertex_index), path);
         ++vertex_index;
       }
       std::size_t cell_index{};
       for (auto const cell : triangulation.finite_cell_handles())
       {
-        cell->info() = cell_info.at(cell_index);
+        apply_causal_record(cell, cell_info.at(cell_index), path);
         ++cell_index;
       }
     }
@@ -902,8 +1078,10 @@ namespace cdt::utilities
       std::uint64_t                topology_fingerprint;
     };
 
-    [[nodiscard]] inline auto read_persistence_metadata(
-        std::filesystem::path const& path) -> Parsed_persistence_metadata
+    /// @returns Every `key=value` field of the sidecar at @p path.
+    [[nodiscard]] inline auto read_metadata_values(
+        std::filesystem::path const& path)
+        -> std::map<std::string, std::string>
     {
       std::ifstream input(path);
       if (!input.is_open())
@@ -947,7 +1125,70 @@ namespace cdt::utilities
             "Could not read persistence metadata", path,
             std::make_error_code(std::errc::io_error));
       }
+      return values;
+    }
 
+    /// @returns The comma-separated fields of @p text.
+    [[nodiscard]] inline auto split_metadata_list(std::string_view text)
+        -> std::vector<std::string_view>
+    {
+      std::vector<std::string_view> fields;
+      for (auto separator = text.find(','); separator != text.npos;
+           separator      = text.find(','))
+      {
+        fields.push_back(text.substr(0, separator));
+        text.remove_prefix(separator + 1);
+      }
+      fields.push_back(text);
+      return fields;
+    }
+
+    /// @brief Parse and check the resume fields of a checkpoint sidecar.
+    /// @details The engine state must restore on the transition stream, and
+    /// the counters must be nonnegative and all of one length.
+    [[nodiscard]] inline auto parse_resume_metadata(
+        std::map<std::string, std::string> const& values,
+        cdt::RandomSeed const seed, cdt::RandomStream const stream,
+        std::filesystem::path const& path) -> Resume_metadata
+    {
+      auto const malformed = [&path] {
+        return std::filesystem::filesystem_error(
+            "Persistence metadata contains an invalid resume state", path,
+            std::make_error_code(std::errc::illegal_byte_sequence));
+      };
+      auto const engine = values.find("resume.transition_engine");
+      if (engine == values.end() ||
+          !cdt::Random::restore(seed, stream, engine->second))
+      {
+        throw malformed();
+      }
+      auto resume = Resume_metadata{.transition_engine = engine->second};
+      auto const counters = {
+          std::pair{"resume.proposed", &Resume_metadata::proposed},
+          std::pair{"resume.accepted", &Resume_metadata::accepted},
+          std::pair{"resume.rejected", &Resume_metadata::rejected},
+          std::pair{"resume.attempted", &Resume_metadata::attempted},
+          std::pair{"resume.succeeded", &Resume_metadata::succeeded},
+          std::pair{"resume.failed", &Resume_metadata::failed}};
+      for (auto const& [name, member] : counters)
+      {
+        auto const field = values.find(name);
+        if (field == values.end()) { throw malformed(); }
+        auto& counter = resume.*member;
+        for (auto const text : split_metadata_list(field->second))
+        {
+          counter.push_back(parse_metadata_integer(text, path));
+          if (counter.back() < 0) { throw malformed(); }
+        }
+        if (counter.size() != resume.proposed.size()) { throw malformed(); }
+      }
+      return resume;
+    }
+
+    [[nodiscard]] inline auto read_persistence_metadata(
+        std::filesystem::path const& path) -> Parsed_persistence_metadata
+    {
+      auto const values = read_metadata_values(path);
       for (auto const required : {"payload.size",
                                   "payload.fnv1a64",
                                   "artifact",
@@ -989,10 +1230,11 @@ namespace cdt::utilities
               std::make_error_code(std::errc::illegal_byte_sequence));
         }
       }
-      if (values.at("resume_supported") != "false")
+      auto const& resumable = values.at("resume_supported");
+      if (resumable != "false" && resumable != "true")
       {
         throw std::filesystem::filesystem_error(
-            "This build cannot read resumable checkpoints", path,
+            "Unsupported persistence resume contract", path,
             std::make_error_code(std::errc::not_supported));
       }
       if (values.at("fresh_topology_replay_supported") != "false" ||
@@ -1175,16 +1417,38 @@ namespace cdt::utilities
             parse_unsigned(values.at("transition_trace.count"), 10, path));
       }
 
+      auto const seed =
+          cdt::RandomSeed{parse_unsigned(values.at("random.seed"), 10, path)};
+      auto const transition_stream = cdt::RandomStream{
+          parse_unsigned(values.at("random.transition_stream"), 10, path)};
+      if (resumable == "true")
+      {
+        if (artifact != ArtifactKind::CHECKPOINT)
+        {
+          throw std::filesystem::filesystem_error(
+              "Only checkpoint metadata can record a resume state", path,
+              std::make_error_code(std::errc::illegal_byte_sequence));
+        }
+        static_cast<void>(
+            parse_resume_metadata(values, seed, transition_stream, path));
+      }
+      else if (std::ranges::any_of(values, [](auto const& field) {
+                 return field.first.starts_with("resume.");
+               }))
+      {
+        throw std::filesystem::filesystem_error(
+            "Snapshot metadata records a resume state", path,
+            std::make_error_code(std::errc::illegal_byte_sequence));
+      }
+
       return {
           .payload  = {parse_unsigned(values.at("payload.size"), 10, path),
                        parse_unsigned(values.at("payload.fnv1a64"), 16, path)},
-          .artifact = artifact,
-          .seed = cdt::RandomSeed{parse_unsigned(values.at("random.seed"), 10,
-                       path)},
+          .artifact              = artifact,
+          .seed                  = seed,
           .initialization_stream = cdt::RandomStream{parse_unsigned(
               values.at("random.initialization_stream"), 10, path)},
-          .transition_stream     = cdt::RandomStream{parse_unsigned(
-              values.at("random.transition_stream"), 10, path)},
+          .transition_stream     = transition_stream,
           .topology              = topology,
           .dimension             = dimension,
           .actual_vertices       = actual_vertices,
@@ -1902,6 +2166,8 @@ namespace cdt::utilities
   }
 
   /// @brief Write a named stochastic artifact and its complete provenance.
+  /// @details The checkpoint of a stopped run is marked `-stopped`, so it
+  /// never replaces the scheduled checkpoint of the same pass.
   /// @tparam ManifoldType Supported manifold type.
   /// @param universe Manifold to serialize.
   /// @param metadata Complete artifact and stochastic provenance.
@@ -1923,6 +2189,26 @@ namespace cdt::utilities
       }
       filename =
           make_filename(universe, metadata.seed, *metadata.completed_passes);
+      if (metadata.interruption)
+      {
+        filename = filename.parent_path() /
+                   (filename.stem().string() + "-stopped" +
+                    filename.extension().string());
+      }
+    }
+    if (metadata.chain)
+    {
+      filename = filename.parent_path() /
+                 (filename.stem().string() + "-chain-" +
+                  std::to_string(*metadata.chain) +
+                  filename.extension().string());
+    }
+    if (metadata.tempering)
+    {
+      filename = filename.parent_path() /
+                 (filename.stem().string() + "-replica-" +
+                  std::to_string(metadata.tempering->replica) +
+                  filename.extension().string());
     }
     write_file(filename, universe.delaunay_snapshot(), metadata);
   }
@@ -1950,6 +2236,146 @@ namespace cdt::utilities
     return triangulation;
   }  // read_file
 
+  /// @brief Read the provenance of a resumable checkpoint.
+  /// @details The sidecar is validated as by read_file(), and the recorded
+  /// run configuration, state, and resume fields are returned as written, so
+  /// that a Metropolis strategy can continue the run from the payload.
+  /// @param filename Checkpoint payload whose sidecar is read.
+  /// @returns The checkpoint's metadata, with `resume` populated.
+  /// @throws std::filesystem::filesystem_error if the sidecar is missing,
+  /// malformed, inconsistent with the payload, or not resumable.
+  [[nodiscard]] inline auto read_resume_metadata(
+      std::filesystem::path const& filename) -> Reproducibility_metadata
+  {
+    auto const path   = metadata_filename(filename);
+    auto const parsed = detail::validate_payload_integrity(filename);
+    if (!parsed)
+    {
+      throw std::filesystem::filesystem_error(
+          "Checkpoint has no persistence metadata", filename, path,
+          std::make_error_code(std::errc::no_such_file_or_directory));
+    }
+    auto const values = detail::read_metadata_values(path);
+    if (values.at("resume_supported") != "true")
+    {
+      throw std::filesystem::filesystem_error(
+          "Persistence metadata does not describe a resumable checkpoint",
+          path, std::make_error_code(std::errc::not_supported));
+    }
+
+    auto const find = [&values](std::string const& name)
+        -> std::optional<std::string_view> {
+      auto const field = values.find(name);
+      if (field == values.end()) { return std::nullopt; }
+      return field->second;
+    };
+    auto const require = [&find, &path](std::string const& name) {
+      auto const field = find(name);
+      if (!field)
+      {
+        throw std::filesystem::filesystem_error(
+            "Persistence metadata is missing a required field", path,
+            std::make_error_code(std::errc::illegal_byte_sequence));
+      }
+      return *field;
+    };
+    auto const integer = [&find, &path](std::string const& name)
+        -> std::optional<Int_precision> {
+      return find(name).transform([&path](std::string_view const text) {
+        return detail::parse_metadata_integer(text, path);
+      });
+    };
+    auto const floating = [&find, &path](std::string const& name)
+        -> std::optional<long double> {
+      return find(name).transform([&path](std::string_view const text) {
+        return detail::parse_metadata_floating<long double>(text, path);
+      });
+    };
+    auto const unsigned_integer = [&find, &path](std::string const& name,
+                                                 int const          base)
+        -> std::optional<std::uint64_t> {
+      return find(name).transform([&path, base](std::string_view const text) {
+        return detail::parse_unsigned(text, base, path);
+      });
+    };
+
+    auto const initial_radius = detail::parse_metadata_floating<double>(
+        require("initial_radius"), path);
+    auto const foliation_spacing = detail::parse_metadata_floating<double>(
+        require("foliation_spacing"), path);
+
+    Reproducibility_metadata metadata;
+    metadata.artifact              = parsed->artifact;
+    metadata.seed                  = parsed->seed;
+    metadata.initialization_stream = parsed->initialization_stream;
+    metadata.transition_stream     = parsed->transition_stream;
+    metadata.topology              = parsed->topology;
+    metadata.dimension             = parsed->dimension;
+    metadata.desired_simplices     = *integer("desired.simplices");
+    metadata.desired_timeslices    = *integer("desired.timeslices");
+    metadata.actual_vertices       = parsed->actual_vertices;
+    metadata.actual_edges          = parsed->actual_edges;
+    metadata.actual_faces          = parsed->actual_faces;
+    metadata.actual_simplices      = parsed->actual_simplices;
+    metadata.minimum_timeslice     = parsed->minimum_timeslice;
+    metadata.maximum_timeslice     = parsed->maximum_timeslice;
+    metadata.initial_radius        = initial_radius;
+    metadata.foliation_spacing     = foliation_spacing;
+    metadata.alpha                 = floating("alpha");
+    metadata.k                     = floating("k");
+    metadata.lambda                = floating("lambda");
+    metadata.configured_passes     = integer("configured_passes");
+    metadata.configured_attempts   = integer("configured_attempts");
+    metadata.checkpoint_interval   = integer("checkpoint_interval");
+    metadata.completed_passes      = integer("completed_passes");
+    metadata.max_threads           = parsed->max_threads;
+    metadata.transition_trace      = unsigned_integer(
+        "transition_trace.fnv1a64", 16);
+    metadata.transition_count      = unsigned_integer(
+        "transition_trace.count", 10);
+    metadata.placement_fingerprint = parsed->placement_fingerprint;
+    metadata.topology_fingerprint  = parsed->topology_fingerprint;
+    metadata.chain                 = unsigned_integer("ensemble.chain", 10);
+    if (find("volume_fixing.potential"))
+    {
+      metadata.volume_fixing = Volume_fixing_metadata{
+          .potential = std::string{require("volume_fixing.potential")},
+          .epsilon   = detail::parse_metadata_floating<long double>(
+              require("volume_fixing.epsilon"), path),
+          .target    = detail::parse_metadata_integer(
+              require("volume_fixing.target"), path)};
+    }
+    if (find("burn_in.passes"))
+    {
+      auto const equilibrated = require("burn_in.equilibrated");
+      if (equilibrated != "true" && equilibrated != "false")
+      {
+        throw std::filesystem::filesystem_error(
+            "Malformed persistence metadata", path,
+            std::make_error_code(std::errc::illegal_byte_sequence));
+      }
+      metadata.burn_in = Burn_in_metadata{
+          .passes = detail::parse_metadata_integer(require("burn_in.passes"),
+                                                   path),
+          .limit  = detail::parse_metadata_integer(require("burn_in.limit"),
+                                                   path),
+          .equilibrated = equilibrated == "true"};
+    }
+    metadata.max_runtime = floating("budget.max_runtime_seconds");
+    if (find("interruption.reason"))
+    {
+      metadata.interruption = Interruption_metadata{
+          .reason        = std::string{require("interruption.reason")},
+          .pass_attempts = detail::parse_metadata_integer(
+              require("interruption.pass_attempts"), path),
+          .pass_transitions = detail::parse_metadata_integer(
+              require("interruption.pass_transitions"), path)};
+    }
+    metadata.resume = detail::parse_resume_metadata(
+        values, parsed->seed, parsed->transition_stream, path);
+    return metadata;
+  }  // read_resume_metadata
+
   /// @brief Roll a die using a caller-supplied
   /// `std::uniform_random_bit_generator`
   /// @tparam Generator Uniform random bit generator type.
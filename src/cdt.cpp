@@ -19,9 +19,18 @@
 #include <oneapi/tbb/global_control.h>
 #endif
 
+#include <chrono>
+#include <cmath>
+#include <csignal>
 #include <cstdint>
+#include <Ensemble.hpp>
 #include <Metropolis.hpp>
+#include <optional>
+#include <Parallel_tempering.hpp>
+#include <Rejection_free.hpp>
+#include <string>
 #include <utility>
+#include <vector>
 
 #include "Runtime_config.hpp"
 #include "Version.hpp"
@@ -49,22 +58,53 @@ Usage:./cdt (--spherical | --toroidal) -n SIMPLICES -t TIMESLICES
             [--init INITIAL RADIUS]
             [--foliate FOLIATION SPACING]
             [--no-output]
+            [--verify-acceptance | --rejection-free]
             [--seed SEED]
             [--threads THREADS]
+            [--chains CHAINS | --temper COUPLING --ladder VALUES...]
+            [--workers WORKERS]
+            [--volume-fixing POTENTIAL --volume-epsilon EPSILON
+             [--volume-target TARGET]]
             -k K
             --alpha ALPHA
             --lambda LAMBDA
             [-p PASSES]
             [-c CHECKPOINT]
+            [--adaptive-checkpoint MULTIPLE]
+            [--burn-in MAX_PASSES]
+            [--max-runtime SECONDS]
+            [--resume CHECKPOINT]
 
 Optional arguments are in square brackets.
 
 Examples:
 ./cdt --spherical -n 32000 -t 11 --alpha 0.6 -k 1.1 --lambda 0.1 --passes 1000
 ./cdt -s -n32000 -t11 -a.6 -k1.1 -l.1 -p1000 --seed 92
+./cdt -s -n32000 -t11 -a.6 -k1.1 -l.1 -p1000 --chains 64 --workers 64
+./cdt -s -n32000 -t11 -a.6 -k1.1 -l.1 --temper k --ladder 1.0 1.1 1.2
+./cdt -s -n32000 -t11 -a.6 -k1.1 -l.1 -p1000 --rejection-free
+./cdt -s -n8000 -t5 -a.6 -k1.1 -l.1 --volume-fixing linear --volume-epsilon .01
+./cdt -s -n32000 -t11 -a.6 -k1.1 -l.1 -p1000 --adaptive-checkpoint 2
+./cdt -s -n32000 -t11 -a.6 -k1.1 -l.1 -p1000 --burn-in 500
+./cdt -s -n32000 -t11 -a.6 -k1.1 -l.1 -p100000 --max-runtime 86400
+./cdt -s -n32000 -t11 -a.6 -k1.1 -l.1 -p100000 --resume CHECKPOINT.off
 
 Options)"};
 
+extern "C"
+{
+  /// @brief Ask running Metropolis chains to stop after their current
+  /// transition.
+  /// @details The default action is restored, so a second signal ends the
+  /// process at once.
+  /// @param signal_number The signal received
+  static void request_stop(int const signal_number)
+  {
+    detail::stop_signal.store(signal_number, std::memory_order_relaxed);
+    std::signal(signal_number, SIG_DFL);
+  }
+}
+
 /// @brief The main path of the CDT++ program
 /// @param argc Argument count = 1 + number of arguments
 /// @param argv Argument vector passed to Boost.Program_options
@@ -72,20 +112,33 @@ Options)"};
 auto main(int const argc, char* const argv[]) -> int
 try
 {
+  // A scheduler's time limit counts from process start.
+  auto const        started = std::chrono::steady_clock::now();
   std::string const intro{USAGE};
   // Parsed arguments
-  long long               simplices{};
-  long long               timeslices{};
-  long long               dimensions{};
-  double                  initial_radius{};
-  double                  foliation_spacing{};
-  long double             alpha{};
-  long double             k{};
-  long double             lambda{};
-  long long               passes{};
-  long long               checkpoint{};
-  std::uint64_t           seed{};
-  long long               threads{};
+  long long                simplices{};
+  long long                timeslices{};
+  long long                dimensions{};
+  double                   initial_radius{};
+  double                   foliation_spacing{};
+  long double              alpha{};
+  long double              k{};
+  long double              lambda{};
+  long long                passes{};
+  long long                checkpoint{};
+  std::uint64_t            seed{};
+  long long                threads{};
+  long long                chains{};
+  long long                workers{};
+  std::string              tempered;
+  std::vector<long double> ladder;
+  std::string              volume_potential;
+  long double              volume_epsilon{};
+  Int_precision            volume_target{};
+  long double              adaptive_checkpoint{};
+  Int_precision            burn_in{};
+  long double              max_runtime{};
+  std::string              resume_path;
 
   po::options_description description(intro);
   description.add_options()("help,h", "Show this message")(
@@ -102,10 +155,28 @@ try
       "foliate,f", po::value<double>(&foliation_spacing)->default_value(1.0),
       "Foliation spacing")(
       "no-output", "Do not write checkpoint or final triangulation files")(
+      "verify-acceptance",
+      "Evaluate every acceptance with the full MPFR oracle")(
+      "rejection-free",
+      "Sample only accepted Metropolis transitions (n-fold way)")(
       "seed", po::value<std::uint64_t>(&seed),
       "Root random seed (default: operating-system entropy)")(
       "threads", po::value<long long>(&threads)->default_value(1),
       "Maximum worker threads for supported Delaunay operations")(
+      "chains", po::value<long long>(&chains)->default_value(1),
+      "Independent Metropolis chains from one initial triangulation")(
+      "temper", po::value<std::string>(&tempered),
+      "Coupling varied by parallel tempering (k or lambda)")(
+      "ladder", po::value<std::vector<long double>>(&ladder)->multitoken(),
+      "Tempered coupling value of each replica")(
+      "workers", po::value<long long>(&workers)->default_value(1),
+      "Maximum worker threads running chains or replicas")(
+      "volume-fixing", po::value<std::string>(&volume_potential),
+      "Volume-fixing potential added to the action (linear or quadratic)")(
+      "volume-epsilon", po::value<long double>(&volume_epsilon),
+      "Strength of the volume-fixing potential")(
+      "volume-target", po::value<Int_precision>(&volume_target),
+      "Target simplices of the volume-fixing potential (default: -n)")(
       "alpha,a", po::value<long double>(&alpha)->required(),
       "Negative squared geodesic length of 1-d timelike edges")(
       "k,k", po::value<long double>(&k)->required(), "K = 1/(8*pi*G_newton)")(
@@ -114,7 +185,15 @@ try
       "passes,p", po::value<long long>(&passes)->default_value(100),
       "Number of passes")("checkpoint,c",
                           po::value<long long>(&checkpoint)->default_value(10),
-                          "Checkpoint every n passes");
+                          "Checkpoint every n passes")(
+      "adaptive-checkpoint", po::value<long double>(&adaptive_checkpoint),
+      "Checkpoint every MULTIPLE integrated autocorrelation times")(
+      "burn-in", po::value<Int_precision>(&burn_in),
+      "Burn in until equilibrated, for at most MAX_PASSES passes")(
+      "max-runtime", po::value<long double>(&max_runtime),
+      "Stop with a final checkpoint before SECONDS of wall-clock time")(
+      "resume", po::value<std::string>(&resume_path),
+      "Continue the Metropolis run recorded by a checkpoint file");
 
   po::variables_map args;
   po::store(po::parse_command_line(argc, argv, description), args);
@@ -141,8 +220,22 @@ try
     throw invalid_argument("Number of timeslices not specified.");
   }
 
-  auto root_random =
-      args.count("seed") != 0 ? cdt::Random{seed} : cdt::Random{};
+  // A resumed run is the checkpoint's run, so its seed is the default.
+  auto resumed = std::optional<utilities::Reproducibility_metadata>{};
+  if (args.count("resume") != 0)
+  {
+    if (args.count("temper") != 0 || args.count("rejection-free") != 0 ||
+        chains > 1)
+    {
+      throw invalid_argument(
+          "--resume continues one Metropolis chain, not --chains, --temper, "
+          "or --rejection-free.");
+    }
+    resumed = utilities::read_resume_metadata(resume_path);
+  }
+  auto root_random = args.count("seed") != 0 ? cdt::Random{seed}
+                     : resumed                ? cdt::Random{resumed->seed}
+                                              : cdt::Random{};
   auto const triangulation_config = runtime_config::make_triangulation(
       args.count("spherical") != 0, args.count("toroidal") != 0, simplices,
       timeslices, dimensions, initial_radius, foliation_spacing,
@@ -150,6 +243,91 @@ try
   auto const config = runtime_config::make_simulation(
       triangulation_config, alpha, k, lambda, passes, checkpoint,
       !args.count("no-output"));
+  auto const sampling = runtime_config::make_sampling(chains, workers, ladder);
+  if ((args.count("temper") != 0) != sampling.tempering())
+  {
+    throw invalid_argument("--temper and --ladder must be given together.");
+  }
+  auto volume = s3_action::VolumeFixing{};
+  if (args.count("volume-fixing") != 0)
+  {
+    volume = s3_action::make_volume_fixing(
+        s3_action::parse_volume_potential(volume_potential), volume_epsilon,
+        args.count("volume-target") != 0 ? volume_target
+                                         : config.triangulation().simplices());
+  }
+  else if (args.count("volume-epsilon") != 0 ||
+           args.count("volume-target") != 0)
+  {
+    throw invalid_argument(
+        "--volume-epsilon and --volume-target require --volume-fixing.");
+  }
+  auto const rejection_free = args.count("rejection-free") != 0;
+  if (rejection_free &&
+      (sampling.chains() > 1 || sampling.tempering() ||
+       args.count("verify-acceptance") != 0))
+  {
+    throw invalid_argument(
+        "--rejection-free runs one chain without --chains, --temper, or "
+        "--verify-acceptance.");
+  }
+  if (resumed &&
+      (resumed->desired_simplices != config.triangulation().simplices() ||
+       resumed->desired_timeslices != config.triangulation().timeslices()))
+  {
+    throw invalid_argument(
+        "Checkpoint was recorded for different simplices or timeslices.");
+  }
+  auto adaptive = std::optional<long double>{};
+  if (args.count("adaptive-checkpoint") != 0)
+  {
+    if (rejection_free || sampling.tempering())
+    {
+      throw invalid_argument(
+          "--adaptive-checkpoint applies to Metropolis chains, not "
+          "--temper or --rejection-free.");
+    }
+    adaptive = adaptive_checkpoint;
+  }
+  auto burn_in_limit = std::optional<Int_precision>{};
+  if (args.count("burn-in") != 0)
+  {
+    if (rejection_free || sampling.tempering())
+    {
+      throw invalid_argument(
+          "--burn-in applies to Metropolis chains, not --temper or "
+          "--rejection-free.");
+    }
+    burn_in_limit = burn_in;
+  }
+  auto deadline = std::optional<std::chrono::steady_clock::time_point>{};
+  if (args.count("max-runtime") != 0)
+  {
+    if (rejection_free || sampling.tempering())
+    {
+      throw invalid_argument(
+          "--max-runtime applies to Metropolis chains, not --temper or "
+          "--rejection-free.");
+    }
+    auto const budget = std::chrono::duration<long double>{max_runtime};
+    if (!(std::isfinite(max_runtime) && max_runtime > 0.0L) ||
+        budget >= std::chrono::steady_clock::duration::max() / 2)
+    {
+      throw invalid_argument(
+          "--max-runtime must be a positive number of seconds.");
+    }
+    deadline = started +
+               std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                   budget);
+  }
+  if (!rejection_free && !sampling.tempering())
+  {
+    // Metropolis chains stop cleanly on a scheduler's warning signal.
+    std::signal(SIGTERM, request_stop);
+#ifdef SIGUSR1
+    std::signal(SIGUSR1, request_stop);
+#endif
+  }
 #if defined(CDT_ENABLE_PARALLEL_TRIANGULATION) && \
     CDT_ENABLE_PARALLEL_TRIANGULATION
   [[maybe_unused]] oneapi::tbb::global_control thread_limit{
@@ -177,24 +355,45 @@ try
   fmt::print("Effective random seed: {}\n", config.triangulation().seed());
   fmt::print("Maximum Delaunay threads: {}\n",
              config.triangulation().threads());
+  fmt::print("Chains: {}\n", sampling.chains());
+  fmt::print("Maximum chain workers: {}\n", sampling.workers());
   fmt::print("=== Parameters ===\n");
   fmt::print("Alpha: {}\n", config.alpha());
   fmt::print("K: {}\n", config.k());
   fmt::print("Lambda: {}\n", config.lambda());
+  if (volume.enabled())
+  {
+    fmt::print("Volume fixing: {} with epsilon {} around {} simplices\n",
+               s3_action::volume_potential_name(volume.potential),
+               volume.epsilon, volume.target);
+  }
 
   // Start running time
   Timer timer;
   timer.start();
   fmt::print("cdt started at {}\n", utilities::current_date_time());
 
-  // Make a triangulation
+  // Make a triangulation, or restore the checkpoint's
   manifolds::Manifold_3 universe;
 
-  manifolds::Manifold_3 populated_universe(
-      config.triangulation().simplices(), config.triangulation().timeslices(),
-      initialization_random, config.triangulation().initial_radius(),
-      config.triangulation().foliation_spacing());
-  swap(populated_universe, universe);
+  if (resumed)
+  {
+    fmt::print("Resuming from checkpoint {}\n", resume_path);
+    manifolds::Manifold_3 restored_universe(
+        foliated_triangulations::FoliatedTriangulation_3(
+            utilities::read_file<Delaunay_t<3>>(resume_path),
+            resumed->initial_radius, resumed->foliation_spacing));
+    swap(restored_universe, universe);
+  }
+  else
+  {
+    manifolds::Manifold_3 populated_universe(
+        config.triangulation().simplices(),
+        config.triangulation().timeslices(), initialization_random,
+        config.triangulation().initial_radius(),
+        config.triangulation().foliation_spacing());
+    swap(populated_universe, universe);
+  }
 
   auto reproducibility = utilities::make_reproducibility_metadata(
       universe, config.triangulation().seed(),
@@ -207,45 +406,125 @@ try
   reproducibility.configured_passes   = config.passes();
   reproducibility.checkpoint_interval = config.checkpoint();
   reproducibility.max_threads         = config.triangulation().threads();
-
-  // Initialize the Metropolis algorithm with complete run provenance.
-  Metropolis_3 run(config.alpha(), config.k(), config.lambda(), config.passes(),
-                   config.checkpoint(), config.write_files(),
-                   std::move(transition_random), reproducibility);
+  if (deadline) { reproducibility.max_runtime = max_runtime; }
 
   // Look at triangulation
   universe.print();
   universe.print_details();
   universe.print_volume_per_timeslice();
 
-  // The main work of the program
-  auto const result = run(universe);
-
-  // Do we have enough timeslices?
-  if (auto max_timevalue = result.max_time();
-      max_timevalue < config.triangulation().timeslices())
+  // The main work of the program. Each final state is paired with the
+  // provenance of the chain or replica that produced it.
+  auto const verify = args.count("verify-acceptance") != 0;
+  vector<manifolds::Manifold_3>               results;
+  vector<utilities::Reproducibility_metadata> provenance;
+  constexpr auto final_artifact = utilities::ArtifactKind::FINAL_TRIANGULATION;
+  if (sampling.tempering())
+  {
+    ParallelTempering_3 run(config.alpha(), config.k(), config.lambda(),
+                            parse_tempered_coupling(tempered),
+                            sampling.ladder(), config.passes(),
+                            config.checkpoint(), config.write_files(),
+                            root_random, sampling.workers(), reproducibility);
+    run.set_volume_fixing(volume);
+    if (verify)
+    {
+      run.set_acceptance_evaluation(AcceptanceEvaluation::MPFR_ORACLE);
+    }
+    results = run(universe);
+    for (size_t rung = 0; rung < results.size(); ++rung)
+    {
+      provenance.push_back(run.reproducibility_metadata(
+          rung, results[rung], final_artifact, config.passes()));
+    }
+  }
+  else if (sampling.chains() > 1)
+  {
+    Ensemble_3 run(config.alpha(), config.k(), config.lambda(),
+                   config.passes(), config.checkpoint(), config.write_files(),
+                   ensemble_streams(root_random, sampling.chains()),
+                   sampling.workers(), reproducibility);
+    run.set_volume_fixing(volume);
+    run.set_adaptive_checkpoints(adaptive);
+    run.set_burn_in(burn_in_limit);
+    run.set_deadline(deadline);
+    if (verify)
+    {
+      run.set_acceptance_evaluation(AcceptanceEvaluation::MPFR_ORACLE);
+    }
+    results = run(universe);
+    for (size_t chain = 0; chain < results.size(); ++chain)
+    {
+      provenance.push_back(run.chain(chain).reproducibility_metadata(
+          results[chain], final_artifact,
+          run.chain(chain).completed_passes()));
+    }
+  }
+  else if (rejection_free)
   {
-    fmt::print("You wanted {} timeslices, but only got {}.\n",
-               config.triangulation().timeslices(), max_timevalue);
+    RejectionFree_3 run(config.alpha(), config.k(), config.lambda(),
+                        config.passes(), config.checkpoint(),
+                        config.write_files(), std::move(transition_random),
+                        reproducibility);
+    run.set_volume_fixing(volume);
+    results.push_back(run(universe));
+    provenance.push_back(run.reproducibility_metadata(
+        results.front(), final_artifact, config.passes()));
+  }
+  else
+  {
+    // Initialize the Metropolis algorithm with complete run provenance.
+    Metropolis_3 run(config.alpha(), config.k(), config.lambda(),
+                     config.passes(), config.checkpoint(),
+                     config.write_files(), std::move(transition_random),
+                     reproducibility);
+    run.set_volume_fixing(volume);
+    run.set_adaptive_checkpoints(adaptive);
+    run.set_burn_in(burn_in_limit);
+    run.set_deadline(deadline);
+    if (verify)
+    {
+      run.set_acceptance_evaluation(AcceptanceEvaluation::MPFR_ORACLE);
+    }
+    if (resumed) { run.resume_from(*resumed); }
+    results.push_back(run(universe));
+    provenance.push_back(run.reproducibility_metadata(
+        results.front(), final_artifact, run.completed_passes()));
   }
 
-  if (!result.is_valid()) { throw runtime_error("Result is invalid!\n"); }
+  for (auto const& result : results)
+  {
+    // Do we have enough timeslices?
+    if (auto max_timevalue = result.max_time();
+        max_timevalue < config.triangulation().timeslices())
+    {
+      fmt::print("You wanted {} timeslices, but only got {}.\n",
+                 config.triangulation().timeslices(), max_timevalue);
+    }
+
+    if (!result.is_valid()) { throw runtime_error("Result is invalid!\n"); }
+  }
 
   // Print results
   timer.stop();  // End running time counter
   fmt::print("=== Run Results ===\n");
   fmt::print("Running time is {} seconds.\n", timer.time());
-  result.print();
-  result.print_details();
-  result.print_volume_per_timeslice();
-
-  // Write results to file
-  if (config.write_files())
+  for (size_t index = 0; index < results.size(); ++index)
   {
-    utilities::write_file(
-        result, run.reproducibility_metadata(
-                    result, utilities::ArtifactKind::FINAL_TRIANGULATION,
-                    config.passes()));
+    results[index].print();
+    results[index].print_details();
+    results[index].print_volume_per_timeslice();
+    if (auto const& stopped = provenance[index].interruption)
+    {
+      fmt::print("Stopped early by {} after {} completed passes.\n",
+                 stopped->reason, *provenance[index].completed_passes);
+    }
+
+    // Write results to file
+    if (config.write_files())
+    {
+      utilities::write_file(results[index], provenance[index]);
+    }
   }
 
   return EXIT_SUCCESS;
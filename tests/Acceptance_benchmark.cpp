@@ -0,0 +1,193 @@
+/*******************************************************************************
+ Causal Dynamical Triangulations in C++ using CGAL
+
+ Copyright © 2026 Adam Getchell
+ ******************************************************************************/
+
+/// @file Acceptance_benchmark.cpp
+/// @brief Before/after benchmark for per-transition Metropolis acceptance
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <charconv>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <stdexcept>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "Metropolis.hpp"
+
+using namespace cdt;
+
+namespace
+{
+  using Clock = std::chrono::steady_clock;
+
+  struct Transition
+  {
+    Geometry_3             current;
+    Geometry_3             proposed;
+    move_tracker::MoveType move;
+    long double            trial;
+  };
+
+  [[nodiscard]] auto parse_transitions(char const* argument) -> std::size_t
+  {
+    std::size_t transitions{};
+    auto const  text = std::string_view{argument};
+    auto const [end, error] =
+        std::from_chars(text.data(), text.data() + text.size(), transitions);
+    if (error != std::errc{} || end != text.data() + text.size() ||
+        transitions == 0)
+    {
+      throw std::invalid_argument{
+          "transition count must be a positive integer"};
+    }
+    return transitions;
+  }
+
+  /// Delta-consistent transitions near a 16,000-simplex spherical state.
+  [[nodiscard]] auto make_transitions(std::size_t const count)
+      -> std::vector<Transition>
+  {
+    cdt::Random             random{92};
+    std::vector<Transition> transitions;
+    transitions.reserve(count);
+    for (std::size_t index = 0; index < count; ++index)
+    {
+      auto const offset = static_cast<Int_precision>(index % 97);
+      Geometry_3 current;
+      current.N3_31    = 5'000 + offset;
+      current.N3_13    = 5'000 - offset;
+      current.N3_31_13 = current.N3_31 + current.N3_13;
+      current.N3_22    = 6'000 + offset;
+      current.N3       = current.N3_31_13 + current.N3_22;
+      current.N1_TL    = 7'000 + offset;
+      current.N1_SL    = 4'000 - offset;
+      current.N1       = current.N1_TL + current.N1_SL;
+      current.N0       = 2'000 + offset;
+      auto const move  = move_tracker::generate_random_move_3(random);
+      transitions.push_back(
+          {.current  = current,
+           .proposed = *ergodic_moves::detail::moved_geometry(current, move),
+           .move     = move,
+           .trial    = utilities::generate_probability(random)});
+    }
+    return transitions;
+  }
+
+  /// Approximates the removed path: two 1/(5 C) probabilities, their
+  /// quotient, and the exponential of the full action difference on every
+  /// transition. The action ratio comes from today's action_ratio(), which
+  /// reads the cached action coefficients, so this understates the removed
+  /// path's cost by the coefficient evaluation it used to repeat.
+  [[nodiscard]] auto legacy_accepts(Metropolis_3 const& strategy,
+                                    Transition const&   transition) -> bool
+  {
+    auto const forward = Metropolis_3::proposal_probability(transition.current,
+                                                            transition.move);
+    auto const reverse = Metropolis_3::proposal_probability(
+        transition.proposed, *Metropolis_3::reverse_move(transition.move));
+    auto const ratio   = mpfr_values::multiply(
+        mpfr_values::divide(reverse, forward),
+        strategy.action_ratio(transition.current, transition.proposed));
+    auto const one         = mpfr_values::from_integer(1);
+    auto const probability = mpfr_cmp(ratio.fr(), one.fr()) < 0 ? ratio : one;
+    return mpfr_cmp_ld(probability.fr(), transition.trial) >= 0;
+  }
+
+  [[nodiscard]] auto oracle_accepts(Metropolis_3 const& strategy,
+                                    Transition const&   transition) -> bool
+  {
+    return mpfr_cmp_ld(
+               strategy
+                   .acceptance_probability(transition.current,
+                                           transition.proposed, transition.move)
+                   .fr(),
+               transition.trial) >= 0;
+  }
+
+  template <typename Decide>
+  [[nodiscard]] auto measure(std::vector<Transition> const& transitions,
+                             Decide&&                       decide)
+      -> std::pair<std::chrono::nanoseconds, std::vector<bool>>
+  {
+    std::vector<bool> decisions;
+    decisions.reserve(transitions.size());
+    auto const start = Clock::now();
+    for (auto const& transition : transitions)
+    {
+      decisions.push_back(decide(transition));
+    }
+    return {std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() -
+                                                                 start),
+            std::move(decisions)};
+  }
+}  // namespace
+
+auto main(int const argc, char const* const argv[]) -> int
+try
+{
+  auto const count =
+      argc == 2 ? parse_transitions(argv[1]) : std::size_t{100'000};
+  auto const   transitions = make_transitions(count);
+  Metropolis_3 strategy(0.6L, 1.1L, 0.1L, 1, 1, false, cdt::RandomSeed{92});
+
+  auto const [before_time, before] =
+      measure(transitions, [&strategy](Transition const& transition) {
+        return legacy_accepts(strategy, transition);
+      });
+
+  auto const [oracle_time, oracle] =
+      measure(transitions, [&strategy](Transition const& transition) {
+        return oracle_accepts(strategy, transition);
+      });
+
+  std::size_t certified{};
+  auto const [after_time, after] = measure(
+      transitions, [&strategy, &certified](Transition const& transition) {
+        if (auto const decision = strategy.certified_acceptance(
+                transition.current, transition.proposed, transition.move,
+                transition.trial))
+        {
+          ++certified;
+          return *decision;
+        }
+        return oracle_accepts(strategy, transition);
+      });
+
+  if (before != oracle || after != oracle)
+  {
+    throw std::runtime_error{"acceptance decisions differ from the oracle"};
+  }
+  auto const after_ns = after_time.count();
+  if (after_ns == 0)
+  {
+    throw std::runtime_error{
+        "certified duration is below clock resolution; increase transitions"};
+  }
+  auto const per_transition = [count](std::chrono::nanoseconds const time) {
+    return static_cast<double>(time.count()) / static_cast<double>(count);
+  };
+  fmt::print(
+      "transitions={}\nbefore_mpfr_ns_per_transition={}\n"
+      "oracle_integer_ratio_ns_per_transition={}\n"
+      "after_certified_ns_per_transition={}\ncertified_fraction={}\n"
+      "speedup={}\naccepted={}\n",
+      count, per_transition(before_time), per_transition(oracle_time),
+      per_transition(after_time),
+      static_cast<double>(certified) / static_cast<double>(count),
+      static_cast<double>(before_time.count()) / static_cast<double>(after_ns),
+      std::ranges::count(after, true));
+  return 0;
+}
+catch (std::exception const& error)
+{
+  fmt::print(stderr, "acceptance benchmark: {}\n", error.what());
+  return 2;
+}
@@ -0,0 +1,100 @@
+/*******************************************************************************
+ Causal Dynamical Triangulations in C++ using CGAL
+
+ Copyright © 2026 Adam Getchell
+ ******************************************************************************/
+
+/// @file Autocorrelation_test.cpp
+/// @brief Tests for online autocorrelation and effective-sample-size estimates
+
+#include "Autocorrelation.hpp"
+
+#include <doctest/doctest.h>
+
+#include <cmath>
+#include <limits>
+#include <random>
+
+using namespace cdt;
+using namespace std;
+using namespace autocorrelation;
+
+SCENARIO("Batch means estimate the integrated autocorrelation time" *
+         doctest::test_suite("autocorrelation"))
+{
+  GIVEN("An empty estimator.")
+  {
+    BatchMeans series;
+    THEN("No estimate is reported before the first merge.")
+    {
+      for (auto index = 0; index < 63; ++index)
+      {
+        series.add(static_cast<long double>(index % 2));
+      }
+      CHECK_EQ(series.count(), 63);
+      CHECK_EQ(series.batch_size(), 1);
+      CHECK_FALSE(series.tau_int());
+      CHECK_FALSE(series.effective_sample_size());
+      series.add(1.0L);
+      CHECK_EQ(series.batch_size(), 2);
+      CHECK(series.tau_int());
+    }
+  }
+  GIVEN("A constant series.")
+  {
+    BatchMeans series;
+    for (auto index = 0; index < 1000; ++index) { series.add(3.0L); }
+    THEN("It is reported as uncorrelated.")
+    {
+      CHECK_EQ(series.mean(), 3.0L);
+      CHECK_EQ(series.variance(), 0.0L);
+      CHECK_EQ(series.tau_int(), 0.5L);
+      CHECK_EQ(series.effective_sample_size(), 1000.0L);
+    }
+  }
+  GIVEN("Independent and AR(1) Gaussian series.")
+  {
+    std::mt19937_64            engine{92};
+    std::normal_distribution<> normal;
+    constexpr auto             samples = 1 << 18;
+    constexpr auto             rho     = 0.9L;
+    BatchMeans                 independent;
+    BatchMeans                 correlated;
+    auto                       previous = 0.0L;
+    for (auto index = 0; index < samples; ++index)
+    {
+      independent.add(normal(engine));
+      previous = rho * previous + normal(engine);
+      correlated.add(previous);
+    }
+    THEN("Each estimate is within a factor of two of its exact value.")
+    {
+      // With 32 to 64 batches the estimate has a relative spread near 25%.
+      constexpr auto exact = (1.0L + rho) / (2.0L * (1.0L - rho));
+      REQUIRE(independent.tau_int());
+      REQUIRE(correlated.tau_int());
+      CHECK_GE(*independent.tau_int(), 0.5L);
+      CHECK_LT(*independent.tau_int(), 1.0L);
+      CHECK_GT(*correlated.tau_int(), exact / 2.0L);
+      CHECK_LT(*correlated.tau_int(), exact * 2.0L);
+      CHECK(*correlated.effective_sample_size() ==
+            doctest::Approx(samples / (2.0 * *correlated.tau_int())));
+    }
+  }
+}
+
+SCENARIO("Checkpoint intervals follow the autocorrelation time" *
+         doctest::test_suite("autocorrelation"))
+{
+  GIVEN("Estimates in transitions and a pass of 100 transitions.")
+  {
+    THEN("The interval is the ceiling in passes, at least one.")
+    {
+      CHECK_EQ(checkpoint_interval(2.0L, 0.5L, 100), 1);
+      CHECK_EQ(checkpoint_interval(2.0L, 150.0L, 100), 3);
+      CHECK_EQ(checkpoint_interval(1.0L, 200.0L, 100), 2);
+      CHECK_EQ(checkpoint_interval(1.0L, 1.0e30L, 100),
+               std::numeric_limits<Int_precision>::max());
+    }
+  }
+}
@@ -63,6 +63,14 @@ namespace
   static_assert(requires(Traits::Cell_base const& cell) {
     { cell.circumcenter() } -> std::same_as<Point>;
   });
+  static_assert(requires(Traits::Vertex_base& vertex) {
+    { vertex.id() } -> std::same_as<cdt::Simplex_id>;
+    vertex.set_id(cdt::Simplex_id{});
+  });
+  static_assert(requires(Traits::Cell_base& cell) {
+    { cell.id() } -> std::same_as<cdt::Simplex_id>;
+    cell.set_id(cdt::Simplex_id{});
+  });
 
   [[nodiscard]] auto labelled_points() -> cdt::Causal_vertices_t<3>
   {
@@ -0,0 +1,155 @@
+/*******************************************************************************
+ Causal Dynamical Triangulations in C++ using CGAL
+
+ Copyright © 2026 Adam Getchell
+ ******************************************************************************/
+
+/// @file Ensemble_test.cpp
+/// @brief Tests for independent Metropolis chains on a thread pool
+
+#include "Ensemble.hpp"
+
+#include <doctest/doctest.h>
+
+#include <numbers>
+#include <stdexcept>
+#include <vector>
+
+using namespace cdt;
+using namespace std;
+using namespace manifolds;
+
+namespace
+{
+  [[nodiscard]] auto minimal_26_manifold() -> Manifold_3
+  {
+    constexpr auto radius = 2.0 * std::numbers::inv_sqrt3_v<double>;
+    vector         vertices{
+        Point_t<3>{     0,      0,      0},
+        Point_t<3>{     1,      0,      0},
+        Point_t<3>{     0,      1,      0},
+        Point_t<3>{     0,      0,      1},
+        Point_t<3>{radius, radius, radius}
+    };
+    vector<size_t> timevalues{0, 1, 1, 1, 2};
+    return Manifold_3{make_causal_vertices<3>(vertices, timevalues)};
+  }
+}  // namespace
+
+SCENARIO("Ensemble chains draw from distinct deterministic streams" *
+         doctest::test_suite("ensemble"))
+{
+  GIVEN("A root seed.")
+  {
+    cdt::Random const root{cdt::RandomSeed{92}};
+    WHEN("Chain streams are derived from it.")
+    {
+      auto const streams = ensemble_streams(root, 3);
+      THEN("Each chain has the root seed and its own stream.")
+      {
+        REQUIRE_EQ(streams.size(), 3);
+        for (size_t chain = 0; chain < streams.size(); ++chain)
+        {
+          CAPTURE(chain);
+          CHECK_EQ(streams[chain].seed(), cdt::RandomSeed{92});
+          CHECK_EQ(streams[chain].stream(), random_streams::chain(chain));
+          CHECK_NE(streams[chain].stream(), random_streams::transitions);
+        }
+      }
+    }
+    WHEN("Chains are given explicit seeds instead.")
+    {
+      auto const streams =
+          ensemble_seeds({cdt::RandomSeed{3}, cdt::RandomSeed{5}});
+      THEN("Each chain uses its seed on the transition stream.")
+      {
+        REQUIRE_EQ(streams.size(), 2);
+        CHECK_EQ(streams[0].seed(), cdt::RandomSeed{3});
+        CHECK_EQ(streams[1].seed(), cdt::RandomSeed{5});
+        CHECK_EQ(streams[1].stream(), random_streams::transitions);
+      }
+    }
+  }
+}
+
+SCENARIO("Ensemble construction validates chains and workers" *
+         doctest::test_suite("ensemble"))
+{
+  GIVEN("No chain streams.")
+  {
+    THEN("Construction is rejected.")
+    {
+      CHECK_THROWS_AS(Ensemble_3(0.6L, 1.1L, 0.1L, 1, 1, false, {}),
+                      std::invalid_argument);
+    }
+  }
+  GIVEN("Chain streams and no workers.")
+  {
+    THEN("Construction is rejected.")
+    {
+      CHECK_THROWS_AS(
+          Ensemble_3(0.6L, 1.1L, 0.1L, 1, 1, false,
+                     ensemble_streams(cdt::Random{7}, 2), 0),
+          std::invalid_argument);
+    }
+  }
+}
+
+SCENARIO("Ensemble chains are identical for any worker count" *
+         doctest::test_suite("ensemble"))
+{
+  GIVEN("Two four-chain ensembles from one seed with one and three workers.")
+  {
+    auto const        initial = minimal_26_manifold();
+    constexpr auto    chains  = size_t{4};
+    constexpr auto    passes  = Int_precision{2};
+    cdt::Random const root{cdt::RandomSeed{92}};
+    Ensemble_3        serial(0.6L, 0.0L, 0.0L, passes, passes, false,
+                             ensemble_streams(root, chains), 1);
+    Ensemble_3        threaded(0.6L, 0.0L, 0.0L, passes, passes, false,
+                               ensemble_streams(root, chains), 3);
+
+    WHEN("Both ensembles run.")
+    {
+      auto const serial_result   = serial(initial);
+      auto const threaded_result = threaded(initial);
+
+      THEN("Every chain reproduces its state, counters, and trace.")
+      {
+        REQUIRE_EQ(serial_result.size(), chains);
+        REQUIRE_EQ(threaded_result.size(), chains);
+        auto proposed = Int_precision{};
+        for (size_t chain = 0; chain < chains; ++chain)
+        {
+          CAPTURE(chain);
+          auto const& expected = serial.chain(chain);
+          auto const& actual   = threaded.chain(chain);
+          CHECK(threaded_result[chain].is_valid());
+          CHECK_EQ(serial_result[chain].delaunay_snapshot(),
+                   threaded_result[chain].delaunay_snapshot());
+          CHECK_EQ(expected.transition_trace(), actual.transition_trace());
+          CHECK_EQ(expected.accepted().total(), actual.accepted().total());
+          CHECK_EQ(actual.stream(), random_streams::chain(chain));
+          proposed += expected.proposed().total();
+        }
+        CHECK_EQ(serial.proposed().total(), proposed);
+        CHECK_EQ(threaded.proposed().total(), proposed);
+        CHECK_EQ(serial.proposed().total(),
+                 serial.accepted().total() + serial.rejected().total());
+        CHECK_EQ(serial.attempted().total(),
+                 serial.succeeded().total() + serial.failed().total());
+      }
+      AND_THEN("Each chain's provenance names the chain.")
+      {
+        for (size_t chain = 0; chain < chains; ++chain)
+        {
+          auto const metadata = serial.chain(chain).reproducibility_metadata(
+              serial_result[chain], utilities::ArtifactKind::CHECKPOINT,
+              passes);
+          CHECK_EQ(metadata.chain, chain);
+          CHECK_EQ(metadata.transition_stream, random_streams::chain(chain));
+        }
+      }
+    }
+  }
+}
@@ -0,0 +1,109 @@
+/*******************************************************************************
+ Causal Dynamical Triangulations in C++ using CGAL
+
+ Copyright © 2026 Adam Getchell
+ ******************************************************************************/
+
+/// @file Equilibration_test.cpp
+/// @brief Tests for MSER equilibration detection
+
+#include "Equilibration.hpp"
+
+#include <doctest/doctest.h>
+
+#include <random>
+
+using namespace cdt;
+using namespace std;
+using namespace equilibration;
+
+SCENARIO("MSER truncation finds the end of a transient" *
+         doctest::test_suite("equilibration"))
+{
+  GIVEN("Too few observations.")
+  {
+    MserSeries series;
+    for (auto index = 0; index < 9; ++index) { series.add(1.0L); }
+    THEN("No truncation point is reported.")
+    {
+      CHECK_EQ(series.count(), 9);
+      CHECK_FALSE(series.truncation());
+    }
+  }
+  GIVEN("A stationary series.")
+  {
+    MserSeries               series;
+    std::mt19937_64          engine{92};
+    std::normal_distribution normal{100.0L, 1.0L};
+    for (auto index = 0; index < 200; ++index) { series.add(normal(engine)); }
+    THEN("It is equilibrated from near the start.")
+    {
+      REQUIRE(series.truncation());
+      CHECK_LT(*series.truncation(), 50);
+    }
+  }
+  GIVEN("A series decaying to a plateau.")
+  {
+    MserSeries               series;
+    std::mt19937_64          engine{92};
+    std::normal_distribution normal{0.0L, 1.0L};
+    for (auto index = 0; index < 30; ++index)
+    {
+      series.add(100.0L - 3.0L * index + normal(engine));
+    }
+    THEN("Drift alone is not equilibrated.")
+    {
+      CHECK_FALSE(series.truncation());
+    }
+    WHEN("The plateau outlasts the transient.")
+    {
+      for (auto index = 0; index < 130; ++index)
+      {
+        series.add(10.0L + normal(engine));
+      }
+      THEN("The transient is truncated.")
+      {
+        REQUIRE(series.truncation());
+        CHECK_GE(*series.truncation(), 25);
+      }
+    }
+  }
+}
+
+SCENARIO("Equilibration requires every geometry series to settle" *
+         doctest::test_suite("equilibration"))
+{
+  GIVEN("Geometries whose N3 settles while N1_TL keeps growing.")
+  {
+    EquilibrationDetector detector;
+    Geometry_3            geometry;
+    for (auto index = 0; index < 40; ++index)
+    {
+      geometry.N3    = 1000 + index % 2;
+      geometry.N3_22 = 400 + index % 3;
+      geometry.N1_TL = 200 + 5 * index;
+      detector.observe(geometry);
+    }
+    THEN("The run is not yet equilibrated.")
+    {
+      CHECK_EQ(detector.count(), 40);
+      CHECK_FALSE(detector.equilibrated());
+    }
+    WHEN("N1_TL settles as well.")
+    {
+      for (auto index = 0; index < 60; ++index)
+      {
+        geometry.N3    = 1000 + index % 2;
+        geometry.N3_22 = 400 + index % 3;
+        geometry.N1_TL = 400 + index % 2;
+        detector.observe(geometry);
+      }
+      THEN("The run is equilibrated after the N1_TL transient.")
+      {
+        REQUIRE(detector.truncation());
+        CHECK_GE(*detector.truncation(), 35);
+        CHECK(detector.equilibrated());
+      }
+    }
+  }
+}
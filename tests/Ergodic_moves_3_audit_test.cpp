@@ -1216,6 +1216,46 @@ SCENARIO("Applicable moves carry validation evidence without CGAL handles" *
     }
   }
 
+  GIVEN("Prepared (4,4) and (6,2) values consumed on private copies")
+  {
+    auto const diamond = make_44_fixture().delaunay_snapshot();
+    auto const pivot   = find_44_pivot(diamond);
+    REQUIRE(pivot.has_value());
+    auto const four_four =
+        ergodic_moves::detail::prepare_four_four(diamond, *pivot);
+    REQUIRE(four_four.has_value());
+
+    cdt::Random setup_random{1062};
+    auto const  expanded =
+        ergodic_moves::do_26_move(make_26_fixture(), setup_random);
+    REQUIRE(expanded.has_value());
+    auto const star = expanded->delaunay_snapshot();
+    auto vertices   = foliated_triangulations::collect_vertices<3>(star);
+    auto const candidate =
+        std::ranges::find_if(vertices, [&](auto const& vertex) {
+          return ergodic_moves::detail::is_62_movable(star, vertex);
+        });
+    REQUIRE(candidate != vertices.end());
+    auto const six_two =
+        ergodic_moves::detail::prepare_six_two(star, *candidate);
+    REQUIRE(six_two.has_value());
+
+    cdt::Random execution_random{1063};
+    auto const  flipped = ergodic_moves::detail::execute(
+        diamond, *four_four, ergodic_moves::detail::accept_post_mutation);
+    auto const removed = ergodic_moves::detail::execute(
+        star, *six_two, execution_random,
+        ergodic_moves::detail::accept_post_mutation);
+
+    THEN("classifying only the new cells leaves every cell classified")
+    {
+      REQUIRE(flipped.has_value());
+      REQUIRE(removed.has_value());
+      CHECK(ergodic_moves::detail::is_fully_classified(*flipped));
+      CHECK(ergodic_moves::detail::is_fully_classified(*removed));
+    }
+  }
+
   GIVEN("A causal manifold with no raw (2,3) proposal site")
   {
     cdt::Random random{101};
@@ -14,6 +14,7 @@
 #include <doctest/doctest.h>
 
 #include <numbers>
+#include <span>
 
 using namespace cdt;
 using namespace std;
@@ -73,6 +74,20 @@ namespace
     CHECK_EQ(after.max_time(), before.max_time());
     CHECK_EQ(after.min_time(), before.min_time());
   }
+
+  /// @returns Each finite vertex's id and point, in id order.
+  [[nodiscard]] auto vertex_ids(
+      foliated_triangulations::FoliatedTriangulation_3 const& foliation)
+      -> vector<pair<Simplex_id, Point_t<3>>>
+  {
+    vector<pair<Simplex_id, Point_t<3>>> ids;
+    for (auto const& vertex : foliation.vertex_domain())
+    {
+      ids.emplace_back(vertex->id(), vertex->point());
+    }
+    ranges::sort(ids, {}, &pair<Simplex_id, Point_t<3>>::first);
+    return ids;
+  }
 }  // namespace
 
 SCENARIO("Canonical proposal selection preserves sorted-rank semantics" *
@@ -102,6 +117,57 @@ SCENARIO("Canonical proposal selection preserves sorted-rank semantics" *
   }
 }
 
+SCENARIO("Rank keys reproduce the canonical point order" *
+         doctest::test_suite("ergodic"))
+{
+  GIVEN("The cells and edges of a small random manifold")
+  {
+    constexpr auto   simplices  = 640;
+    constexpr auto   timeslices = 4;
+    Manifold_3 const manifold(simplices, timeslices, cdt::Random{92});
+    auto const       triangulation = manifold.delaunay_snapshot();
+    auto cells = foliated_triangulations::collect_cells<3>(triangulation);
+    auto edges = foliated_triangulations::collect_edges<3>(triangulation);
+    auto expected_cells = cells;
+    auto expected_edges = edges;
+    ranges::sort(expected_cells, ergodic_moves::detail::cell_precedes);
+    ranges::sort(expected_edges, ergodic_moves::detail::edge_precedes);
+
+    WHEN("They are canonicalized by radix sort.")
+    {
+      ergodic_moves::detail::canonicalize(cells);
+      ergodic_moves::detail::canonicalize(edges);
+      THEN("The order is that of the point comparisons.")
+      {
+        CHECK(cells == expected_cells);
+        CHECK(edges == expected_edges);
+      }
+    }
+    WHEN("A rank is selected by comparing keys.")
+    {
+      THEN("It names the element of that rank in the sorted domain.")
+      {
+        for (std::uint64_t seed = 0; seed < 8; ++seed)  // NOLINT
+        {
+          CAPTURE(seed);
+          cdt::Random cell_random{seed};
+          cdt::Random edge_random{seed};
+          cdt::Random cell_rank_random{seed};
+          cdt::Random edge_rank_random{seed};
+          uniform_int_distribution<size_t> cell_rank{0, cells.size() - 1};
+          uniform_int_distribution<size_t> edge_rank{0, edges.size() - 1};
+          CHECK(ergodic_moves::detail::canonical_random_element(
+                    cells, cell_random) ==
+                expected_cells[cell_rank(cell_rank_random)]);
+          CHECK(ergodic_moves::detail::canonical_random_element(
+                    edges, edge_random) ==
+                expected_edges[edge_rank(edge_rank_random)]);
+        }
+      }
+    }
+  }
+}
+
 SCENARIO("Use check_move to validate successful move" *
          doctest::test_suite("ergodic"))
 {
@@ -639,6 +705,614 @@ SCENARIO("Rejected topology moves preserve the source value" *
   }
 }
 
+SCENARIO("In-place moves commit or roll back through a transaction" *
+         doctest::test_suite("ergodic"))
+{
+  GIVEN("A triangulation setup for a (2,3) move")
+  {
+    vector vertices{
+        Point_t<3>{       1,        0,        0},
+        Point_t<3>{       0,        1,        0},
+        Point_t<3>{       0,        0,        1},
+        Point_t<3>{RADIUS_2, RADIUS_2, RADIUS_2},
+        Point_t<3>{  SQRT_2,   SQRT_2,        0}
+    };
+    vector<size_t> timevalues{1, 1, 1, 2, 2};
+    auto       causal_vertices = make_causal_vertices<3>(vertices, timevalues);
+    Manifold_3 manifold(causal_vertices);
+    auto const before      = manifold;
+    auto const fingerprint =
+        utilities::canonical_topology_fingerprint(manifold);
+
+    WHEN("A staged (2,3) move is rolled back.")
+    {
+      cdt::Random random{92};
+      CAPTURE(random.seed());
+      {
+        auto transaction = manifold.begin_transaction();
+        REQUIRE(ergodic_moves::propose_23_move(transaction, random));
+        transaction.stage();
+        REQUIRE(ergodic_moves::detail::check_move(
+            transaction, move_tracker::MoveType::TWO_THREE));
+        check_geometry_delta(before, manifold,
+                             move_tracker::MoveType::TWO_THREE);
+        transaction.rollback();
+      }
+      THEN("The source topology and geometry are restored.")
+      {
+        REQUIRE(manifold.is_correct_with_diagnostics());
+        CHECK_EQ(utilities::canonical_topology_fingerprint(manifold),
+                 fingerprint);
+        check_geometry_delta(before, manifold,
+                             move_tracker::MoveType::FOUR_FOUR);
+      }
+    }
+    WHEN("A transaction journals a (2,3) move and stages it.")
+    {
+      cdt::Random random{92};
+      CAPTURE(random.seed());
+      auto        transaction = manifold.begin_transaction();
+      auto const* fresh       = transaction.journal().current_vertex_ids();
+      REQUIRE(ergodic_moves::propose_23_move(transaction, random));
+      auto const* unstaged  = transaction.journal().current_vertex_ids();
+      auto const  footprint = transaction.journal().footprint();
+      transaction.stage();
+      auto const* staged = transaction.journal().current_vertex_ids();
+      THEN("Locators resolve by id only while the id table is current.")
+      {
+        CHECK_NE(fresh, nullptr);
+        CHECK_EQ(unstaged, nullptr);
+        CHECK_EQ(staged, fresh);
+      }
+      THEN("The footprint's live cells are the three around the new edge.")
+      {
+        auto const live = footprint.live_cells();
+        CHECK_EQ(live.size(), 3);
+        CHECK(std::ranges::all_of(live, [&transaction](auto const& cell) {
+          return transaction.triangulation().tds().is_cell(cell);
+        }));
+      }
+    }
+    WHEN("An open transaction is abandoned.")
+    {
+      cdt::Random random{92};
+      CAPTURE(random.seed());
+      {
+        auto transaction = manifold.begin_transaction();
+        REQUIRE(ergodic_moves::propose_23_move(transaction, random));
+      }
+      THEN("Its destructor rolls the move back.")
+      {
+        REQUIRE(manifold.is_correct_with_diagnostics());
+        CHECK_EQ(utilities::canonical_topology_fingerprint(manifold),
+                 fingerprint);
+      }
+    }
+    WHEN("A staged (2,3) move is validated locally.")
+    {
+      cdt::Random random{92};
+      CAPTURE(random.seed());
+      auto transaction = manifold.begin_transaction();
+      REQUIRE(ergodic_moves::propose_23_move(transaction, random));
+      auto const footprint = transaction.journal().footprint();
+      transaction.stage();
+      auto const touched = std::ranges::find_if(
+          footprint.cells, [&transaction](auto const& cell) {
+            return transaction.triangulation().tds().is_cell(cell.cell) &&
+                   !transaction.triangulation().is_infinite(cell.cell);
+          });
+      REQUIRE_NE(touched, footprint.cells.end());
+      auto const cell_type = touched->cell->info();
+      THEN("Local and global validation agree on a correct move.")
+      {
+        CHECK(transaction.is_locally_correct());
+        CHECK(ergodic_moves::detail::check_move(
+            transaction, move_tracker::MoveType::TWO_THREE,
+            ergodic_moves::detail::Validation::LOCAL));
+        CHECK(ergodic_moves::detail::check_move(
+            transaction, move_tracker::MoveType::TWO_THREE,
+            ergodic_moves::detail::Validation::GLOBAL));
+      }
+      THEN("A misclassified touched cell fails local validation.")
+      {
+        touched->cell->info() = static_cast<int>(CellType::ACAUSAL);
+        CHECK_FALSE(transaction.is_locally_correct());
+        CHECK_FALSE(ergodic_moves::detail::check_move(
+            transaction, move_tracker::MoveType::TWO_THREE,
+            ergodic_moves::detail::Validation::LOCAL));
+        touched->cell->info() = cell_type;
+        CHECK(transaction.is_locally_correct());
+      }
+    }
+    WHEN("A (2,3) move is committed.")
+    {
+      cdt::Random value_random{92};
+      cdt::Random in_place_random{92};
+      CAPTURE(value_random.seed());
+      auto const expected =
+          ergodic_moves::propose_23_move(manifold, value_random);
+      REQUIRE(expected.has_value());
+      {
+        auto transaction = manifold.begin_transaction();
+        REQUIRE(ergodic_moves::propose_23_move(transaction, in_place_random));
+        transaction.commit();
+      }
+      THEN("It matches the value-returning proposal.")
+      {
+        REQUIRE(manifold.is_correct_with_diagnostics());
+        CHECK_EQ(utilities::canonical_topology_fingerprint(manifold),
+                 utilities::canonical_topology_fingerprint(*expected));
+        check_geometry_delta(before, manifold,
+                             move_tracker::MoveType::TWO_THREE);
+      }
+    }
+  }
+  GIVEN("A triangulation setup for a (2,6) move")
+  {
+    vector vertices{
+        Point_t<3>{       0,        0,        0},
+        Point_t<3>{       1,        0,        0},
+        Point_t<3>{       0,        1,        0},
+        Point_t<3>{       0,        0,        1},
+        Point_t<3>{RADIUS_2, RADIUS_2, RADIUS_2}
+    };
+    vector<size_t> timevalues{0, 1, 1, 1, 2};
+    auto       causal_vertices = make_causal_vertices<3>(vertices, timevalues);
+    Manifold_3 manifold(causal_vertices);
+    auto const fingerprint =
+        utilities::canonical_topology_fingerprint(manifold);
+
+    WHEN("A vertex insertion is rolled back.")
+    {
+      cdt::Random random{92};
+      CAPTURE(random.seed());
+      {
+        auto transaction = manifold.begin_transaction();
+        REQUIRE(ergodic_moves::propose_26_move(transaction, random));
+        transaction.stage();
+        REQUIRE(ergodic_moves::detail::check_move(
+            transaction, move_tracker::MoveType::TWO_SIX));
+        transaction.rollback();
+      }
+      THEN("The inserted vertex is removed.")
+      {
+        REQUIRE(manifold.is_correct_with_diagnostics());
+        CHECK_EQ(manifold.N0(), 5);
+        CHECK_EQ(utilities::canonical_topology_fingerprint(manifold),
+                 fingerprint);
+      }
+    }
+    WHEN("A vertex removal is rolled back.")
+    {
+      cdt::Random random{92};
+      CAPTURE(random.seed());
+      {
+        auto transaction = manifold.begin_transaction();
+        REQUIRE(ergodic_moves::propose_26_move(transaction, random));
+        transaction.commit();
+      }
+      auto const expanded = manifold;
+      auto const expanded_fingerprint =
+          utilities::canonical_topology_fingerprint(manifold);
+      auto removed = false;
+      for (std::uint64_t seed = 0; seed < 64 && !removed; ++seed)  // NOLINT
+      {
+        cdt::Random selector{seed};
+        auto        transaction = manifold.begin_transaction();
+        removed = ergodic_moves::propose_62_move(transaction, selector)
+                      .has_value();
+        if (removed)
+        {
+          transaction.stage();
+          REQUIRE(ergodic_moves::detail::check_move(
+              transaction, move_tracker::MoveType::SIX_TWO));
+        }
+      }
+      THEN("The removed vertex and its star are restored.")
+      {
+        REQUIRE(removed);
+        REQUIRE(manifold.is_correct_with_diagnostics());
+        CHECK_EQ(utilities::canonical_topology_fingerprint(manifold),
+                 expanded_fingerprint);
+        check_geometry_delta(expanded, manifold,
+                             move_tracker::MoveType::FOUR_FOUR);
+      }
+    }
+    WHEN("Vertex ids are tracked through an inserted vertex.")
+    {
+      cdt::Random random{92};
+      CAPTURE(random.seed());
+      auto        transaction = manifold.begin_transaction();
+      auto const& foliation   = transaction.foliation();
+      auto const  before      = vertex_ids(foliation);
+      REQUIRE(ergodic_moves::propose_26_move(transaction, random));
+      transaction.stage();
+      auto const inserted = vertex_ids(foliation);
+      transaction.rollback();
+      THEN("Ids are dense, resolve in place, and are restored by rollback.")
+      {
+        REQUIRE_EQ(before.size(), 5);
+        for (auto id = Simplex_id{}; id < before.size(); ++id)
+        {
+          CHECK_EQ(before[id].first, id);
+        }
+        REQUIRE_EQ(inserted.size(), 6);
+        CHECK(ranges::equal(before, span{inserted}.first(before.size())));
+        CHECK_EQ(inserted.back().first, 5);
+        CHECK(vertex_ids(foliation) == before);
+        for (auto const& [id, point] : before)
+        {
+          auto const vertex = foliation.vertex_with_id(id);
+          REQUIRE(vertex.has_value());
+          CHECK_EQ((*vertex)->point(), point);
+        }
+        CHECK_FALSE(foliation.vertex_with_id(5).has_value());
+      }
+      THEN("A copy keeps every vertex id.")
+      {
+        Manifold_3 copy{manifold};
+        auto const copied = copy.begin_transaction();
+        CHECK(vertex_ids(copied.foliation()) == before);
+      }
+    }
+  }
+}
+
+SCENARIO("Transactions patch derived caches without a rebuild" *
+         doctest::test_suite("ergodic"))
+{
+  GIVEN("A small random manifold")
+  {
+    constexpr auto simplices  = 640;
+    constexpr auto timeslices = 4;
+    Manifold_3     manifold(simplices, timeslices, cdt::Random{92});
+    REQUIRE(manifold.is_correct_with_diagnostics());
+
+    WHEN("Every move type is alternately committed and rolled back.")
+    {
+      using enum move_tracker::MoveType;
+      cdt::Random random{92};
+      CAPTURE(random.seed());
+      auto applied = 0;
+      for (auto round = 0; round < 8; ++round)  // NOLINT
+      {
+        for (auto const move :
+             {TWO_THREE, THREE_TWO, TWO_SIX, SIX_TWO, FOUR_FOUR})
+        {
+          auto       transaction = manifold.begin_transaction();
+          auto const result      = [&] {
+            switch (move)
+            {
+              case TWO_THREE:
+                return ergodic_moves::propose_23_move(transaction, random);
+              case THREE_TWO:
+                return ergodic_moves::propose_32_move(transaction, random);
+              case TWO_SIX:
+                return ergodic_moves::propose_26_move(transaction, random);
+              case SIX_TWO:
+                return ergodic_moves::propose_62_move(transaction, random);
+              case FOUR_FOUR:
+                return ergodic_moves::propose_44_move(transaction, random);
+            }
+            return ergodic_moves::MoveApplication{};
+          }();
+          if (!result) { continue; }
+          ++applied;
+          transaction.stage();
+          REQUIRE(ergodic_moves::detail::check_move(transaction, move));
+          if (round % 2 == 0) { transaction.commit(); }
+          else { transaction.rollback(); }
+        }
+      }
+      THEN("The patched caches agree with a full rebuild.")
+      {
+        REQUIRE_GT(applied, 0);
+        REQUIRE(manifold.is_correct_with_diagnostics());
+        using foliated_triangulations::FoliatedTriangulation_3;
+        Manifold_3 const rebuilt{
+            FoliatedTriangulation_3{manifold.delaunay_snapshot()}};
+        CHECK_EQ(manifold.N3(), rebuilt.N3());
+        CHECK_EQ(manifold.N3_31(), rebuilt.N3_31());
+        CHECK_EQ(manifold.N3_22(), rebuilt.N3_22());
+        CHECK_EQ(manifold.N3_13(), rebuilt.N3_13());
+        CHECK_EQ(manifold.N2(), rebuilt.N2());
+        CHECK_EQ(manifold.N1_TL(), rebuilt.N1_TL());
+        CHECK_EQ(manifold.N1_SL(), rebuilt.N1_SL());
+        CHECK_EQ(manifold.N0(), rebuilt.N0());
+        CHECK_EQ(manifold.min_time(), rebuilt.min_time());
+        CHECK_EQ(manifold.max_time(), rebuilt.max_time());
+        for (auto time = manifold.min_time(); time <= manifold.max_time();
+             ++time)
+        {
+          CHECK_EQ(manifold.spacelike_face_count(time),
+                   rebuilt.spacelike_face_count(time));
+        }
+      }
+    }
+  }
+}
+
+SCENARIO("Cached stars decide move admissibility" *
+         doctest::test_suite("ergodic"))
+{
+  GIVEN("A small random manifold")
+  {
+    constexpr auto simplices  = 640;
+    constexpr auto timeslices = 4;
+    Manifold_3     manifold(simplices, timeslices, cdt::Random{92});
+    REQUIRE(manifold.is_correct_with_diagnostics());
+
+    WHEN("Every raw site is screened by its cached star.")
+    {
+      auto            transaction   = manifold.begin_transaction();
+      auto const&     foliation     = transaction.foliation();
+      Delaunay const& triangulation = transaction.triangulation();
+      using ergodic_moves::detail::resolve_edge;
+      THEN("A star rejects only sites that preparation rejects.")
+      {
+        for (auto const& vertex : foliation.vertex_domain())
+        {
+          auto const star = foliation.vertex_star(vertex);
+          REQUIRE(star);
+          CHECK_EQ(*star, foliated_triangulations::make_vertex_star(
+                              triangulation, vertex));
+          CHECK_EQ(ergodic_moves::detail::is_62_star(*star),
+                   ergodic_moves::detail::prepare_six_two(triangulation,
+                                                          vertex)
+                       .has_value());
+        }
+        for (auto const& key : foliation.timelike_edge_domain())
+        {
+          auto const star = foliation.edge_star(key);
+          auto const edge = resolve_edge(triangulation, key);
+          REQUIRE(star);
+          REQUIRE(edge);
+          CHECK_EQ(ergodic_moves::detail::is_32_star(*star),
+                   ergodic_moves::detail::prepare_three_two(triangulation,
+                                                            *edge)
+                       .has_value());
+        }
+        for (auto const& key : foliation.spacelike_edge_domain())
+        {
+          auto const star = foliation.edge_star(key);
+          auto const edge = resolve_edge(triangulation, key);
+          REQUIRE(star);
+          REQUIRE(edge);
+          // Preparation additionally locates the diamond's apexes.
+          if (ergodic_moves::detail::prepare_four_four(triangulation, *edge))
+          {
+            CHECK(ergodic_moves::detail::is_44_star(*star));
+          }
+        }
+      }
+    }
+  }
+}
+
+SCENARIO("Prepared moves predict their geometry before they are built" *
+         doctest::test_suite("ergodic"))
+{
+  GIVEN("A small random manifold")
+  {
+    constexpr auto simplices  = 640;
+    constexpr auto timeslices = 4;
+    Manifold_3     manifold(simplices, timeslices, cdt::Random{92});
+    REQUIRE(manifold.is_correct_with_diagnostics());
+
+    WHEN("Prepared moves are dry run, then applied or skipped.")
+    {
+      using enum move_tracker::MoveType;
+      auto          predictions = 0;
+      std::uint64_t seed{0};
+      for (auto round = 0; round < 8; ++round)  // NOLINT
+      {
+        for (auto const move :
+             {TWO_THREE, THREE_TWO, TWO_SIX, SIX_TWO, FOUR_FOUR})
+        {
+          auto const  step_seed = seed++;
+          cdt::Random apply_random{step_seed};
+          cdt::Random skip_random{step_seed};
+          CAPTURE(step_seed);
+          CAPTURE(static_cast<int>(move));
+          auto       transaction = manifold.begin_transaction();
+          auto const prepared =
+              ergodic_moves::prepare_move(transaction, move, apply_random);
+          auto const skipped =
+              ergodic_moves::prepare_move(transaction, move, skip_random);
+          REQUIRE_EQ(prepared.has_value(), skipped.has_value());
+          if (!prepared) { continue; }
+          REQUIRE_EQ(prepared->move(), move);
+          auto const predicted = prepared->dry_run(transaction.triangulation(),
+                                                   transaction.journal(),
+                                                   manifold.geometry());
+          if (move != TWO_SIX && move != SIX_TWO)
+          {
+            CHECK_FALSE(predicted);
+            continue;
+          }
+          if (!predicted) { continue; }
+          skipped->skip(transaction.triangulation(), transaction.journal(),
+                        skip_random);
+          REQUIRE(prepared->apply(transaction, apply_random));
+          transaction.stage();
+          ++predictions;
+          auto const& actual = manifold.geometry();
+          CHECK_EQ(predicted->N3, actual.N3);
+          CHECK_EQ(predicted->N3_31_13, actual.N3_31_13);
+          CHECK_EQ(predicted->N3_22, actual.N3_22);
+          CHECK_EQ(predicted->N1_TL, actual.N1_TL);
+          CHECK_EQ(predicted->N1_SL, actual.N1_SL);
+          CHECK_EQ(predicted->N0, actual.N0);
+          // Skipping consumed exactly the draws applying did.
+          CHECK_EQ(apply_random(), skip_random());
+          transaction.rollback();
+        }
+      }
+      THEN("Every predicted move succeeded with the predicted geometry.")
+      {
+        REQUIRE_GT(predictions, 0);
+        REQUIRE(manifold.is_correct_with_diagnostics());
+      }
+    }
+  }
+}
+
+SCENARIO("Ranked proposal domains select the canonical site" *
+         doctest::test_suite("ergodic"))
+{
+  GIVEN("A small random manifold")
+  {
+    constexpr auto simplices  = 640;
+    constexpr auto timeslices = 4;
+    Manifold_3     manifold(simplices, timeslices, cdt::Random{92});
+    REQUIRE(manifold.is_correct_with_diagnostics());
+
+    WHEN("Value and in-place proposals share each generator seed.")
+    {
+      using enum move_tracker::MoveType;
+      auto          compared = 0;
+      std::uint64_t seed{0};
+      for (auto round = 0; round < 4; ++round)  // NOLINT
+      {
+        for (auto const move :
+             {TWO_THREE, THREE_TWO, TWO_SIX, SIX_TWO, FOUR_FOUR})
+        {
+          auto const  step_seed = seed++;
+          cdt::Random value_random{step_seed};
+          cdt::Random in_place_random{step_seed};
+          CAPTURE(step_seed);
+          auto const expected = [&] {
+            switch (move)
+            {
+              case TWO_THREE:
+                return ergodic_moves::propose_23_move(manifold, value_random);
+              case THREE_TWO:
+                return ergodic_moves::propose_32_move(manifold, value_random);
+              case TWO_SIX:
+                return ergodic_moves::propose_26_move(manifold, value_random);
+              case SIX_TWO:
+                return ergodic_moves::propose_62_move(manifold, value_random);
+              case FOUR_FOUR:
+                return ergodic_moves::propose_44_move(manifold, value_random);
+            }
+            return ergodic_moves::Expected{manifold};
+          }();
+          auto       transaction = manifold.begin_transaction();
+          auto const applied     = [&] {
+            switch (move)
+            {
+              case TWO_THREE:
+                return ergodic_moves::propose_23_move(transaction,
+                                                      in_place_random);
+              case THREE_TWO:
+                return ergodic_moves::propose_32_move(transaction,
+                                                      in_place_random);
+              case TWO_SIX:
+                return ergodic_moves::propose_26_move(transaction,
+                                                      in_place_random);
+              case SIX_TWO:
+                return ergodic_moves::propose_62_move(transaction,
+                                                      in_place_random);
+              case FOUR_FOUR:
+                return ergodic_moves::propose_44_move(transaction,
+                                                      in_place_random);
+            }
+            return ergodic_moves::MoveApplication{};
+          }();
+          REQUIRE_EQ(applied.has_value(), expected.has_value());
+          if (!applied)
+          {
+            CHECK_EQ(applied.error().reason(), expected.error().reason());
+            continue;
+          }
+          transaction.stage();
+          ++compared;
+          CHECK_EQ(utilities::canonical_topology_fingerprint(manifold),
+                   utilities::canonical_topology_fingerprint(*expected));
+          transaction.commit();
+        }
+      }
+      THEN("Both paths applied the same sites and the domains stay ranked.")
+      {
+        REQUIRE_GT(compared, 0);
+        REQUIRE(manifold.is_correct_with_diagnostics());
+      }
+    }
+  }
+}
+
+SCENARIO("Applicable-site sets are patched around each move" *
+         doctest::test_suite("ergodic"))
+{
+  GIVEN("A small random manifold and its applicable sites")
+  {
+    constexpr auto simplices  = 640;
+    constexpr auto timeslices = 4;
+    Manifold_3     manifold(simplices, timeslices, cdt::Random{92});
+    REQUIRE(manifold.is_correct_with_diagnostics());
+    auto const collect = [&manifold] {
+      auto transaction = manifold.begin_transaction();
+      return ergodic_moves::ApplicableSites{transaction};
+    };
+    auto sites = collect();
+    REQUIRE_GT(sites.size(move_tracker::MoveType::TWO_THREE), 0);
+    REQUIRE_GT(sites.size(move_tracker::MoveType::TWO_SIX), 0);
+
+    WHEN("Every move type is applied repeatedly at applicable sites.")
+    {
+      using enum move_tracker::MoveType;
+      cdt::Random random{92};
+      CAPTURE(random.seed());
+      auto applied = 0;
+      for (auto round = 0; round < 8; ++round)  // NOLINT
+      {
+        for (auto const move :
+             {TWO_THREE, THREE_TWO, TWO_SIX, SIX_TWO, FOUR_FOUR})
+        {
+          auto const result = ergodic_moves::apply_applicable_move(
+              manifold, sites, move, random);
+          if (result) { ++applied; }
+          else
+          {
+            CHECK_NE(result.error().reason(),
+                     ergodic_moves::MoveFailure::INVARIANT_VIOLATION);
+          }
+        }
+      }
+      THEN("The patched sets agree with sets collected afresh.")
+      {
+        REQUIRE_GT(applied, 0);
+        REQUIRE(manifold.is_correct_with_diagnostics());
+        CHECK(sites == collect());
+      }
+    }
+    WHEN("Staged moves are rolled back and the sets patched.")
+    {
+      using enum move_tracker::MoveType;
+      cdt::Random random{92};
+      CAPTURE(random.seed());
+      auto rolled_back = 0;
+      for (auto const move :
+           {TWO_THREE, THREE_TWO, TWO_SIX, SIX_TWO, FOUR_FOUR})
+      {
+        if (sites.size(move) == 0) { continue; }
+        auto       transaction = manifold.begin_transaction();
+        auto const applied     = sites.apply(transaction, move, 0, random);
+        if (applied) { transaction.stage(); }
+        transaction.rollback();
+        sites.patch(transaction);
+        if (applied) { ++rolled_back; }
+      }
+      THEN("The patched sets agree with sets collected afresh.")
+      {
+        REQUIRE_GT(rolled_back, 0);
+        REQUIRE(manifold.is_correct_with_diagnostics());
+        CHECK(sites == collect());
+      }
+    }
+  }
+}
+
 SCENARIO("Perform bistellar flip on Delaunay triangulation" *
          doctest::test_suite("ergodic"))
 {
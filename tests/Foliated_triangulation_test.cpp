@@ -192,6 +192,41 @@ SCENARIO("FoliatedTriangulation free functions" *
       THEN("We get back the correct number of vertices.")
       { REQUIRE_EQ(vertices_from_cells.size(), 4); }
     }
+    WHEN("Two vertices are moved onto the same point and ranked.")
+    {
+      auto handles = collect_vertices<3>(snapshot);
+      REQUIRE_EQ(handles.size(), 4);
+      handles[1]->set_point(handles[0]->point());
+      RankedSet<Vertex_handle_t<3>> ranked{handles};
+      THEN("The coincident vertices are ordered by id.")
+      {
+        CHECK(ranked.is_ranked());
+        vector<Vertex_handle_t<3>> tied;
+        for (auto const& vertex : ranked)
+        {
+          if (vertex->point() == handles[0]->point())
+          {
+            tied.push_back(vertex);
+          }
+        }
+        REQUIRE_EQ(tied.size(), 2);
+        CHECK_LT(tied.front()->id(), tied.back()->id());
+      }
+      THEN("Each tied vertex is erased and reinserted exactly.")
+      {
+        for (auto const& vertex : {handles[0], handles[1]})
+        {
+          auto const others = handles.size() - 1;
+          REQUIRE(ranked.erase(vertex));
+          CHECK_FALSE(ranked.contains(vertex));
+          CHECK_EQ(ranked.size(), others);
+          CHECK(ranked.is_ranked());
+          REQUIRE(ranked.insert(vertex));
+          CHECK(ranked.is_ranked());
+        }
+        CHECK(ranges::equal(ranked, RankedSet<Vertex_handle_t<3>>{handles}));
+      }
+    }
   }
   GIVEN(
       "A minimal triangulation with non-default initial radius and radial "
@@ -12,12 +12,16 @@
 
 #include <doctest/doctest.h>
 
+#include <algorithm>
 #include <array>
+#include <chrono>
+#include <cmath>
 #include <cstdint>
 #include <limits>
 #include <numbers>
 #include <optional>
 #include <random>
+#include <stdexcept>
 #include <type_traits>
 #include <vector>
 
@@ -354,6 +358,17 @@ SCENARIO("Metropolis-Hastings proposal and acceptance ratios" *
         CHECK(mpfr_values::to_long_double(reverse) == doctest::Approx(2.5L));
         CHECK(mpfr_values::to_long_double(round_trip) == doctest::Approx(1.0L));
       }
+      AND_THEN("The Hastings ratio is the quotient of exact site counts.")
+      {
+        auto const sites = Metropolis_3::proposal_site_ratio(
+            current, proposed, move_tracker::MoveType::TWO_THREE);
+        CHECK_EQ(sites.forward, 4);
+        CHECK_EQ(sites.reverse, 10);
+        CHECK_THROWS_AS(static_cast<void>(Metropolis_3::proposal_site_ratio(
+                            proposed, proposed,
+                            move_tracker::MoveType::TWO_THREE)),
+                        std::logic_error);
+      }
       AND_THEN("The zero-action acceptance probability is the Hastings ratio.")
       {
         auto const probability = strategy.acceptance_probability(
@@ -476,6 +491,118 @@ SCENARIO("Metropolis-Hastings proposal and acceptance ratios" *
   }
 }
 
+SCENARIO("Certified acceptance agrees with the MPFR oracle" *
+         doctest::test_suite("metropolis"))
+{
+  using enum move_tracker::MoveType;
+  GIVEN("A strategy with nonzero couplings.")
+  {
+    Metropolis_3 strategy(0.6L, 1.1L, 0.1L, 1, 1, false, cdt::RandomSeed{92});
+
+    THEN("Certified evaluation is the default.")
+    {
+      CHECK_EQ(strategy.acceptance_evaluation(),
+               AcceptanceEvaluation::CERTIFIED);
+    }
+
+    WHEN("Each move is applied to a geometry by its fixed delta.")
+    {
+      Geometry_3 current;
+      current.N3_31    = 40;
+      current.N3_13    = 40;
+      current.N3_31_13 = 80;
+      current.N3_22    = 30;
+      current.N1_TL    = 60;
+      current.N1_SL    = 50;
+      current.N0       = 20;
+
+      THEN("The tabulated factor is the action ratio of the two states.")
+      {
+        for (auto const move :
+             {TWO_THREE, THREE_TWO, TWO_SIX, SIX_TWO, FOUR_FOUR})
+        {
+          CAPTURE(move_tracker::as_integer(move));
+          auto const proposed =
+              ergodic_moves::detail::moved_geometry(current, move);
+          REQUIRE(proposed.has_value());
+          auto const expected = mpfr_values::to_long_double(
+              strategy.action_ratio(current, *proposed));
+          CHECK(mpfr_values::to_long_double(strategy.action_factor(move)) ==
+                doctest::Approx(expected).epsilon(1.0e-15L));
+        }
+        CHECK_EQ(mpfr_values::to_long_double(
+                     strategy.action_factor(FOUR_FOUR)),
+                 1.0L);
+      }
+
+      THEN("Certified decisions match the oracle and defer near threshold.")
+      {
+        auto deferred_at_threshold = false;
+        for (auto const move :
+             {TWO_THREE, THREE_TWO, TWO_SIX, SIX_TWO, FOUR_FOUR})
+        {
+          CAPTURE(move_tracker::as_integer(move));
+          auto const proposed =
+              *ergodic_moves::detail::moved_geometry(current, move);
+          auto const probability =
+              strategy.acceptance_probability(current, proposed, move);
+          auto const threshold = mpfr_values::to_long_double(probability);
+          for (auto const trial : {0.0L, 0.25L, 0.5L, 0.75L, 1.0L, threshold})
+          {
+            CAPTURE(trial);
+            auto const decision =
+                strategy.certified_acceptance(current, proposed, move, trial);
+            if (decision)
+            {
+              CHECK_EQ(*decision, mpfr_cmp_ld(probability.fr(), trial) >= 0);
+            }
+          }
+          if (threshold < 1.0L)
+          {
+            CHECK_FALSE(strategy
+                            .certified_acceptance(current, proposed, move,
+                                                  threshold)
+                            .has_value());
+            deferred_at_threshold = true;
+          }
+        }
+        CHECK(deferred_at_threshold);
+      }
+    }
+
+    THEN("An unrecognized move has no tabulated factor.")
+    {
+      CHECK_THROWS_AS(static_cast<void>(strategy.action_factor(
+                          static_cast<move_tracker::MoveType>(255))),
+                      std::invalid_argument);
+    }
+  }
+
+  GIVEN("Two runs from one seed that differ only in acceptance evaluation.")
+  {
+    auto const     initial = minimal_23_manifold();
+    constexpr auto seed    = cdt::RandomSeed{92};
+    constexpr auto passes  = Int_precision{2};
+    Metropolis_3   certified(0.6L, 1.1L, 0.1L, passes, passes, false, seed);
+    Metropolis_3   oracle(0.6L, 1.1L, 0.1L, passes, passes, false, seed);
+    oracle.set_acceptance_evaluation(AcceptanceEvaluation::MPFR_ORACLE);
+
+    WHEN("Both runs are executed.")
+    {
+      auto const certified_result = certified(initial);
+      auto const oracle_result    = oracle(initial);
+
+      THEN("They make every acceptance decision identically.")
+      {
+        CHECK_EQ(certified_result.delaunay_snapshot(),
+                 oracle_result.delaunay_snapshot());
+        CHECK_EQ(certified.transition_count(), oracle.transition_count());
+        CHECK_EQ(certified.transition_trace(), oracle.transition_trace());
+      }
+    }
+  }
+}
+
 SCENARIO("Metropolis proposal domains match the sampled raw sites" *
          doctest::test_suite("metropolis"))
 {
@@ -961,6 +1088,281 @@ SCENARIO("Metropolis multi-pass accounting is per invocation" *
   }
 }
 
+SCENARIO("Metropolis runs estimate autocorrelation without perturbing draws" *
+         doctest::test_suite("metropolis"))
+{
+  GIVEN("Fixed and adaptive checkpoint runs from one seed.")
+  {
+    auto const     initial    = minimal_23_manifold();
+    constexpr auto passes     = Int_precision{40};
+    constexpr auto checkpoint = Int_precision{10};
+    constexpr auto seed       = cdt::RandomSeed{103};
+    Metropolis_3   fixed(0.6L, 0.0L, 0.0L, passes, checkpoint, false, seed);
+    Metropolis_3   adaptive(0.6L, 0.0L, 0.0L, passes, checkpoint, false, seed);
+    adaptive.set_adaptive_checkpoints(0.5L);
+    REQUIRE_EQ(adaptive.adaptive_checkpoints(), 0.5L);
+
+    WHEN("Both strategies run.")
+    {
+      auto const fixed_result    = fixed(initial);
+      auto const adaptive_result = adaptive(initial);
+      auto const& monitor        = adaptive.autocorrelation();
+
+      THEN("Every transition is observed once.")
+      {
+        CHECK_EQ(monitor.n3().count(), adaptive.transition_count());
+        CHECK_EQ(monitor.n1_tl().count(), adaptive.transition_count());
+        CHECK_EQ(monitor.action().count(), adaptive.transition_count());
+        if (auto const samples = monitor.effective_sample_size())
+        {
+          CHECK_GT(*samples, 0.0L);
+          CHECK_LE(*samples,
+                   static_cast<long double>(monitor.n3().count()));
+        }
+      }
+      AND_THEN("Only the checkpoint cadence depends on the schedule.")
+      {
+        CHECK(adaptive_result.is_valid());
+        CHECK_EQ(fixed_result.delaunay_snapshot(),
+                 adaptive_result.delaunay_snapshot());
+        CHECK_EQ(fixed.transition_trace(), adaptive.transition_trace());
+        CHECK_EQ(fixed.checkpoint_events(), passes / checkpoint);
+      }
+    }
+    THEN("Non-positive and non-finite multiples are rejected.")
+    {
+      CHECK_THROWS_AS(adaptive.set_adaptive_checkpoints(0.0L),
+                      std::invalid_argument);
+      CHECK_THROWS_AS(adaptive.set_adaptive_checkpoints(
+                          std::numeric_limits<long double>::quiet_NaN()),
+                      std::invalid_argument);
+      adaptive.set_adaptive_checkpoints(std::nullopt);
+      CHECK_FALSE(adaptive.adaptive_checkpoints());
+    }
+  }
+}
+
+SCENARIO("Metropolis burn-in precedes production and is recorded" *
+         doctest::test_suite("metropolis"))
+{
+  GIVEN("A Metropolis strategy with a bounded automatic burn-in.")
+  {
+    auto const     initial = minimal_23_manifold();
+    constexpr auto passes  = Int_precision{2};
+    constexpr auto limit   = Int_precision{30};
+    Metropolis_3   strategy(0.6L, 0.0L, 0.0L, passes, passes, false,
+                            cdt::RandomSeed{103});
+    strategy.set_burn_in(limit);
+
+    WHEN("The strategy runs.")
+    {
+      auto const result = strategy(initial);
+
+      THEN("Burn-in ran whole passes before the configured production.")
+      {
+        CHECK(result.is_valid());
+        REQUIRE(strategy.burn_in().has_value());
+        auto const& burn_in = *strategy.burn_in();
+        CHECK_EQ(burn_in.limit, limit);
+        CHECK_LE(burn_in.passes, limit);
+        // The MSER test needs the initial state and nine passes.
+        CHECK_GE(burn_in.passes,
+                 static_cast<Int_precision>(
+                     equilibration::MserSeries::min_samples - 1));
+        CHECK_EQ(burn_in.equilibrated, burn_in.passes < limit);
+        CHECK_EQ(strategy.checkpoint_events(), 1);
+        CHECK_EQ(strategy.transition_count(), strategy.proposed().total());
+      }
+      AND_THEN("Production metadata records the burn-in.")
+      {
+        auto const metadata = strategy.reproducibility_metadata(
+            result, utilities::ArtifactKind::CHECKPOINT, passes);
+        REQUIRE(metadata.burn_in.has_value());
+        CHECK_EQ(metadata.burn_in->passes, strategy.burn_in()->passes);
+        CHECK_EQ(metadata.completed_passes, passes);
+      }
+    }
+    THEN("A nonpositive limit is rejected and an empty one disables it.")
+    {
+      CHECK_THROWS_AS(strategy.set_burn_in(0), std::invalid_argument);
+      strategy.set_burn_in(std::nullopt);
+      static_cast<void>(strategy(initial));
+      CHECK_FALSE(strategy.burn_in());
+    }
+  }
+}
+
+SCENARIO("Metropolis runs stop cleanly at a deadline or on a signal" *
+         doctest::test_suite("metropolis"))
+{
+  GIVEN("A Metropolis strategy.")
+  {
+    auto const     initial = minimal_23_manifold();
+    constexpr auto passes  = Int_precision{3};
+    Metropolis_3   strategy(0.6L, 1.1L, 0.1L, passes, passes, false,
+                            cdt::RandomSeed{113});
+
+    WHEN("Its deadline has already passed.")
+    {
+      strategy.set_deadline(std::chrono::steady_clock::now() -
+                            std::chrono::seconds{1});
+      auto const result = strategy(initial);
+
+      THEN("The run stops before its first transition.")
+      {
+        CHECK(result.is_valid());
+        CHECK_EQ(strategy.completed_passes(), 0);
+        CHECK_EQ(strategy.transition_count(), 0);
+        CHECK_EQ(strategy.checkpoint_events(), 1);
+        REQUIRE(strategy.interruption().has_value());
+        CHECK_EQ(strategy.interruption()->reason, "deadline");
+        CHECK_EQ(strategy.interruption()->pass_attempts, initial.N3());
+        CHECK_EQ(strategy.interruption()->pass_transitions, 0);
+      }
+      AND_THEN("Provenance records the early stop.")
+      {
+        auto const metadata = strategy.reproducibility_metadata(
+            result, utilities::ArtifactKind::CHECKPOINT,
+            strategy.completed_passes());
+        REQUIRE(metadata.interruption.has_value());
+        CHECK_EQ(metadata.interruption->reason, "deadline");
+        CHECK_EQ(metadata.completed_passes, 0);
+      }
+    }
+    WHEN("A stop signal is pending.")
+    {
+      detail::stop_signal = 15;
+      auto const result   = strategy(initial);
+      detail::stop_signal = 0;
+
+      THEN("The run stops and reports the signal.")
+      {
+        CHECK(result.is_valid());
+        CHECK_EQ(strategy.completed_passes(), 0);
+        REQUIRE(strategy.interruption().has_value());
+        CHECK_EQ(strategy.interruption()->reason, "signal");
+      }
+    }
+    WHEN("Its deadline is far away.")
+    {
+      strategy.set_deadline(std::chrono::steady_clock::now() +
+                            std::chrono::hours{1});
+      static_cast<void>(strategy(initial));
+
+      THEN("Every configured pass completes.")
+      {
+        CHECK_EQ(strategy.completed_passes(), passes);
+        CHECK_FALSE(strategy.interruption());
+      }
+    }
+  }
+}
+
+SCENARIO("Metropolis runs resume exactly from a checkpoint" *
+         doctest::test_suite("metropolis"))
+{
+  GIVEN("An uninterrupted run and a run split at a checkpoint.")
+  {
+    Manifold_3 const universe(640, 4, cdt::Random{92});
+    REQUIRE(universe.is_correct());
+    constexpr auto passes = Int_precision{2};
+    constexpr auto seed   = cdt::RandomSeed{127};
+
+    auto const same = [](move_tracker::MoveTracker const& left,
+                         move_tracker::MoveTracker const& right) {
+      return std::ranges::equal(left.moves_view(), right.moves_view());
+    };
+
+    WHEN("The second pass resumes from a checkpoint of the first.")
+    {
+      Metropolis_3 whole(0.6L, 1.1L, 0.1L, passes, passes, false, seed);
+      Metropolis_3 first(0.6L, 1.1L, 0.1L, 1, 1, false, seed);
+      Metropolis_3 rest(0.6L, 1.1L, 0.1L, passes, passes, false, seed);
+      auto const   whole_result = whole(universe);
+      auto const   first_result = first(universe);
+      auto         checkpoint   = first.reproducibility_metadata(
+          first_result, utilities::ArtifactKind::CHECKPOINT, 1);
+      checkpoint.resume = first.resume_metadata();
+      rest.resume_from(checkpoint);
+      auto const rest_result = rest(first_result);
+
+      THEN("The resumed run matches the uninterrupted one.")
+      {
+        CHECK(rest_result.is_valid());
+        CHECK_EQ(rest_result.delaunay_snapshot(),
+                 whole_result.delaunay_snapshot());
+        CHECK_EQ(rest.transition_trace(), whole.transition_trace());
+        CHECK_EQ(rest.transition_count(), whole.transition_count());
+        CHECK_EQ(rest.completed_passes(), passes);
+        CHECK(same(rest.proposed(), whole.proposed()));
+        CHECK(same(rest.accepted(), whole.accepted()));
+        CHECK(same(rest.rejected(), whole.rejected()));
+        CHECK(same(rest.attempted(), whole.attempted()));
+        CHECK(same(rest.succeeded(), whole.succeeded()));
+        CHECK(same(rest.failed(), whole.failed()));
+      }
+    }
+    WHEN("A run stopped at its deadline is resumed.")
+    {
+      Metropolis_3 whole(0.6L, 1.1L, 0.1L, passes, passes, false, seed);
+      Metropolis_3 stopped(0.6L, 1.1L, 0.1L, passes, passes, false, seed);
+      Metropolis_3 rest(0.6L, 1.1L, 0.1L, passes, passes, false, seed);
+      stopped.set_deadline(std::chrono::steady_clock::now() -
+                           std::chrono::seconds{1});
+      auto const whole_result   = whole(universe);
+      auto const stopped_result = stopped(universe);
+      auto       checkpoint     = stopped.reproducibility_metadata(
+          stopped_result, utilities::ArtifactKind::CHECKPOINT,
+          stopped.completed_passes());
+      checkpoint.resume = stopped.resume_metadata();
+      rest.resume_from(checkpoint);
+      auto const rest_result = rest(stopped_result);
+
+      THEN("The stopped pass is finished and the run matches.")
+      {
+        REQUIRE(checkpoint.interruption.has_value());
+        CHECK_FALSE(rest.interruption());
+        CHECK_EQ(rest_result.delaunay_snapshot(),
+                 whole_result.delaunay_snapshot());
+        CHECK_EQ(rest.transition_trace(), whole.transition_trace());
+        CHECK_EQ(rest.transition_count(), whole.transition_count());
+      }
+    }
+    WHEN("A checkpoint is offered to a run it does not belong to.")
+    {
+      Metropolis_3 first(0.6L, 1.1L, 0.1L, 1, 1, false, seed);
+      auto const   first_result = first(universe);
+      auto         checkpoint   = first.reproducibility_metadata(
+          first_result, utilities::ArtifactKind::CHECKPOINT, 1);
+      checkpoint.resume = first.resume_metadata();
+      Metropolis_3 reseeded(0.6L, 1.1L, 0.1L, passes, passes, false,
+                            cdt::RandomSeed{131});
+      Metropolis_3 coupled(0.7L, 1.1L, 0.1L, passes, passes, false, seed);
+      Metropolis_3 same_run(0.6L, 1.1L, 0.1L, passes, passes, false, seed);
+      auto final_artifact     = checkpoint;
+      final_artifact.artifact = utilities::ArtifactKind::FINAL_TRIANGULATION;
+      auto beyond             = checkpoint;
+      beyond.completed_passes = passes + 1;
+      auto unresumable        = checkpoint;
+      unresumable.resume.reset();
+
+      THEN("Resuming is refused.")
+      {
+        CHECK_THROWS_AS(reseeded.resume_from(checkpoint),
+                        std::invalid_argument);
+        CHECK_THROWS_AS(coupled.resume_from(checkpoint),
+                        std::invalid_argument);
+        CHECK_THROWS_AS(same_run.resume_from(final_artifact),
+                        std::invalid_argument);
+        CHECK_THROWS_AS(same_run.resume_from(beyond), std::invalid_argument);
+        CHECK_THROWS_AS(same_run.resume_from(unresumable),
+                        std::invalid_argument);
+        CHECK_NOTHROW(same_run.resume_from(checkpoint));
+      }
+    }
+  }
+}
+
 SCENARIO("Metropolis provenance is derived from the actual run" *
          doctest::test_suite("metropolis"))
 {
@@ -1016,3 +1418,110 @@ SCENARIO("Metropolis provenance is derived from the actual run" *
     }
   }
 }
+
+SCENARIO("Volume fixing adds its potential to every acceptance" *
+         doctest::test_suite("metropolis"))
+{
+  using enum move_tracker::MoveType;
+  auto const volume = s3_action::make_volume_fixing(
+      s3_action::VolumePotential::QUADRATIC, 0.05L, 100);
+  GIVEN("Strategies with and without a quadratic volume term.")
+  {
+    Metropolis_3 plain(0.6L, 1.1L, 0.1L, 1, 1, false, cdt::RandomSeed{92});
+    Metropolis_3 fixed(0.6L, 1.1L, 0.1L, 1, 1, false, cdt::RandomSeed{92});
+    fixed.set_volume_fixing(volume);
+    Geometry_3 current;
+    current.N3_31    = 40;
+    current.N3_13    = 40;
+    current.N3_31_13 = 80;
+    current.N3_22    = 30;
+    current.N3       = 110;
+    current.N1_TL    = 60;
+    current.N1_SL    = 50;
+    current.N0       = 20;
+
+    THEN("The action ratio gains the volume factor of each move.")
+    {
+      for (auto const move :
+           {TWO_THREE, THREE_TWO, TWO_SIX, SIX_TWO, FOUR_FOUR})
+      {
+        CAPTURE(move_tracker::as_integer(move));
+        auto const proposed =
+            *ergodic_moves::detail::moved_geometry(current, move);
+        auto const expected =
+            mpfr_values::to_long_double(plain.action_ratio(current, proposed)) *
+            std::exp(s3_action::volume_exponent(current.N3, proposed.N3,
+                                                volume));
+        CHECK(mpfr_values::to_long_double(
+                  fixed.action_ratio(current, proposed)) ==
+              doctest::Approx(expected).epsilon(1.0e-15L));
+      }
+    }
+
+    THEN("Certified decisions still match the oracle.")
+    {
+      for (auto const move :
+           {TWO_THREE, THREE_TWO, TWO_SIX, SIX_TWO, FOUR_FOUR})
+      {
+        CAPTURE(move_tracker::as_integer(move));
+        auto const proposed =
+            *ergodic_moves::detail::moved_geometry(current, move);
+        auto const probability =
+            fixed.acceptance_probability(current, proposed, move);
+        auto const threshold = mpfr_values::to_long_double(probability);
+        for (auto const trial : {0.0L, 0.25L, 0.5L, 0.75L, 1.0L, threshold})
+        {
+          CAPTURE(trial);
+          auto const decision =
+              fixed.certified_acceptance(current, proposed, move, trial);
+          if (decision)
+          {
+            CHECK_EQ(*decision, mpfr_cmp_ld(probability.fr(), trial) >= 0);
+          }
+        }
+      }
+    }
+  }
+
+  GIVEN("Certified and oracle runs from one seed with volume fixing.")
+  {
+    Manifold_3 const initial(640, 4, cdt::Random{92});
+    constexpr auto   seed   = cdt::RandomSeed{92};
+    constexpr auto   passes = Int_precision{1};
+    auto const       tight  = s3_action::make_volume_fixing(
+        s3_action::VolumePotential::LINEAR, 2.0L, initial.N3());
+    Metropolis_3 certified(0.6L, 1.1L, 0.1L, passes, passes, false, seed);
+    Metropolis_3 oracle(0.6L, 1.1L, 0.1L, passes, passes, false, seed);
+    certified.set_volume_fixing(tight);
+    oracle.set_volume_fixing(tight);
+    oracle.set_acceptance_evaluation(AcceptanceEvaluation::MPFR_ORACLE);
+
+    WHEN("Both runs are executed.")
+    {
+      auto const certified_result = certified(initial);
+      auto const oracle_result    = oracle(initial);
+
+      THEN("They agree and reject some proposals before construction.")
+      {
+        CHECK(certified_result.is_valid());
+        CHECK_EQ(certified_result.delaunay_snapshot(),
+                 oracle_result.delaunay_snapshot());
+        CHECK_EQ(certified.transition_trace(), oracle.transition_trace());
+        CHECK_EQ(certified.proposed().total(),
+                 certified.accepted().total() + certified.rejected().total());
+        CHECK_EQ(certified.attempted().total(),
+                 certified.succeeded().total() + certified.failed().total());
+        CHECK_LT(certified.attempted().total(), certified.proposed().total());
+      }
+      AND_THEN("Provenance records the volume term.")
+      {
+        auto const metadata = certified.reproducibility_metadata(
+            certified_result, utilities::ArtifactKind::CHECKPOINT, passes);
+        REQUIRE(metadata.volume_fixing.has_value());
+        CHECK_EQ(metadata.volume_fixing->potential, "linear");
+        CHECK_EQ(metadata.volume_fixing->epsilon, 2.0L);
+        CHECK_EQ(metadata.volume_fixing->target, initial.N3());
+      }
+    }
+  }
+}
@@ -277,6 +277,43 @@ SCENARIO("MoveAlways multi-pass accounting is per invocation" *
   }
 }
 
+SCENARIO("MoveAlways can draw sites from applicable subsets" *
+         doctest::test_suite("move_always"))
+{
+  GIVEN("A fixed seed and two MoveAlways strategies.")
+  {
+    auto const     initial    = minimal_23_manifold();
+    constexpr auto passes     = Int_precision{4};
+    constexpr auto checkpoint = Int_precision{2};
+    constexpr auto seed       = cdt::RandomSeed{103};
+    MoveAlways_3   raw(passes, checkpoint, seed, false);
+    MoveAlways_3   applicable(passes, checkpoint, seed, false);
+    applicable.set_applicable_sites(true);
+    CAPTURE(seed);
+
+    WHEN("Only one opts into applicable sites.")
+    {
+      auto const   result = applicable(initial);
+      MoveAlways_3 replay(passes, checkpoint, seed, false);
+      replay.set_applicable_sites(true);
+      auto const replayed = replay(initial);
+      THEN("The default stays on the raw-domain path.")
+      {
+        CHECK_FALSE(raw.uses_applicable_sites());
+        CHECK(applicable.uses_applicable_sites());
+      }
+      THEN("The applicable run is correct, accounted, and replayable.")
+      {
+        CHECK(result.is_correct());
+        CHECK_EQ(applicable.attempted().total(),
+                 applicable.succeeded().total() + applicable.failed().total());
+        CHECK_EQ(result.delaunay_snapshot(), replayed.delaunay_snapshot());
+        CHECK_EQ(applicable.succeeded().total(), replay.succeeded().total());
+      }
+    }
+  }
+}
+
 SCENARIO("Using the MoveAlways algorithm" * doctest::test_suite("move_always"))
 {
   spdlog::debug("Using the MoveAlways algorithm.\n");
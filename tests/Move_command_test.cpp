@@ -571,5 +571,32 @@ SCENARIO("Executing multiple moves on the queue" *
         CHECK(result.is_valid());
       }
     }
+    WHEN("One of each move is executed at applicable sites.")
+    {
+      MoveCommand command(manifold);
+      command.enqueue(move_tracker::MoveType::TWO_THREE);
+      command.enqueue(move_tracker::MoveType::TWO_SIX);
+      command.enqueue(move_tracker::MoveType::FOUR_FOUR);
+      command.enqueue(move_tracker::MoveType::SIX_TWO);
+      command.enqueue(move_tracker::MoveType::THREE_TWO);
+      THEN("Every move finds a site and the result is correct.")
+      {
+        cdt::Random random{92};
+        CAPTURE(random.seed());
+        command.execute_applicable(random);
+
+        CHECK_EQ(command.attempted().total(), 5);
+        // The (2,6) move creates a (6,2) site, so neither can run out.
+        CHECK_EQ(command.succeeded().two_six_moves(), 1);
+        CHECK_EQ(command.succeeded().six_two_moves(), 1);
+        CHECK_EQ(command.succeeded().total() + command.failed().total(), 5);
+
+        auto const& result = command.result();
+        CHECK_EQ(result.simplices(),
+                 manifold.simplices() + command.succeeded().two_three_moves() -
+                     command.succeeded().three_two_moves());
+        CHECK(result.is_correct());
+      }
+    }
   }
 }
@@ -11,7 +11,13 @@
 
 #include <doctest/doctest.h>
 
+#include <atomic>
+#include <chrono>
+#include <latch>
 #include <limits>
+#include <optional>
+#include <stdexcept>
+#include <thread>
 #include <type_traits>
 #include <vector>
 
@@ -122,6 +128,38 @@ SCENARIO("Raw move-run cadence is parsed into a positive domain value" *
       }
     }
   }
+
+  GIVEN("A parsed cadence and the passes an earlier run completed.")
+  {
+    auto const cadence = MoveRunCadence::parse(4, 2);
+    REQUIRE(cadence);
+
+    WHEN("The cadence is resumed inside and outside its run.")
+    {
+      auto const fresh    = cadence->resumed_after(0);
+      auto const partial  = cadence->resumed_after(3);
+      auto const finished = cadence->resumed_after(4);
+      auto const negative = cadence->resumed_after(-1);
+      auto const beyond   = cadence->resumed_after(5);
+
+      THEN("Only completed passes within the run are accepted.")
+      {
+        CHECK_EQ(cadence->completed(), 0);
+        REQUIRE(fresh);
+        CHECK_EQ(fresh->completed(), 0);
+        REQUIRE(partial);
+        CHECK_EQ(partial->passes(), 4);
+        CHECK_EQ(partial->checkpoint(), 2);
+        CHECK_EQ(partial->completed(), 3);
+        REQUIRE(finished);
+        CHECK_EQ(finished->completed(), 4);
+        REQUIRE_FALSE(negative);
+        REQUIRE_FALSE(beyond);
+        CHECK_EQ(negative.error(), MoveRunCadenceError::COMPLETED_OUT_OF_RANGE);
+        CHECK_EQ(beyond.error(), MoveRunCadenceError::COMPLETED_OUT_OF_RANGE);
+      }
+    }
+  }
 }
 
 SCENARIO("MoveCommand results are consumed and reset once" *
@@ -216,6 +254,59 @@ SCENARIO("Shared move-run orchestration accumulates pass deltas once" *
   }
 }
 
+SCENARIO("Shared move-run orchestration resumes after completed passes" *
+         doctest::test_suite("move_run"))
+{
+  GIVEN("A three-pass cadence resumed after its first pass.")
+  {
+    auto const cadence = MoveRunCadence::parse(3, 2);
+    REQUIRE(cadence);
+    auto const resumed = cadence->resumed_after(1);
+    REQUIRE(resumed);
+    detail::MoveCommandResults<ScriptedManifold> earlier;
+    earlier.attempted[move_tracker::MoveType::TWO_THREE] = 2;
+    std::vector<int>           passes;
+    std::vector<Int_precision> checkpoints;
+
+    WHEN("The shared runner continues from the earlier totals.")
+    {
+      auto result = detail::execute_move_run(
+          ScriptedManifold{}, 0, *resumed,
+          detail::MoveRunIdentity{.algorithm = "Scripted",
+                                  .seed      = RandomSeed{103},
+                                  .stream    = RandomStream{7}},
+          true,
+          [&passes](ScriptedManifold current, int const pass_index,
+                    Int_precision const attempts) {
+            passes.push_back(pass_index);
+            detail::MoveCommandResults<ScriptedManifold> delta;
+            delta.attempted[move_tracker::MoveType::TWO_THREE] = attempts;
+            return detail::MovePassResult<ScriptedManifold, int>{
+                .manifold        = current,
+                .command_results = delta,
+                .strategy_state  = pass_index + 1};
+          },
+          [](ScriptedManifold const&,
+             detail::MoveCommandResults<ScriptedManifold> const&,
+             int const&) {},
+          [&checkpoints](ScriptedManifold const&,
+                         detail::MoveCommandResults<ScriptedManifold> const&,
+                         int const&, Int_precision const pass_number) {
+            checkpoints.push_back(pass_number);
+          },
+          detail::FixedCheckpointSchedule{}, earlier);
+
+      THEN("Only the remaining passes run, on the earlier pass numbers.")
+      {
+        CHECK_EQ(passes, std::vector<int>{0, 1});
+        CHECK_EQ(result.strategy_state, 2);
+        CHECK_EQ(result.command_results.attempted.total(), 6);
+        CHECK_EQ(checkpoints, std::vector<Int_precision>{2});
+      }
+    }
+  }
+}
+
 SCENARIO(
     "Shared move-run orchestration suppresses disabled checkpoint effects" *
     doctest::test_suite("move_run"))
@@ -259,3 +350,230 @@ SCENARIO(
     }
   }
 }
+
+SCENARIO("Shared move-run orchestration follows a caller's schedule" *
+         doctest::test_suite("move_run"))
+{
+  GIVEN("A four-pass cadence and a schedule keyed on the strategy state.")
+  {
+    auto const cadence = MoveRunCadence::parse(4, 4);
+    REQUIRE(cadence);
+    std::vector<Int_precision> checkpoints;
+
+    WHEN("The shared runner executes with the schedule.")
+    {
+      auto result = detail::execute_move_run(
+          ScriptedManifold{}, 0, *cadence,
+          detail::MoveRunIdentity{.algorithm = "Scripted",
+                                  .seed      = RandomSeed{103},
+                                  .stream    = RandomStream{7}},
+          true,
+          [](ScriptedManifold current, int pass_index, Int_precision) {
+            return detail::MovePassResult<ScriptedManifold, int>{
+                .manifold        = current,
+                .command_results = {},
+                .strategy_state  = pass_index + 1};
+          },
+          [](ScriptedManifold const&,
+             detail::MoveCommandResults<ScriptedManifold> const&, int const&) {
+          },
+          [&checkpoints](ScriptedManifold const&,
+                         detail::MoveCommandResults<ScriptedManifold> const&,
+                         int const&, Int_precision const pass_number) {
+            checkpoints.push_back(pass_number);
+          },
+          [](MoveRunCadence, Int_precision, ScriptedManifold const&,
+             int const& passes) { return passes % 2 == 1; });
+
+      THEN("Checkpoint events replace the fixed cadence.")
+      {
+        CHECK_EQ(result.checkpoint_events, 2);
+        CHECK_EQ(checkpoints, std::vector<Int_precision>{1, 3});
+      }
+    }
+  }
+}
+
+SCENARIO("Checkpoint snapshots are published in the background" *
+         doctest::test_suite("move_run"))
+{
+  GIVEN("A zero-capacity queue.")
+  {
+    THEN("Construction is rejected.")
+    {
+      CHECK_THROWS_AS(detail::CheckpointWriter{0}, std::invalid_argument);
+    }
+  }
+  GIVEN("A writer and three snapshot jobs.")
+  {
+    detail::CheckpointWriter writer;
+    std::vector<Int_precision> written;
+    WHEN("The jobs are submitted and drained.")
+    {
+      for (auto pass = Int_precision{1}; pass <= 3; ++pass)
+      {
+        writer.submit(pass, [&written, pass] { written.push_back(pass); });
+      }
+      auto const published = writer.drain();
+      THEN("Every job runs once, in order, and is reported once.")
+      {
+        CHECK_EQ(written, std::vector<Int_precision>{1, 2, 3});
+        CHECK_EQ(published, std::vector<Int_precision>{1, 2, 3});
+        CHECK(writer.poll().empty());
+      }
+    }
+  }
+  GIVEN("A one-snapshot queue whose first job is held.")
+  {
+    detail::CheckpointWriter writer{1};
+    std::latch               release{1};
+    std::atomic<bool>        second_queued{false};
+    writer.submit(1, [&release] { release.wait(); });
+    WHEN("A second snapshot is submitted from another thread.")
+    {
+      std::jthread producer{[&writer, &second_queued] {
+        writer.submit(2, [] {});
+        second_queued = true;
+      }};
+      std::this_thread::sleep_for(std::chrono::milliseconds{50});
+      auto const blocked = !second_queued.load();
+      release.count_down();
+      producer.join();
+      THEN("Submission waits for the outstanding snapshot.")
+      {
+        CHECK(blocked);
+        CHECK(second_queued.load());
+        CHECK_EQ(writer.drain(), std::vector<Int_precision>{1, 2});
+      }
+    }
+  }
+  GIVEN("A writer whose first job fails.")
+  {
+    detail::CheckpointWriter writer{4};
+    std::latch               release{1};
+    std::atomic<int>         later_runs{0};
+    writer.submit(1, [&release] {
+      release.wait();
+      throw std::runtime_error{"disk full"};
+    });
+    writer.submit(2, [&later_runs] { ++later_runs; });
+    release.count_down();
+    THEN("The failure is reported once and later jobs are discarded.")
+    {
+      CHECK_THROWS_AS(static_cast<void>(writer.drain()), std::runtime_error);
+      CHECK_EQ(later_runs.load(), 0);
+      CHECK(writer.poll().empty());
+    }
+  }
+}
+
+SCENARIO("A stopped pass ends the run with a final checkpoint" *
+         doctest::test_suite("move_run"))
+{
+  GIVEN("A three-pass cadence whose second pass stops early.")
+  {
+    auto const cadence = MoveRunCadence::parse(3, 3);
+    REQUIRE(cadence);
+    std::vector<Int_precision> checkpoints;
+    auto                       passes_started = 0;
+
+    WHEN("The shared runner executes.")
+    {
+      auto result = detail::execute_move_run(
+          ScriptedManifold{}, 0, *cadence,
+          detail::MoveRunIdentity{.algorithm = "Scripted",
+                                  .seed      = RandomSeed{103},
+                                  .stream    = RandomStream{7}},
+          true,
+          [&passes_started](ScriptedManifold current, int pass_index,
+                            Int_precision) {
+            ++passes_started;
+            return detail::MovePassResult<ScriptedManifold, int>{
+                .manifold        = current,
+                .command_results = {},
+                .strategy_state  = pass_index + 1,
+                .stopped         = pass_index == 1
+                                       ? std::optional{RunStop::DEADLINE}
+                                       : std::nullopt};
+          },
+          [](ScriptedManifold const&,
+             detail::MoveCommandResults<ScriptedManifold> const&, int const&) {
+          },
+          [&checkpoints](ScriptedManifold const&,
+                         detail::MoveCommandResults<ScriptedManifold> const&,
+                         int const&, Int_precision const pass_number) {
+            checkpoints.push_back(pass_number);
+          });
+
+      THEN("The partial pass is checkpointed and no later pass starts.")
+      {
+        CHECK_EQ(passes_started, 2);
+        CHECK_EQ(result.strategy_state, 2);
+        CHECK_EQ(result.completed_passes, 1);
+        CHECK_EQ(result.stopped, std::optional{RunStop::DEADLINE});
+        CHECK_EQ(result.checkpoint_events, 1);
+        CHECK_EQ(checkpoints, std::vector<Int_precision>{1});
+      }
+    }
+  }
+}
+
+SCENARIO("Run budgets stop work at a deadline or on a signal" *
+         doctest::test_suite("move_run"))
+{
+  using Clock    = detail::RunBudget::Clock;
+  auto const now = Clock::now();
+  GIVEN("A budget without a deadline.")
+  {
+    detail::RunBudget const budget;
+    THEN("Only a stop signal exhausts it.")
+    {
+      CHECK_FALSE(budget.exhausted());
+      detail::stop_signal = 15;
+      auto const stop     = budget.exhausted();
+      detail::stop_signal = 0;
+      CHECK_EQ(stop, std::optional{RunStop::SIGNAL});
+      CHECK_EQ(run_stop_name(*stop), "signal");
+    }
+  }
+  GIVEN("A one-hour budget.")
+  {
+    detail::RunBudget budget{now + std::chrono::hours{1}, now};
+    THEN("A twentieth is reserved until a write is measured.")
+    {
+      CHECK_EQ(budget.reserve(), Clock::duration{std::chrono::minutes{3}});
+      CHECK_FALSE(budget.exhausted());
+      budget.reserve_for(Clock::duration::zero());
+      CHECK_EQ(budget.reserve(), Clock::duration{std::chrono::minutes{3}});
+      budget.reserve_for(std::chrono::seconds{10});
+      CHECK_EQ(budget.reserve(), Clock::duration{std::chrono::seconds{20}});
+    }
+    THEN("A reserve covering the whole budget exhausts it.")
+    {
+      budget.reserve_for(std::chrono::hours{1});
+      CHECK_EQ(budget.exhausted(), std::optional{RunStop::DEADLINE});
+    }
+  }
+  GIVEN("A deadline that has passed.")
+  {
+    detail::RunBudget const budget{now - std::chrono::seconds{1}, now};
+    THEN("It is exhausted by the deadline.")
+    {
+      CHECK_EQ(budget.exhausted(), std::optional{RunStop::DEADLINE});
+      CHECK_EQ(run_stop_name(RunStop::DEADLINE), "deadline");
+    }
+  }
+  GIVEN("A writer and a slow snapshot job.")
+  {
+    detail::CheckpointWriter writer;
+    CHECK_EQ(writer.longest_write(), Clock::duration::zero());
+    writer.submit(1, [] {
+      std::this_thread::sleep_for(std::chrono::milliseconds{20});
+    });
+    static_cast<void>(writer.drain());
+    THEN("The longest write is measured.")
+    {
+      CHECK(writer.longest_write() >= std::chrono::milliseconds{20});
+    }
+  }
+}
@@ -0,0 +1,227 @@
+/*******************************************************************************
+ Causal Dynamical Triangulations in C++ using CGAL
+
+ Copyright © 2026 Adam Getchell
+ ******************************************************************************/
+
+/// @file Parallel_tempering_test.cpp
+/// @brief Tests for the replica-exchange strategy
+
+#include "Parallel_tempering.hpp"
+
+#include <doctest/doctest.h>
+
+#include <cstdint>
+#include <numbers>
+#include <stdexcept>
+#include <vector>
+
+using namespace cdt;
+using namespace std;
+using namespace manifolds;
+
+namespace
+{
+  [[nodiscard]] auto minimal_26_manifold() -> Manifold_3
+  {
+    constexpr auto radius = 2.0 * std::numbers::inv_sqrt3_v<double>;
+    vector         vertices{
+        Point_t<3>{     0,      0,      0},
+        Point_t<3>{     1,      0,      0},
+        Point_t<3>{     0,      1,      0},
+        Point_t<3>{     0,      0,      1},
+        Point_t<3>{radius, radius, radius}
+    };
+    vector<size_t> timevalues{0, 1, 1, 1, 2};
+    return Manifold_3{make_causal_vertices<3>(vertices, timevalues)};
+  }
+
+  [[nodiscard]] auto make_geometry(Int_precision const n1_tl,
+                                   Int_precision const n3_31_13,
+                                   Int_precision const n3_22) -> Geometry_3
+  {
+    Geometry_3 geometry;
+    geometry.N1_TL    = n1_tl;
+    geometry.N3_31_13 = n3_31_13;
+    geometry.N3_22    = n3_22;
+    geometry.N3       = n3_31_13 + n3_22;
+    return geometry;
+  }
+}  // namespace
+
+SCENARIO("Parallel tempering validates its ladder" *
+         doctest::test_suite("parallel_tempering"))
+{
+  GIVEN("A ladder with a single rung.")
+  {
+    THEN("Construction is rejected.")
+    {
+      CHECK_THROWS_AS(ParallelTempering_3(0.6L, 1.1L, 0.1L,
+                                          TemperedCoupling::K, {1.1L}, 1, 1,
+                                          false, cdt::Random{7}),
+                      std::invalid_argument);
+    }
+  }
+  GIVEN("A valid ladder and no worker threads.")
+  {
+    THEN("Construction is rejected.")
+    {
+      CHECK_THROWS_AS(ParallelTempering_3(0.6L, 1.1L, 0.1L,
+                                          TemperedCoupling::K, {1.0L, 1.1L},
+                                          1, 1, false, cdt::Random{7}, 0),
+                      std::invalid_argument);
+    }
+  }
+}
+
+SCENARIO("Parallel tempering assigns one coupling and stream per rung" *
+         doctest::test_suite("parallel_tempering"))
+{
+  GIVEN("A three-rung lambda ladder.")
+  {
+    vector const        ladder{0.05L, 0.1L, 0.2L};
+    ParallelTempering_3 run(0.6L, 1.1L, 0.3L, TemperedCoupling::LAMBDA,
+                            ladder, 1, 1, false, cdt::Random{41});
+    THEN("Each replica samples its own ladder value.")
+    {
+      REQUIRE_EQ(run.replicas(), ladder.size());
+      CHECK_EQ(run.ladder(), ladder);
+      CHECK_EQ(run.coupling(), TemperedCoupling::LAMBDA);
+      CHECK_EQ(run.seed(), RandomSeed{41});
+      for (size_t rung = 0; rung < ladder.size(); ++rung)
+      {
+        CAPTURE(rung);
+        CHECK_EQ(run.replica(rung).k(), 1.1L);
+        CHECK_EQ(run.replica(rung).lambda(), ladder[rung]);
+        CHECK_EQ(run.replica(rung).seed(), RandomSeed{41});
+        CHECK_EQ(run.replica(rung).stream(), random_streams::replica(rung));
+        CHECK_FALSE(run.replica(rung).writes_files());
+      }
+      CHECK_THROWS_AS(static_cast<void>(run.replica(ladder.size())),
+                      std::out_of_range);
+    }
+  }
+}
+
+SCENARIO("Parallel tempering exchange probabilities follow the rung actions" *
+         doctest::test_suite("parallel_tempering"))
+{
+  constexpr auto      alpha   = 0.6L;
+  constexpr auto      lower_k = 0.5L;
+  constexpr auto      upper_k = 1.5L;
+  constexpr auto      lambda  = 0.1L;
+  ParallelTempering_3 run(alpha, 0.0L, lambda, TemperedCoupling::K,
+                          {lower_k, upper_k}, 1, 1, false, cdt::Random{5});
+  auto const          small = make_geometry(20, 40, 10);
+  auto const          large = make_geometry(35, 60, 18);
+
+  GIVEN("Identical configurations at both rungs.")
+  {
+    THEN("The swap is certain.")
+    {
+      auto const probability = run.exchange_probability(0, small, small);
+      CHECK_EQ(mpfr_cmp_ui(probability.fr(), 1), 0);
+    }
+  }
+  GIVEN("Different configurations at the two rungs.")
+  {
+    auto const lower_parameters =
+        s3_action::make_physical_parameters(alpha, lower_k, lambda);
+    auto const upper_parameters =
+        s3_action::make_physical_parameters(alpha, upper_k, lambda);
+    auto const action = [](Geometry_3 const&                    geometry,
+                           s3_action::PhysicalParameters const& parameters) {
+      return s3_action::s3_bulk_action(geometry.N1_TL, geometry.N3_31_13,
+                                       geometry.N3_22, parameters);
+    };
+    auto const exponent = mpfr_values::subtract(
+        mpfr_values::add(action(small, lower_parameters),
+                         action(large, upper_parameters)),
+        mpfr_values::add(action(large, lower_parameters),
+                         action(small, upper_parameters)));
+    auto const ratio = mpfr_values::exponential(exponent);
+
+    THEN("One ordering matches the independent ratio and the other is one.")
+    {
+      auto const forward  = run.exchange_probability(0, small, large);
+      auto const backward = run.exchange_probability(0, large, small);
+      auto const one      = mpfr_values::from_integer(1);
+      if (mpfr_cmp(ratio.fr(), one.fr()) < 0)
+      {
+        CHECK_EQ(mpfr_cmp(forward.fr(), ratio.fr()), 0);
+        CHECK_EQ(mpfr_cmp(backward.fr(), one.fr()), 0);
+      }
+      else
+      {
+        CHECK_EQ(mpfr_cmp(forward.fr(), one.fr()), 0);
+        CHECK_LT(mpfr_cmp(backward.fr(), one.fr()), 0);
+      }
+      CHECK_THROWS_AS(static_cast<void>(run.exchange_probability(1, small,
+                                                                 large)),
+                      std::out_of_range);
+    }
+  }
+}
+
+SCENARIO("Parallel tempering replays identically for any thread count" *
+         doctest::test_suite("parallel_tempering"))
+{
+  GIVEN("Two runs from the same seed with one and three workers.")
+  {
+    auto const          initial = minimal_26_manifold();
+    vector const        ladder{0.0L, 0.2L, 0.4L};
+    constexpr auto      passes = Int_precision{3};
+    constexpr auto      seed   = cdt::RandomSeed{92};
+    ParallelTempering_3 serial(0.6L, 0.0L, 0.0L, TemperedCoupling::K, ladder,
+                               passes, passes, false, cdt::Random{seed}, 1);
+    ParallelTempering_3 threaded(0.6L, 0.0L, 0.0L, TemperedCoupling::K,
+                                 ladder, passes, passes, false,
+                                 cdt::Random{seed}, 3);
+    CAPTURE(seed);
+
+    WHEN("Both runs execute.")
+    {
+      auto const serial_result   = serial(initial);
+      auto const threaded_result = threaded(initial);
+
+      THEN("States, transitions, and swaps agree rung by rung.")
+      {
+        REQUIRE_EQ(serial_result.size(), ladder.size());
+        REQUIRE_EQ(threaded_result.size(), ladder.size());
+        for (size_t rung = 0; rung < ladder.size(); ++rung)
+        {
+          CAPTURE(rung);
+          CHECK(threaded_result[rung].is_valid());
+          CHECK_EQ(serial_result[rung].delaunay_snapshot(),
+                   threaded_result[rung].delaunay_snapshot());
+          CHECK_EQ(serial.replica(rung).transition_trace(),
+                   threaded.replica(rung).transition_trace());
+          CHECK_GT(serial.replica(rung).transition_count(), 0);
+        }
+        CHECK_EQ(serial.swap_attempts(), threaded.swap_attempts());
+        CHECK_EQ(serial.swap_accepts(), threaded.swap_accepts());
+        CHECK_EQ(serial.checkpoint_events(), 1);
+
+        // Passes alternate between the even pair (0,1) and the odd pair (1,2).
+        CHECK_EQ(serial.swap_attempts(), vector<std::uint64_t>{2, 1});
+        for (size_t pair = 0; pair < ladder.size() - 1; ++pair)
+        {
+          CHECK_LE(serial.swap_accepts()[pair], serial.swap_attempts()[pair]);
+          CHECK_GE(serial.swap_rate(pair), 0.0L);
+          CHECK_LE(serial.swap_rate(pair), 1.0L);
+        }
+      }
+      AND_THEN("Checkpoint metadata records the ladder and swap counts.")
+      {
+        auto const metadata = serial.reproducibility_metadata(
+            1, serial_result[1], utilities::ArtifactKind::CHECKPOINT, passes);
+        REQUIRE(metadata.tempering.has_value());
+        CHECK_EQ(metadata.tempering->coupling, "k");
+        CHECK_EQ(metadata.tempering->replica, 1);
+        CHECK_EQ(metadata.tempering->ladder, ladder);
+        CHECK_EQ(metadata.tempering->swap_attempts, serial.swap_attempts());
+        CHECK_EQ(metadata.tempering->swap_accepts, serial.swap_accepts());
+      }
+    }
+  }
+}
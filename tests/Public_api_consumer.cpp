@@ -143,6 +143,26 @@ static_assert(requires(Manifold const& manifold, cdt::Random& random) {
   } -> std::same_as<Move_result>;
 });
 
+static_assert(requires(Manifold& manifold, Manifold::Transaction& transaction,
+                       cdt::Random& random) {
+  { manifold.begin_transaction() } -> std::same_as<Manifold::Transaction>;
+  {
+    cdt::ergodic_moves::propose_23_move(transaction, random)
+  } -> std::same_as<cdt::ergodic_moves::MoveApplication>;
+  {
+    cdt::ergodic_moves::propose_32_move(transaction, random)
+  } -> std::same_as<cdt::ergodic_moves::MoveApplication>;
+  {
+    cdt::ergodic_moves::propose_26_move(transaction, random)
+  } -> std::same_as<cdt::ergodic_moves::MoveApplication>;
+  {
+    cdt::ergodic_moves::propose_62_move(transaction, random)
+  } -> std::same_as<cdt::ergodic_moves::MoveApplication>;
+  {
+    cdt::ergodic_moves::propose_44_move(transaction, random)
+  } -> std::same_as<cdt::ergodic_moves::MoveApplication>;
+});
+
 static_assert(requires {
   {
     cdt::s3_action::make_physical_parameters(0.6L, 1.1L, 0.1L)
@@ -158,6 +178,12 @@ static_assert(requires(cdt::s3_action::PhysicalParameters const& parameters) {
   {
     cdt::s3_action::s3_bulk_action(1, 1, 1, parameters)
   } -> std::same_as<cdt::mpfr_values::Value>;
+  {
+    cdt::s3_action::s3_bulk_action_alpha_one(1, 1, 1, parameters)
+  } -> std::same_as<cdt::mpfr_values::Value>;
+  {
+    parameters.bulk_coefficients()
+  } noexcept -> std::same_as<cdt::s3_action::ActionCoefficients const&>;
 });
 
 static_assert(requires {
@@ -65,6 +65,41 @@ SCENARIO("PCG runs are reproducible and independently split" *
       CHECK(initialization_samples != transition_samples);
     }
   }
+
+  GIVEN("An engine that has advanced part way along its stream")
+  {
+    cdt::Random original{seed, cdt::random_streams::transitions};
+    for (auto sample = 0; sample < 100; ++sample)
+    {
+      static_cast<void>(original());
+    }
+    auto const state = original.state();
+
+    THEN("its recorded state restores an engine that continues exactly")
+    {
+      auto restored = cdt::Random::restore(
+          seed, cdt::random_streams::transitions, state);
+      REQUIRE(restored.has_value());
+      CHECK_EQ(restored->seed(), seed);
+      CHECK_EQ(restored->stream(), cdt::random_streams::transitions);
+      for (auto sample = 0; sample < 256; ++sample)
+      {
+        CHECK_EQ((*restored)(), original());
+      }
+    }
+
+    THEN("the state is refused on another stream or when malformed")
+    {
+      using cdt::random_streams::initialization;
+      using cdt::random_streams::transitions;
+      CHECK_FALSE(
+          cdt::Random::restore(seed, initialization, state).has_value());
+      CHECK_FALSE(
+          cdt::Random::restore(seed, transitions, "not a state").has_value());
+      CHECK_FALSE(
+          cdt::Random::restore(seed, transitions, state + " 7").has_value());
+    }
+  }
 }
 
 SCENARIO("Distinct seeds have pinned PCG transition prefixes" *
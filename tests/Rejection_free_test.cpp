@@ -0,0 +1,113 @@
+/*******************************************************************************
+ Causal Dynamical Triangulations in C++ using CGAL
+
+ Copyright © 2026 Adam Getchell
+ ******************************************************************************/
+
+/// @file Rejection_free_test.cpp
+/// @brief Tests for the rejection-free Metropolis strategy
+
+#include "Rejection_free.hpp"
+
+#include <doctest/doctest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+
+using namespace cdt;
+using namespace std;
+using namespace manifolds;
+
+SCENARIO("Rejection-free weights are the Metropolis acceptance probabilities" *
+         doctest::test_suite("rejection_free"))
+{
+  constexpr auto  alpha  = 0.6L;
+  constexpr auto  k      = 1.1L;
+  constexpr auto  lambda = 0.1L;
+  RejectionFree_3 run(alpha, k, lambda, 1, 1, false, cdt::Random{7});
+  Metropolis_3    metropolis(alpha, k, lambda, 1, 1, false, cdt::Random{7});
+  GIVEN("A correctly-constructed Manifold_3.")
+  {
+    Manifold_3 const universe(640, 4, cdt::Random{92});
+    REQUIRE(universe.is_correct());
+    auto const geometry = universe.geometry();
+    THEN("Each class is weighted by its site-independent acceptance.")
+    {
+      auto const weights = run.acceptance_weights(geometry);
+      for (auto index = size_t{0}; index < weights.size(); ++index)
+      {
+        auto const move     = *move_tracker::move_from_index(index);
+        auto const proposed =
+            ergodic_moves::detail::moved_geometry(geometry, move);
+        CAPTURE(move);
+        REQUIRE(proposed.has_value());
+        auto const expected = mpfr_values::to_long_double(
+            metropolis.acceptance_probability(geometry, *proposed, move));
+        CHECK(weights[index] == doctest::Approx(expected).epsilon(1.0e-15L));
+        CHECK_GT(weights[index], 0.0L);
+        CHECK_LE(weights[index], 1.0L);
+      }
+    }
+  }
+  GIVEN("A geometry with no timelike edges.")
+  {
+    Geometry_3 geometry;
+    geometry.N3_22 = 4;
+    geometry.N3    = 4;
+    THEN("A (3,2) move can never be accepted.")
+    {
+      auto const weights = run.acceptance_weights(geometry);
+      auto const index   = static_cast<size_t>(
+          move_tracker::as_integer(move_tracker::MoveType::THREE_TWO));
+      CHECK_EQ(weights[index], 0.0L);
+    }
+  }
+}
+
+SCENARIO("Rejection-free runs advance equivalent Metropolis time" *
+         doctest::test_suite("rejection_free"))
+{
+  GIVEN("A correctly-constructed Manifold_3 and two runs from one seed.")
+  {
+    Manifold_3 const universe(640, 4, cdt::Random{92});
+    REQUIRE(universe.is_correct());
+    constexpr auto  passes = Int_precision{2};
+    RejectionFree_3 first(0.6L, 1.1L, 0.1L, passes, passes, false,
+                          cdt::Random{31});
+    RejectionFree_3 second(0.6L, 1.1L, 0.1L, passes, passes, false,
+                           cdt::Random{31});
+    WHEN("Both runs execute.")
+    {
+      auto const first_result  = first(universe);
+      auto const second_result = second(universe);
+      THEN("Each pass spans at least N3 Metropolis transitions.")
+      {
+        CHECK(first_result.is_valid());
+        // The first pass alone spans the initial N3.
+        CHECK_GE(first.metropolis_time(),
+                 static_cast<long double>(universe.N3()));
+        CHECK_GT(first.selected().total(), 0);
+        CHECK_EQ(first.selected().total(),
+                 first.accepted().total() + first.failed().total());
+        CHECK_EQ(first.attempted().total(), first.selected().total());
+        CHECK_EQ(first.transition_count(),
+                 static_cast<std::uint64_t>(first.selected().total()));
+      }
+      AND_THEN("The run replays exactly from the same seed.")
+      {
+        CHECK_EQ(first_result.delaunay_snapshot(),
+                 second_result.delaunay_snapshot());
+        CHECK_EQ(first.transition_trace(), second.transition_trace());
+        CHECK_EQ(first.metropolis_time(), second.metropolis_time());
+      }
+      AND_THEN("Provenance records the equivalent Metropolis time.")
+      {
+        auto const metadata = first.reproducibility_metadata(
+            first_result, utilities::ArtifactKind::CHECKPOINT, passes);
+        CHECK_EQ(metadata.metropolis_time, first.metropolis_time());
+        CHECK_EQ(metadata.transition_stream, first.stream());
+      }
+    }
+  }
+}
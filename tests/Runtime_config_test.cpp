@@ -13,6 +13,7 @@
 
 #include <limits>
 #include <type_traits>
+#include <vector>
 
 using namespace cdt;
 
@@ -51,6 +52,7 @@ static_assert(
     !std::is_constructible_v<
         runtime_config::Simulation, runtime_config::Triangulation, long double,
         long double, long double, Int_precision, Int_precision, bool>);
+static_assert(!std::is_default_constructible_v<runtime_config::Sampling>);
 
 SCENARIO("Runtime triangulation options parse into a validated value" *
          doctest::test_suite("runtime_config"))
@@ -285,3 +287,57 @@ SCENARIO("Simulation options parse into a validated value" *
     }
   }
 }
+
+SCENARIO("Sampling options parse into a validated value" *
+         doctest::test_suite("runtime_config"))
+{
+  GIVEN("Raw chain, worker, and ladder options.")
+  {
+    WHEN("Several chains and workers are requested without a ladder.")
+    {
+      auto const config = runtime_config::make_sampling(8, 4, {});
+
+      THEN("The value describes an untempered ensemble.")
+      {
+        CHECK_EQ(config.chains(), 8);
+        CHECK_EQ(config.workers(), 4);
+        CHECK_FALSE(config.tempering());
+      }
+    }
+    WHEN("A ladder is requested for a single chain.")
+    {
+      auto const config =
+          runtime_config::make_sampling(1, 2, {0.5L, 1.0L, 1.5L});
+
+      THEN("The value describes a tempered run.")
+      {
+        CHECK(config.tempering());
+        CHECK_EQ(config.ladder(), std::vector{0.5L, 1.0L, 1.5L});
+      }
+    }
+    WHEN("A count is nonpositive.")
+    {
+      THEN("The option is rejected as invalid input.")
+      {
+        CHECK_THROWS_AS(runtime_config::make_sampling(0, 1, {}),
+                        std::invalid_argument);
+        CHECK_THROWS_AS(runtime_config::make_sampling(1, -1, {}),
+                        std::invalid_argument);
+      }
+    }
+    WHEN("A ladder is degenerate or combined with several chains.")
+    {
+      THEN("The option is rejected as invalid input.")
+      {
+        CHECK_THROWS_AS(runtime_config::make_sampling(1, 1, {1.0L}),
+                        std::invalid_argument);
+        CHECK_THROWS_AS(
+            runtime_config::make_sampling(
+                1, 1, {1.0L, std::numeric_limits<long double>::quiet_NaN()}),
+            std::invalid_argument);
+        CHECK_THROWS_AS(runtime_config::make_sampling(2, 1, {0.5L, 1.0L}),
+                        std::invalid_argument);
+      }
+    }
+  }
+}
@@ -278,6 +278,55 @@ SCENARIO("Calculate the bulk action on S3 triangulations" *
   }
 }
 
+SCENARIO("Cached action coefficients reproduce the per-call actions" *
+         doctest::test_suite("s3action"))
+{
+  GIVEN("Physical parameters and a range of simplex counts.")
+  {
+    constexpr auto K          = 1.1L;  // NOLINT
+    constexpr auto Lambda     = 0.1L;
+    auto const     parameters = make_physical_parameters(0.6L, K, Lambda);
+    WHEN("The specialized actions are evaluated both ways.")
+    {
+      THEN("The cached coefficients give bit-identical values.")
+      {
+        for (Int_precision count = 0; count < 2000; count += 97)  // NOLINT
+        {
+          CAPTURE(count);
+          auto const n3_22 = 3 * count + 1;
+          CHECK(mpfr_equal_p(
+                    s3_bulk_action_alpha_one(count, 2 * count, n3_22,
+                                             parameters)
+                        .fr(),
+                    s3_bulk_action_alpha_one(count, 2 * count, n3_22, K,
+                                             Lambda)
+                        .fr()) != 0);
+          CHECK(mpfr_equal_p(
+                    s3_bulk_action_alpha_minus_one_imaginary_coefficient(
+                        count, 2 * count, n3_22, parameters)
+                        .fr(),
+                    s3_bulk_action_alpha_minus_one_imaginary_coefficient(
+                        count, 2 * count, n3_22, K, Lambda)
+                        .fr()) != 0);
+        }
+      }
+    }
+    WHEN("The generalized action is evaluated at unit counts.")
+    {
+      auto const& coefficients = parameters.bulk_coefficients();
+      THEN("Each unit count selects its cached coefficient.")
+      {
+        CHECK(mpfr_equal_p(s3_bulk_action(1, 0, 0, parameters).fr(),
+                           coefficients.n1_tl.fr()) != 0);
+        CHECK(mpfr_equal_p(s3_bulk_action(0, 1, 0, parameters).fr(),
+                           coefficients.n3_31_13.fr()) != 0);
+        CHECK(mpfr_equal_p(s3_bulk_action(0, 0, 1, parameters).fr(),
+                           coefficients.n3_22.fr()) != 0);
+      }
+    }
+  }
+}
+
 SCENARIO("Bulk action precision survives the acceptance boundary" *
          doctest::test_suite("s3action"))
 {
@@ -367,3 +416,84 @@ SCENARIO("Bulk action rejects invalid physical parameters" *
     }
   }
 }
+
+SCENARIO("Volume-fixing potentials are validated and evaluated" *
+         doctest::test_suite("s3action"))
+{
+  GIVEN("Linear and quadratic terms around 100 simplices.")
+  {
+    auto const linear =
+        make_volume_fixing(VolumePotential::LINEAR, 0.5L, 100);
+    auto const quadratic =
+        make_volume_fixing(VolumePotential::QUADRATIC, 0.5L, 100);
+    THEN("The potentials follow their definitions.")
+    {
+      CHECK_EQ(mpfr_values::to_long_double(volume_potential(90, linear)),
+               5.0L);
+      CHECK_EQ(mpfr_values::to_long_double(volume_potential(110, quadratic)),
+               50.0L);
+      CHECK_EQ(mpfr_values::to_long_double(volume_potential(90, {})), 0.0L);
+    }
+    THEN("The long-double exponent is the potential difference.")
+    {
+      CHECK_EQ(volume_exponent(90, 91, linear), 0.5L);
+      CHECK_EQ(volume_exponent(110, 112, quadratic), -22.0L);
+      CHECK_EQ(volume_exponent(110, 112, {}), 0.0L);
+    }
+    THEN("The factor bounds bracket the exponential within one ulp.")
+    {
+      auto const linear_bounds    = volume_factor_bounds(90, 91, linear);
+      auto const quadratic_bounds = volume_factor_bounds(110, 112, quadratic);
+      auto const linear_factor    = mpfr_values::to_long_double(
+          mpfr_values::exponential(mpfr_values::from_long_double(0.5L)));
+      auto const quadratic_factor = mpfr_values::to_long_double(
+          mpfr_values::exponential(mpfr_values::from_long_double(-22.0L)));
+      CHECK_LE(linear_bounds.lower, linear_factor);
+      CHECK_GE(linear_bounds.upper, linear_factor);
+      CHECK_EQ(std::nextafter(linear_bounds.lower, 2.0L), linear_bounds.upper);
+      CHECK_LE(quadratic_bounds.lower, quadratic_factor);
+      CHECK_GE(quadratic_bounds.upper, quadratic_factor);
+      CHECK_LT(quadratic_bounds.lower, quadratic_bounds.upper);
+      CHECK_EQ(volume_factor_bounds(110, 112, {}).lower, 1.0L);
+      CHECK_EQ(volume_factor_bounds(110, 112, {}).upper, 1.0L);
+    }
+    THEN("Physical parameters carry the term.")
+    {
+      auto const parameters =
+          make_physical_parameters(0.6L, 1.1L, 0.1L, quadratic);
+      CHECK(parameters.volume_fixing().enabled());
+      CHECK_EQ(parameters.volume_fixing().target, 100);
+      CHECK_FALSE(
+          make_physical_parameters(0.6L, 1.1L, 0.1L).volume_fixing().enabled());
+    }
+  }
+  GIVEN("Out-of-range terms.")
+  {
+    THEN("Construction rejects them.")
+    {
+      CHECK_THROWS_WITH_AS(
+          static_cast<void>(
+              make_volume_fixing(VolumePotential::LINEAR, 0.0L, 100)),
+          "Volume-fixing epsilon must be finite and positive.",
+          std::invalid_argument);
+      CHECK_THROWS_WITH_AS(
+          static_cast<void>(make_volume_fixing(
+              VolumePotential::QUADRATIC,
+              std::numeric_limits<long double>::infinity(), 100)),
+          "Volume-fixing epsilon must be finite and positive.",
+          std::invalid_argument);
+      CHECK_THROWS_WITH_AS(
+          static_cast<void>(
+              make_volume_fixing(VolumePotential::LINEAR, 0.5L, 0)),
+          "Volume-fixing target must be positive.", std::invalid_argument);
+      CHECK_THROWS_AS(
+          static_cast<void>(make_physical_parameters(
+              0.6L, 1.1L, 0.1L, {.potential = VolumePotential::LINEAR})),
+          std::invalid_argument);
+      CHECK_THROWS_AS(static_cast<void>(parse_volume_potential("cubic")),
+                      std::invalid_argument);
+      CHECK_EQ(parse_volume_potential("quadratic"),
+               VolumePotential::QUADRATIC);
+    }
+  }
+}
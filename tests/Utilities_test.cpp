@@ -466,7 +466,7 @@ SCENARIO("Reading and writing Delaunay triangulations to files" *
                  utilities::detail::canonical_topology_fingerprint(annotated));
       }
 
-      THEN("Payload indices preserve all vertex and cell metadata")
+      THEN("Payload indices preserve all vertex and cell metadata and ids")
       {
         auto original_vertex = annotated.finite_vertex_handles().begin();
         auto restored_vertex = restored.finite_vertex_handles().begin();
@@ -475,6 +475,7 @@ SCENARIO("Reading and writing Delaunay triangulations to files" *
         {
           REQUIRE(restored_vertex != restored.finite_vertex_handles().end());
           CHECK_EQ((*restored_vertex)->info(), (*original_vertex)->info());
+          CHECK_EQ((*restored_vertex)->id(), (*original_vertex)->id());
         }
         CHECK(restored_vertex == restored.finite_vertex_handles().end());
 
@@ -485,6 +486,7 @@ SCENARIO("Reading and writing Delaunay triangulations to files" *
         {
           REQUIRE(restored_cell != restored.finite_cell_handles().end());
           CHECK_EQ((*restored_cell)->info(), (*original_cell)->info());
+          CHECK_EQ((*restored_cell)->id(), (*original_cell)->id());
         }
         CHECK(restored_cell == restored.finite_cell_handles().end());
       }
@@ -639,6 +641,87 @@ SCENARIO("Reading and writing Delaunay triangulations to files" *
             utilities::detail::read_persistence_metadata(
                 metadata_filename(filename));
         CHECK_FALSE(parsed_metadata.max_threads.has_value());
+        CHECK_THROWS_AS(static_cast<void>(read_resume_metadata(filename)),
+                        std::filesystem::filesystem_error);
+      }
+    }
+    WHEN("A checkpoint records the state needed to resume its run")
+    {
+      TemporaryDirectory const directory;
+      auto const               filename = directory.file("checkpoint.off");
+      auto                     metadata = make_reproducibility_metadata(
+          manifold, cdt::RandomSeed{92}, ArtifactKind::CHECKPOINT);
+      cdt::Random engine{cdt::RandomSeed{92},
+                         cdt::random_streams::transitions};
+      static_cast<void>(engine());
+      metadata.alpha               = 0.6L;
+      metadata.k                   = 1.1L;
+      metadata.lambda              = 0.1L;
+      metadata.configured_passes   = 10;
+      metadata.checkpoint_interval = 2;
+      metadata.completed_passes    = 4;
+      metadata.transition_trace    = 0x1234;
+      metadata.transition_count    = 17;
+      metadata.interruption        = Interruption_metadata{
+          .reason = "signal", .pass_attempts = 64, .pass_transitions = 9};
+      metadata.resume = Resume_metadata{.transition_engine = engine.state(),
+                                        .proposed  = {5, 4, 3, 2, 1},
+                                        .accepted  = {1, 1, 1, 1, 1},
+                                        .rejected  = {4, 3, 2, 1, 0},
+                                        .attempted = {5, 4, 3, 2, 1},
+                                        .succeeded = {2, 2, 2, 2, 1},
+                                        .failed    = {3, 2, 1, 0, 0}};
+
+      write_file(filename, manifold.delaunay_snapshot(), metadata);
+
+      THEN("Its sidecar is resumable and reads back as written")
+      {
+        std::ifstream     metadata_input{metadata_filename(filename)};
+        std::string const contents{
+            std::istreambuf_iterator<char>{metadata_input},
+            std::istreambuf_iterator<char>{}};
+        CHECK_NE(contents.find("resume_supported=true"), std::string::npos);
+        CHECK_NE(contents.find("resume.rejected=4,3,2,1,0"),
+                 std::string::npos);
+
+        auto const restored = read_resume_metadata(filename);
+        REQUIRE(restored.resume.has_value());
+        CHECK_EQ(restored.resume->transition_engine, engine.state());
+        CHECK(restored.resume->proposed == metadata.resume->proposed);
+        CHECK(restored.resume->failed == metadata.resume->failed);
+        CHECK(restored.alpha == metadata.alpha);
+        CHECK(restored.completed_passes == metadata.completed_passes);
+        CHECK(restored.transition_trace == metadata.transition_trace);
+        CHECK(restored.transition_count == metadata.transition_count);
+        REQUIRE(restored.interruption.has_value());
+        CHECK_EQ(restored.interruption->reason, "signal");
+        CHECK_EQ(restored.interruption->pass_transitions, 9);
+      }
+    }
+    WHEN("A checkpoint records an engine state of another stream")
+    {
+      TemporaryDirectory const directory;
+      auto const               filename = directory.file("checkpoint.off");
+      auto                     metadata = make_reproducibility_metadata(
+          manifold, cdt::RandomSeed{92}, ArtifactKind::CHECKPOINT);
+      metadata.completed_passes = 4;
+      metadata.resume           = Resume_metadata{
+                    .transition_engine = cdt::Random{cdt::RandomSeed{92},
+                                           cdt::random_streams::initialization}
+                                   .state(),
+                    .proposed          = {0, 0, 0, 0, 0},
+                    .accepted          = {0, 0, 0, 0, 0},
+                    .rejected          = {0, 0, 0, 0, 0},
+                    .attempted         = {0, 0, 0, 0, 0},
+                    .succeeded         = {0, 0, 0, 0, 0},
+                    .failed            = {0, 0, 0, 0, 0}};
+
+      THEN("Publication is refused")
+      {
+        CHECK_THROWS_AS(
+            write_file(filename, manifold.delaunay_snapshot(), metadata),
+            std::filesystem::filesystem_error);
+        CHECK_FALSE(std::filesystem::exists(filename));
       }
     }
   }